@@ -25,6 +25,8 @@
 #include "interfaces/info/InfoExpression.h"
 #include "messaging/ApplicationMessenger.h"
 #include "playlists/PlayListTypes.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "settings/SkinSettings.h"
 #include "utils/ArtUtils.h"
 #include "utils/CharsetConverter.h"
@@ -37,6 +39,7 @@
 #include <algorithm>
 #include <array>
 #include <charconv>
+#include <chrono>
 #include <cmath>
 #include <functional>
 #include <iterator>
@@ -10473,6 +10476,9 @@ CGUIInfoManager::~CGUIInfoManager() = default;
 void CGUIInfoManager::Initialize()
 {
   CServiceBroker::GetAppMessenger()->RegisterReceiver(this);
+
+  const auto settings = CServiceBroker::GetSettingsComponent();
+  m_profileConditions = settings && settings->GetAdvancedSettings()->m_guiProfileConditions;
 }
 
 /// \brief Translates a string as given by the skin into an int that we use for more
@@ -11482,6 +11488,21 @@ INFO::InfoPtr CGUIInfoManager::Register(const std::string &expression, int conte
   return *(res.first);
 }
 
+bool CGUIInfoManager::GetDependencies(
+    int condition, GUIINFO::CGUIInfoChanges::Dependencies& dependencies) const
+{
+  int info = std::abs(condition);
+  while (info >= MULTI_INFO_START && info <= MULTI_INFO_END)
+    info = std::abs(m_multiInfo[info - MULTI_INFO_START].GetInfo());
+
+  if (!m_infoProviders.GetChanges().AddDependencies(info, dependencies))
+  {
+    dependencies.clear();
+    return false;
+  }
+  return true;
+}
+
 void CGUIInfoManager::UnRegister(const INFO::InfoPtr& expression)
 {
   std::unique_lock lock(m_critInfo);
@@ -11809,6 +11830,9 @@ void CGUIInfoManager::SetCurrentAlbumThumb(const std::string &thumbFileName)
 void CGUIInfoManager::Clear()
 {
   std::unique_lock lock(m_critInfo);
+  if (m_profileConditions)
+    LogConditionProfile();
+
   m_skinVariableStrings.clear();
 
   /*
@@ -11830,6 +11854,42 @@ void CGUIInfoManager::Clear()
   for (const auto& infoBool : m_bools)
     CLog::Log(LOGDEBUG, "Infobool '{}' still used by {} instances", infoBool->GetExpression(),
               infoBool.use_count());
+
+  // the remaining ones may depend on skin data which is gone now
+  m_infoProviders.GetChanges().NotifyAllChanged();
+}
+
+void CGUIInfoManager::LogConditionProfile(size_t count /* = 25 */) const
+{
+  std::unique_lock lock(m_critInfo);
+
+  std::vector<INFO::InfoPtr> bools(m_bools.begin(), m_bools.end());
+  count = std::min(count, bools.size());
+  std::ranges::partial_sort(bools, bools.begin() + count, std::ranges::greater{},
+                            &INFO::InfoBool::GetEvaluationTime);
+
+  uint64_t evaluations = 0;
+  size_t tracked = 0;
+  for (const auto& infoBool : bools)
+  {
+    evaluations += infoBool->GetEvaluations();
+    if (infoBool->IsChangeTracked())
+      ++tracked;
+  }
+
+  CLog::Log(LOGINFO,
+            "Condition profile: {} conditions ({} change tracked), {} evaluations. Most expensive "
+            "ones, including the time of their operands:",
+            bools.size(), tracked, evaluations);
+  for (size_t i = 0; i < count; ++i)
+  {
+    const auto& infoBool = bools[i];
+    const auto time = std::chrono::duration<double, std::micro>(infoBool->GetEvaluationTime());
+    CLog::Log(LOGINFO, "  {:10.3f} ms {:8} x {:8.3f} us{} '{}'", time.count() / 1000,
+              infoBool->GetEvaluations(),
+              infoBool->GetEvaluations() > 0 ? time.count() / infoBool->GetEvaluations() : 0.0,
+              infoBool->IsChangeTracked() ? " (tracked)" : "", infoBool->GetExpression());
+  }
 }
 
 void CGUIInfoManager::UpdateAVInfo() const
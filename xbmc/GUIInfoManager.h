@@ -98,6 +98,26 @@ public:
   int TranslateString(const std::string &strCondition);
   int TranslateSingleString(const std::string &strCondition, bool &listItemDependent);
 
+  /*! \brief Get the change stamps of the infos a boolean condition depends on
+   \param condition the condition, as returned by TranslateSingleString
+   \param dependencies will be filled with the stamps, cleared if the condition's info doesn't
+   publish its changes
+   \return true if the condition only changes with the infos, false otherwise
+   \sa KODI::GUILIB::GUIINFO::CGUIInfoChanges
+   */
+  bool GetDependencies(int condition,
+                       KODI::GUILIB::GUIINFO::CGUIInfoChanges::Dependencies& dependencies) const;
+
+  /*! \brief Whether the evaluation of boolean conditions gets timed
+   (advanced setting gui.profileconditions)
+   */
+  bool IsProfilingConditions() const { return m_profileConditions; }
+
+  /*! \brief Log the boolean conditions that took the most time to evaluate
+   \param count the number of conditions to log
+   */
+  void LogConditionProfile(size_t count = 25) const;
+
   std::string GetLabel(int info, int contextWindow, std::string* fallback = nullptr) const;
   std::string GetImage(int info, int contextWindow, std::string *fallback = nullptr);
   bool GetInt(int& value, int info, int contextWindow, const CGUIListItem* item = nullptr) const;
@@ -225,9 +245,10 @@ private:
 
   INFOBOOLTYPE m_bools{&CGUIInfoManager::InfoBoolComparator};
   unsigned int m_refreshCounter = 0;
+  bool m_profileConditions = false;
   std::vector<INFO::CSkinVariableString> m_skinVariableStrings;
 
-  CCriticalSection m_critInfo;
+  mutable CCriticalSection m_critInfo;
 
   KODI::GUILIB::GUIINFO::CGUIInfoProviders m_infoProviders;
 };
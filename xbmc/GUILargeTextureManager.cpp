@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "TextureCache.h"
 #include "commons/ilog.h"
+#include "guilib/DDSImage.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/Texture.h"
 #include "jobs/JobManager.h"
@@ -21,6 +22,7 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <exception>
@@ -58,12 +60,30 @@ bool CImageLoader::DoWork()
 
   if (!loadPath.empty())
   {
-    // direct route - load the image
+    // direct route - load the image, from its pre-decoded copy if there is one
     auto start = std::chrono::steady_clock::now();
-    m_texture = CTexture::LoadFromFile(loadPath, m_targetWidth, m_targetHeight, m_aspectRatio);
+    bool preDecoded = false;
+    if (m_use_cache && CTextureCache::UsePreDecodedImages())
+    {
+      // the copy has the size of the cached image, only use it if that isn't more than we need
+      const std::string preDecodedPath = CTextureCache::GetPreDecodedPath(loadPath);
+      CDDSImage image;
+      if (!preDecodedPath.empty() && image.ReadHeader(preDecodedPath) &&
+          (!m_targetWidth || image.GetWidth() <= m_targetWidth) &&
+          (!m_targetHeight || image.GetHeight() <= m_targetHeight))
+      {
+        m_texture = CTexture::LoadFromFile(preDecodedPath);
+        preDecoded = m_texture != nullptr;
+      }
+    }
+    if (!m_texture)
+      m_texture = CTexture::LoadFromFile(loadPath, m_targetWidth, m_targetHeight, m_aspectRatio);
 
     auto end = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    if (m_texture && m_use_cache)
+      CServiceBroker::GetTextureCache()->RecordLoad(
+          preDecoded, std::chrono::duration_cast<std::chrono::microseconds>(end - start));
 
     if (duration.count() > 100)
       CLog::Log(LOGDEBUG, "{} - took {} ms to load {}", __FUNCTION__, duration.count(), loadPath);
@@ -247,7 +267,8 @@ void CGUILargeTextureManager::QueueImage(const std::string& path,
                                          unsigned int width,
                                          unsigned int height,
                                          CAspectRatio::AspectRatio aspectRatio,
-                                         bool useCache)
+                                         bool useCache,
+                                         CJob::PRIORITY priority)
 {
   if (path.empty())
     return;
@@ -267,10 +288,67 @@ void CGUILargeTextureManager::QueueImage(const std::string& path,
   // queue the item
   CLargeTexture* image = new CLargeTexture(path, width, height, aspectRatio);
   unsigned int jobID = CServiceBroker::GetJobManager()->AddJob(
-      new CImageLoader(path, width, height, aspectRatio, useCache), this, CJob::PRIORITY_NORMAL);
+      new CImageLoader(path, width, height, aspectRatio, useCache), this, priority);
   m_queued.emplace_back(jobID, image);
 }
 
+void CGUILargeTextureManager::SetPrefetch(const void* owner, std::vector<LargeImageRequest> images)
+{
+  std::unique_lock lock(m_listSection);
+
+  // drop duplicates, e.g. from a wrapping list shorter than the prefetched range
+  std::vector<LargeImageRequest> wanted;
+  for (auto& image : images)
+  {
+    if (wanted.size() == MAX_PREFETCH_IMAGES)
+      break;
+    if (!image.path.empty() && std::find(wanted.begin(), wanted.end(), image) == wanted.end())
+      wanted.emplace_back(std::move(image));
+  }
+
+  std::vector<LargeImageRequest> previous;
+  auto it = m_prefetched.find(owner);
+  if (it != m_prefetched.end())
+    previous = std::move(it->second);
+
+  // take the new ones before releasing the old ones, so those in both stay
+  for (const auto& image : wanted)
+  {
+    if (std::find(previous.begin(), previous.end(), image) != previous.end())
+      continue;
+
+    auto allocated = std::find_if(m_allocated.begin(), m_allocated.end(),
+                                  [&image](const CLargeTexture* texture)
+                                  {
+                                    return texture->GetPath() == image.path &&
+                                           texture->GetTargetWidth() == image.width &&
+                                           texture->GetTargetHeight() == image.height &&
+                                           texture->GetAspectRatio() == image.aspectRatio;
+                                  });
+    if (allocated != m_allocated.end())
+      (*allocated)->AddRef();
+    else
+      QueueImage(image.path, image.width, image.height, image.aspectRatio, image.useCache,
+                 CJob::PRIORITY_LOW);
+  }
+
+  for (const auto& image : previous)
+  {
+    if (std::find(wanted.begin(), wanted.end(), image) == wanted.end())
+      ReleaseImage(image.path, image.width, image.height, image.aspectRatio);
+  }
+
+  if (wanted.empty())
+  {
+    if (it != m_prefetched.end())
+      m_prefetched.erase(it);
+  }
+  else if (it != m_prefetched.end())
+    it->second = std::move(wanted);
+  else
+    m_prefetched.emplace(owner, std::move(wanted));
+}
+
 void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJob *job)
 {
   // see if we still have this job id
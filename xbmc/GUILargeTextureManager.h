@@ -14,6 +14,7 @@
 #include "jobs/Job.h"
 #include "threads/CriticalSection.h"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -21,6 +22,21 @@
 
 class CTexture;
 
+/*!
+ \ingroup textures
+ \brief An image to load through CGUILargeTextureManager, identified like in GetImage()
+ */
+struct LargeImageRequest
+{
+  std::string path;
+  unsigned int width;
+  unsigned int height;
+  CAspectRatio::AspectRatio aspectRatio;
+  bool useCache;
+
+  bool operator==(const LargeImageRequest& other) const = default;
+};
+
 /*!
  \ingroup textures,jobs
  \brief Image loader job class
@@ -132,6 +148,22 @@ public:
    */
   void CleanupUnusedImages(bool immediately = false);
 
+  //! images loaded ahead per owner at most
+  static constexpr size_t MAX_PREFETCH_IMAGES = 64;
+
+  /*!
+   \brief Set the images to load ahead for an owner, e.g. the items a container scrolls to next.
+
+   Images are loaded at a lower priority than the ones requested by GetImage(), and held until
+   they are no longer in the list of the owner. Those are released like with ReleaseImage(),
+   which cancels loading them if it hasn't finished.
+
+   \param owner whoever wants the images, each owner has one list
+   \param images images in the order they are wanted, only the first MAX_PREFETCH_IMAGES are taken.
+   An empty list releases all images of the owner.
+   */
+  void SetPrefetch(const void* owner, std::vector<LargeImageRequest> images);
+
 private:
   class CLargeTexture
   {
@@ -169,13 +201,16 @@ private:
                   unsigned int width,
                   unsigned int height,
                   CAspectRatio::AspectRatio aspectRatio,
-                  bool useCache = true);
+                  bool useCache = true,
+                  CJob::PRIORITY priority = CJob::PRIORITY_NORMAL);
 
   std::vector< std::pair<unsigned int, CLargeTexture *> > m_queued;
   std::vector<CLargeTexture *> m_allocated;
   typedef std::vector<CLargeTexture *>::iterator listIterator;
   typedef std::vector< std::pair<unsigned int, CLargeTexture *> >::iterator queueIterator;
 
+  std::map<const void*, std::vector<LargeImageRequest>> m_prefetched;
+
   CCriticalSection m_listSection;
 };
 
@@ -49,6 +49,8 @@ enum class MeridiemSymbol
 
 class CLangInfo : public ISettingCallback, public ISettingsHandler
 {
+  friend class TestLangInfoHelper;
+
 public:
   CLangInfo();
   ~CLangInfo() override;
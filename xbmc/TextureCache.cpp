@@ -23,6 +23,7 @@
 #include "jobs/Job.h"
 #include "jobs/JobManager.h"
 #include "profiles/ProfileManager.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/Crc32.h"
 #include "utils/StringUtils.h"
@@ -30,6 +31,7 @@
 #include "utils/log.h"
 
 #include <chrono>
+#include <cmath>
 #include <exception>
 #include <mutex>
 #include <optional>
@@ -38,11 +40,32 @@
 using namespace XFILE;
 using namespace std::chrono_literals;
 
+namespace
+{
+// the job manager runs two pausable low priority jobs at once, one of them is left to the images
+// the GUI shows, so they don't wait for those cached in bulk
+constexpr unsigned int BULK_JOBS_AT_ONCE = 1;
+} // namespace
+
 CTextureCache::CTextureCache()
-  : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE), m_cleanTimer{[this]() { CleanTimer(); }}
+  : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE),
+    m_cleanTimer{[this]() { CleanTimer(); }},
+    m_bulkQueue(*this)
+{
+}
+
+CTextureCache::CBulkQueue::CBulkQueue(CTextureCache& cache)
+  : CJobQueue(false, BULK_JOBS_AT_ONCE, CJob::PRIORITY_LOW_PAUSABLE), m_cache(cache)
 {
 }
 
+void CTextureCache::CBulkQueue::OnJobComplete(unsigned int jobID, bool success, CJob* job)
+{
+  if (strcmp(job->GetType(), CTextureCacheJob::JOB_TYPE_CACHE_IMAGE) == 0)
+    m_cache.OnCachingComplete(success, static_cast<CTextureCacheJob*>(job));
+  CJobQueue::OnJobComplete(jobID, success, job);
+}
+
 CTextureCache::~CTextureCache() = default;
 
 void CTextureCache::Initialize()
@@ -57,6 +80,7 @@ void CTextureCache::Deinitialize()
 {
   m_cleanTimer.Stop(true);
   CancelJobs();
+  m_bulkQueue.CancelJobs();
 
   std::unique_lock lock(m_databaseSection);
   m_database.Close();
@@ -117,7 +141,7 @@ std::string CTextureCache::CheckCachedImage(const std::string &url, bool &needsR
   return "";
 }
 
-void CTextureCache::BackgroundCacheImage(const std::string &url)
+void CTextureCache::BackgroundCacheImage(const std::string& url, bool bulk /* = false */)
 {
   if (url.empty())
     return;
@@ -131,8 +155,21 @@ void CTextureCache::BackgroundCacheImage(const std::string &url)
   if (path.empty())
     return;
 
-  // needs (re)caching
-  AddJob(new CTextureCacheJob(path, details.hash));
+  // needs (re)caching, unless it's queued or being cached already
+  auto job = std::make_unique<CTextureCacheJob>(path, details.hash);
+  std::unique_lock lock(m_queueSection);
+  if (m_bulkQueue.HasJob(job.get()) || HasJob(job.get()))
+    return;
+  {
+    std::unique_lock processingLock(m_processingSection);
+    if (m_processinglist.contains(path))
+      return;
+  }
+
+  if (bulk)
+    m_bulkQueue.AddJob(job.release());
+  else
+    AddJob(job.release());
 }
 
 bool CTextureCache::StartCacheImage(const std::string& image)
@@ -222,7 +259,7 @@ void CTextureCache::ClearCachedImage(const std::string& image, bool deleteSource
     path = GetCachedPath(cachedFile);
   if (CFile::Exists(path))
     CFile::Delete(path);
-  path = URIUtils::ReplaceExtension(path, ".dds");
+  path = GetPreDecodedPath(path);
   if (CFile::Exists(path))
     CFile::Delete(path);
 }
@@ -235,7 +272,7 @@ bool CTextureCache::ClearCachedImage(int id)
     cachedFile = GetCachedPath(cachedFile);
     if (CFile::Exists(cachedFile))
       CFile::Delete(cachedFile);
-    cachedFile = URIUtils::ReplaceExtension(cachedFile, ".dds");
+    cachedFile = GetPreDecodedPath(cachedFile);
     if (CFile::Exists(cachedFile))
       CFile::Delete(cachedFile);
     return true;
@@ -301,6 +338,66 @@ std::string CTextureCache::GetCachedPath(const std::string &file)
   return URIUtils::AddFileToFolder(profileManager->GetThumbnailsFolder(), file);
 }
 
+CachedImageFormat CTextureCache::GetCachedImageFormat(unsigned int width, unsigned int height)
+{
+  const std::shared_ptr<CAdvancedSettings> advancedSettings =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+
+  CachedImageFormat format = advancedSettings->m_imageCacheFormat;
+  if (height > 0 &&
+      std::abs(static_cast<float>(width) / static_cast<float>(height) / (16.0f / 9.0f) - 1.0f) <=
+          0.01f)
+    format = advancedSettings->m_fanartCacheFormat;
+
+  // no use storing what the GPU can't take
+  if (format == CachedImageFormat::COMPRESSED && !CTexture::SupportsDXT())
+    format = CachedImageFormat::RAW;
+  return format;
+}
+
+bool CTextureCache::UsePreDecodedImages()
+{
+  const std::shared_ptr<CAdvancedSettings> advancedSettings =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  return advancedSettings->m_imageCacheFormat != CachedImageFormat::ORIGINAL ||
+         advancedSettings->m_fanartCacheFormat != CachedImageFormat::ORIGINAL;
+}
+
+std::string CTextureCache::GetPreDecodedPath(const std::string& cachedPath)
+{
+  // images used from elsewhere, e.g. the skin, have no copy of ours next to them
+  const std::shared_ptr<CProfileManager> profileManager =
+      CServiceBroker::GetSettingsComponent()->GetProfileManager();
+  if (!URIUtils::PathHasParent(cachedPath, profileManager->GetThumbnailsFolder(), true))
+    return {};
+
+  return URIUtils::ReplaceExtension(cachedPath, ".dds");
+}
+
+void CTextureCache::RecordLoad(bool preDecoded, std::chrono::microseconds duration)
+{
+  if (preDecoded)
+  {
+    m_preDecodedLoads++;
+    m_preDecodedLoadTime += duration.count();
+  }
+  else
+  {
+    m_decodedLoads++;
+    m_decodedLoadTime += duration.count();
+  }
+}
+
+CTextureCache::LoadStats CTextureCache::GetLoadStats() const
+{
+  LoadStats stats;
+  stats.preDecoded = m_preDecodedLoads;
+  stats.decoded = m_decodedLoads;
+  stats.preDecodedTime = std::chrono::microseconds(m_preDecodedLoadTime);
+  stats.decodedTime = std::chrono::microseconds(m_decodedLoadTime);
+  return stats;
+}
+
 void CTextureCache::OnCachingComplete(bool success, CTextureCacheJob *job)
 {
   if (success)
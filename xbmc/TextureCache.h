@@ -25,6 +25,7 @@
 #include <vector>
 
 class CGUIDialogProgress;
+enum class CachedImageFormat;
 class CJob;
 class CURL;
 class CTexture;
@@ -72,9 +73,11 @@ public:
    cache the image and add to the database [see CTextureCacheJob]
 
    \param image url of the image to cache
+   \param bulk whether the image is one of many cached at once, e.g. by a library scan, rather
+   than one shown in the GUI. Bulk caching runs on its own queue at a lower priority.
    \sa CacheImage
    */
-  void BackgroundCacheImage(const std::string &image);
+  void BackgroundCacheImage(const std::string& image, bool bulk = false);
 
   /*! \brief Updates the in-process list.
 
@@ -167,6 +170,39 @@ public:
 
   bool CleanAllUnusedImages();
 
+  /*! \brief How to store a cached image besides the original
+   Images of 16x9 are treated as fanart, as for their size, see CPicture::CacheTexture
+   \param width width of the cached image
+   \param height height of the cached image
+   \return format to store the image in, see advancedsettings.xml
+   */
+  static CachedImageFormat GetCachedImageFormat(unsigned int width, unsigned int height);
+
+  /*! \brief Whether cached images may have a pre-decoded .dds copy at all
+   */
+  static bool UsePreDecodedImages();
+
+  /*! \brief retrieve the full path of the pre-decoded copy of a cached image
+   \param cachedPath full path of the cached image
+   \return the path of the .dds copy, empty if cachedPath is not in the texture cache folder
+   */
+  static std::string GetPreDecodedPath(const std::string& cachedPath);
+
+  struct LoadStats
+  {
+    uint64_t preDecoded{0}; ///< images loaded from a .dds copy
+    uint64_t decoded{0}; ///< images decoded from jpg/png
+    std::chrono::microseconds preDecodedTime{0};
+    std::chrono::microseconds decodedTime{0};
+  };
+
+  /*! \brief Count a cached image loaded for the GUI
+   \param preDecoded whether it was loaded from a pre-decoded copy
+   \param duration time it took to load it
+   */
+  void RecordLoad(bool preDecoded, std::chrono::microseconds duration);
+  LoadStats GetLoadStats() const;
+
 private:
   // private construction, and no assignments; use the provided singleton methods
   CTextureCache(const CTextureCache&) = delete;
@@ -228,6 +264,18 @@ private:
    */
   void OnCachingComplete(bool success, CTextureCacheJob *job);
 
+  /*! \brief Queue for bulk caching, see BackgroundCacheImage()
+   */
+  class CBulkQueue : public CJobQueue
+  {
+  public:
+    explicit CBulkQueue(CTextureCache& cache);
+    void OnJobComplete(unsigned int jobID, bool success, CJob* job) override;
+
+  private:
+    CTextureCache& m_cache;
+  };
+
   void CleanTimer();
   std::chrono::milliseconds ScanOldestCache();
   bool CleanAllUnusedImagesJob(CGUIDialogProgress* progress);
@@ -241,5 +289,12 @@ private:
   CEvent               m_completeEvent; ///< Set whenever a job has finished
   std::vector<CTextureDetails> m_useCounts; ///< Use count tracking
   CCriticalSection             m_useCountSection;
+  CBulkQueue m_bulkQueue;
+  CCriticalSection m_queueSection; ///< checking both queues and adding a job is atomic
+
+  std::atomic<uint64_t> m_preDecodedLoads{0};
+  std::atomic<uint64_t> m_decodedLoads{0};
+  std::atomic<int64_t> m_preDecodedLoadTime{0}; ///< microseconds
+  std::atomic<int64_t> m_decodedLoadTime{0}; ///< microseconds
 };
 
@@ -16,6 +16,7 @@
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/audiodecoder.h"
 #include "commons/ilog.h"
 #include "filesystem/File.h"
+#include "guilib/DDSImage.h"
 #include "guilib/Texture.h"
 #include "imagefiles/ImageFileURL.h"
 #include "imagefiles/SpecialImageLoaderFactory.h"
@@ -26,6 +27,7 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
@@ -114,7 +116,13 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
     }
   }
 
-  std::unique_ptr<CTexture> texture = LoadImage(imageURL);
+  // the cached image is fitted into the fanart or image resolution, whichever is larger, so
+  // there is no need to decode more than that
+  const std::shared_ptr<CAdvancedSettings> advancedSettings =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  const unsigned int maxHeight = std::max(advancedSettings->m_imageRes, advancedSettings->m_fanartRes);
+
+  std::unique_ptr<CTexture> texture = LoadImage(imageURL, maxHeight * 16 / 9, maxHeight);
   if (texture)
   {
     if (texture->HasAlpha())
@@ -132,6 +140,10 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
     {
       m_details.width = cached_width;
       m_details.height = cached_height;
+      // unless it was scaled or rotated, the cached image has the pixels of the texture
+      const bool cachedAsIs = cached_width == texture->GetWidth() &&
+                              cached_height == texture->GetHeight() && !texture->GetOrientation();
+      CachePreDecoded(cachedAsIs ? texture.get() : nullptr);
       if (out_texture) // caller wants the texture
         *out_texture = std::move(texture);
       return true;
@@ -140,6 +152,45 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
   return false;
 }
 
+void CTextureCacheJob::CachePreDecoded(const CTexture* texture) const
+{
+  const std::string cachedPath = CTextureCache::GetCachedPath(m_details.file);
+  const std::string preDecodedPath = CTextureCache::GetPreDecodedPath(cachedPath);
+
+  const CachedImageFormat format =
+      CTextureCache::GetCachedImageFormat(m_details.width, m_details.height);
+  if (format == CachedImageFormat::ORIGINAL)
+  {
+    // left over from an earlier setting or version of the image
+    if (XFILE::CFile::Exists(preDecodedPath))
+      XFILE::CFile::Delete(preDecodedPath);
+    return;
+  }
+
+  std::unique_ptr<CTexture> cachedTexture;
+  if (!texture)
+  {
+    cachedTexture = CTexture::LoadFromFile(cachedPath);
+    texture = cachedTexture.get();
+  }
+
+  XB_FMT ddsFormat = XB_FMT_A8R8G8B8;
+  if (format == CachedImageFormat::COMPRESSED)
+    ddsFormat = texture && texture->HasAlpha() ? XB_FMT_DXT5 : XB_FMT_DXT1;
+
+  CDDSImage image;
+  if (!texture || !texture->GetPixels() ||
+      !image.Create(texture->GetWidth(), texture->GetHeight(), texture->GetPitch(),
+                    texture->GetPixels(), ddsFormat) ||
+      !image.WriteFile(preDecodedPath))
+  {
+    CLog::Log(LOGWARNING, "{} - failed to store pre-decoded image '{}'", __FUNCTION__,
+              preDecodedPath);
+    if (XFILE::CFile::Exists(preDecodedPath))
+      XFILE::CFile::Delete(preDecodedPath);
+  }
+}
+
 bool CTextureCacheJob::ResizeTexture(const std::string& url,
                                      unsigned int height,
                                      unsigned int width,
@@ -155,7 +206,7 @@ bool CTextureCacheJob::ResizeTexture(const std::string& url,
   if (image.empty())
     return false;
 
-  std::unique_ptr<CTexture> texture = LoadImage(imageURL);
+  std::unique_ptr<CTexture> texture = LoadImage(imageURL, width, height);
   if (texture == NULL)
     return false;
 
@@ -165,7 +216,9 @@ bool CTextureCacheJob::ResizeTexture(const std::string& url,
   return success;
 }
 
-std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageFileURL& imageURL)
+std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageFileURL& imageURL,
+                                                      unsigned int width /* = 0 */,
+                                                      unsigned int height /* = 0 */)
 {
   if (imageURL.IsSpecialImage())
   {
@@ -186,8 +239,9 @@ std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageF
     return {};
   }
 
+  // the image keeps its own size, it's only fitted into width x height afterwards
   auto texture = CTexture::LoadFromFile(imageURL.GetTargetFile(), 0, 0, CAspectRatio::CENTER,
-                                        file.GetMimeType());
+                                        file.GetMimeType(), width, height);
   if (!texture)
     return {};
 
@@ -94,9 +94,19 @@ private:
    or smaller than the desired size for speed reasons.
 
    \param image the URL of the image file.
+   \param width,height the size the image is fitted into afterwards, 0 for no limit. The decoder
+   may scale the image down to no less than that.
    \return a pointer to a CTexture object, NULL if failed.
    */
-  static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL);
+  static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL,
+                                             unsigned int width = 0,
+                                             unsigned int height = 0);
+
+  /*! \brief Store a pre-decoded copy of the cached image next to it, if configured
+   \param texture the image as cached, if its pixels are at hand, otherwise it is read back
+   \sa CTextureCache::GetCachedImageFormat
+   */
+  void CachePreDecoded(const CTexture* texture) const;
 
   std::string    m_cachePath;
 };
@@ -12,6 +12,7 @@
 #include "FileItemList.h"
 #include "ServiceBroker.h"
 #include "Util.h"
+#include "addons/AddonVersion.h"
 #include "addons/addoninfo/AddonType.h"
 #include "dialogs/GUIDialogKaiToast.h"
 #include "filesystem/Directory.h"
@@ -24,6 +25,7 @@
 #include "messaging/helpers/DialogHelper.h"
 #include "resources/LocalizeStrings.h"
 #include "resources/ResourcesComponent.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "settings/lib/Setting.h"
@@ -298,6 +300,11 @@ void CSkinInfo::LoadIncludes()
       CSpecialProtocol::TranslatePathConvertCase(GetSkinPath("Includes.xml"));
   CLog::Log(LOGINFO, "Loading skin includes from {}", includesPath);
   m_includes.Clear();
+
+  const auto settings = CServiceBroker::GetSettingsComponent();
+  if (settings && settings->GetAdvancedSettings()->m_guiSkinCache)
+    m_includes.EnableCache(ID(), Version().asString());
+
   m_includes.Load(includesPath);
 }
 
@@ -324,6 +331,19 @@ void CSkinInfo::ResolveIncludes(TiXmlElement* node,
   m_includes.Resolve(node, xmlIncludeConditions);
 }
 
+std::unique_ptr<TiXmlElement> CSkinInfo::GetCachedWindow(
+    const std::string& file, std::map<INFO::InfoPtr, bool>& xmlIncludeConditions)
+{
+  return m_includes.GetCachedDocument(file, xmlIncludeConditions);
+}
+
+void CSkinInfo::CacheWindow(const std::string& file,
+                            const TiXmlElement& node,
+                            const std::map<INFO::InfoPtr, bool>& xmlIncludeConditions)
+{
+  m_includes.CacheDocument(file, node, xmlIncludeConditions);
+}
+
 int CSkinInfo::GetStartWindow() const
 {
   int windowID = CServiceBroker::GetSettingsComponent()->GetSettings()->GetInt(CSettings::SETTING_LOOKANDFEEL_STARTUPWINDOW);
@@ -166,6 +166,24 @@ public:
   void ResolveIncludes(TiXmlElement* node,
                        std::map<INFO::InfoPtr, bool>* xmlIncludeConditions = nullptr);
 
+  /*! \brief Get a window resolved by ResolveIncludes() in this or a previous run, if cached
+   \param file the file of the window
+   \param xmlIncludeConditions [out] the conditions of the resolved includes
+   \return the resolved window, nullptr if not cached
+   \sa CGUIIncludes::GetCachedDocument
+   */
+  std::unique_ptr<TiXmlElement> GetCachedWindow(
+      const std::string& file, std::map<INFO::InfoPtr, bool>& xmlIncludeConditions);
+
+  /*! \brief Cache a window resolved by ResolveIncludes(), if the skin cache is enabled
+   \param file the file of the window
+   \param node the resolved window
+   \param xmlIncludeConditions the conditions of the resolved includes
+   */
+  void CacheWindow(const std::string& file,
+                   const TiXmlElement& node,
+                   const std::map<INFO::InfoPtr, bool>& xmlIncludeConditions);
+
   float GetEffectsSlowdown() const { return m_effectsSlowDown; }
 
   const std::vector<CStartupWindow>& GetStartupWindows() const { return m_startupWindows; }
@@ -15,6 +15,7 @@
 #include "cores/AudioEngine/AEResampleFactory.h"
 #include "cores/AudioEngine/Encoders/AEEncoderFFmpeg.h"
 #include "cores/AudioEngine/Interfaces/IAudioCallback.h"
+#include "cores/AudioEngine/Utils/AEMixKernels.h"
 #include "cores/AudioEngine/Utils/AEStreamData.h"
 #include "cores/AudioEngine/Utils/AEStreamInfo.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
@@ -2175,38 +2176,20 @@ bool CActiveAE::RunStages()
               nb_loops = out->pkt->nb_samples;
             }
 
-            for(int i=0; i<nb_loops; i++)
+            const CAEMixKernels& kernels = CAEMixKernels::Get();
+            if (nb_loops > 1)
+            {
+              const float* gains =
+                  CalcFrameGains(*it, out->pkt.get(), nb_loops, nb_floats, fadingStep);
+              for (int j = 0; j < out->pkt->planes; j++)
+                kernels.MulFrames((float*)out->pkt->data[j], gains, nb_loops, nb_floats);
+            }
+            else
             {
-              if ((*it)->m_fadingSamples > 0)
-              {
-                (*it)->m_volume += fadingStep;
-                (*it)->m_fadingSamples--;
-
-                if ((*it)->m_fadingSamples == 0)
-                {
-                  // set variables being polled via stream interface
-                  std::unique_lock lock((*it)->m_streamLock);
-                  (*it)->m_streamFading = false;
-                }
-              }
-
               // volume for stream
               float volume = (*it)->m_volume * (*it)->m_rgain;
-              if(nb_loops > 1)
-                volume *= (*it)->m_limiter.Run((float**)out->pkt->data, out->pkt->config.channels, i*nb_floats, out->pkt->planes > 1);
-
-              for(int j=0; j<out->pkt->planes; j++)
-              {
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
-#else
-                float* fbuffer = (float*) out->pkt->data[j]+i*nb_floats;
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  fbuffer[k] *= volume;
-                }
-#endif
-              }
+              for (int j = 0; j < out->pkt->planes; j++)
+                kernels.MulArray((float*)out->pkt->data[j], volume, nb_floats);
             }
           }
           else
@@ -2242,48 +2225,29 @@ bool CActiveAE::RunStages()
               nb_loops = out->pkt->nb_samples;
             }
 
-            for(int i=0; i<nb_loops; i++)
+            const CAEMixKernels& kernels = CAEMixKernels::Get();
+            if (nb_loops > 1)
             {
-              if ((*it)->m_fadingSamples > 0)
+              const float* gains =
+                  CalcFrameGains(*it, mix->pkt.get(), nb_loops, nb_floats, fadingStep);
+              for (int j = 0; j < out->pkt->planes && j < mix->pkt->planes; j++)
               {
-                (*it)->m_volume += fadingStep;
-                (*it)->m_fadingSamples--;
-
-                if ((*it)->m_fadingSamples == 0)
-                {
-                  // set variables being polled via stream interface
-                  std::unique_lock lock((*it)->m_streamLock);
-                  (*it)->m_streamFading = false;
-                }
+                float* dst = (float*)out->pkt->data[j];
+                float* src = (float*)mix->pkt->data[j];
+                if (kernels.MulAddFrames(dst, src, gains, nb_loops, nb_floats))
+                  needClamp = true;
               }
-
+            }
+            else
+            {
               // volume for stream
               float volume = (*it)->m_volume * (*it)->m_rgain;
-              if(nb_loops > 1)
-                volume *= (*it)->m_limiter.Run((float**)mix->pkt->data, mix->pkt->config.channels, i*nb_floats, mix->pkt->planes > 1);
-
-              for(int j=0; j<out->pkt->planes && j<mix->pkt->planes; j++)
+              for (int j = 0; j < out->pkt->planes && j < mix->pkt->planes; j++)
               {
-                float *dst = (float*)out->pkt->data[j]+i*nb_floats;
-                float *src = (float*)mix->pkt->data[j]+i*nb_floats;
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulAddArray(dst, src, volume, nb_floats);
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  if (fabs(dst[k]) > 1.0f)
-                  {
-                    needClamp = true;
-                    break;
-                  }
-                }
-#else
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  dst[k] += src[k] * volume;
-                  if (fabs(dst[k]) > 1.0f)
-                    needClamp = true;
-                }
-#endif
+                float* dst = (float*)out->pkt->data[j];
+                float* src = (float*)mix->pkt->data[j];
+                if (kernels.MulAddArray(dst, src, volume, nb_floats))
+                  needClamp = true;
               }
             }
             mix->Return();
@@ -2298,7 +2262,7 @@ bool CActiveAE::RunStages()
         int nb_floats = out->pkt->nb_samples * out->pkt->config.channels / out->pkt->planes;
         for (int i=0; i<out->pkt->planes; i++)
         {
-          CAEUtil::ClampArray((float*)out->pkt->data[i], nb_floats);
+          CAEMixKernels::Get().ClampArray((float*)out->pkt->data[i], nb_floats);
         }
       }
 
@@ -2672,12 +2636,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
       out = (float*)dstSample.data[j];
       sample_buffer = (float*)(it->sound->GetSound(false)->data[j]+start);
       int nb_floats = mix_samples * dstSample.config.channels / dstSample.planes;
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulAddArray(out, sample_buffer, volume, nb_floats);
-#else
-      for (int k = 0; k < nb_floats; ++k)
-        *out++ += *sample_buffer++ * volume;
-#endif
+      CAEMixKernels::Get().MulAddArray(out, sample_buffer, volume, nb_floats);
     }
 
     it->samples_played += mix_samples;
@@ -2692,6 +2651,36 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
   }
 }
 
+const float* CActiveAE::CalcFrameGains(
+    CActiveAEStream* stream, CSoundPacket* pkt, int frames, int stride, float fadingStep)
+{
+  if (m_frameGains.size() < static_cast<size_t>(frames))
+    m_frameGains.resize(frames);
+
+  for (int i = 0; i < frames; i++)
+  {
+    if (stream->m_fadingSamples > 0)
+    {
+      stream->m_volume += fadingStep;
+      stream->m_fadingSamples--;
+
+      if (stream->m_fadingSamples == 0)
+      {
+        // set variables being polled via stream interface
+        std::unique_lock lock(stream->m_streamLock);
+        stream->m_streamFading = false;
+      }
+    }
+
+    // volume for stream, the limiter looks at the unscaled frame
+    m_frameGains[i] = stream->m_volume * stream->m_rgain *
+                      stream->m_limiter.Run((float**)pkt->data, pkt->config.channels, i * stride,
+                                            pkt->planes > 1);
+  }
+
+  return m_frameGains.data();
+}
+
 void CActiveAE::Deamplify(CSoundPacket &dstSample)
 {
   if (m_volumeScaled < 1.0f || m_muted)
@@ -2702,13 +2691,7 @@ void CActiveAE::Deamplify(CSoundPacket &dstSample)
     for(int j=0; j<dstSample.planes; j++)
     {
       float* buffer = reinterpret_cast<float*>(dstSample.data[j]);
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulArray(buffer, volume, nb_floats);
-#else
-      float *fbuffer = buffer;
-      for (int i = 0; i < nb_floats; i++)
-        *fbuffer++ *= volume;
-#endif
+      CAEMixKernels::Get().MulArray(buffer, volume, nb_floats);
     }
   }
 }
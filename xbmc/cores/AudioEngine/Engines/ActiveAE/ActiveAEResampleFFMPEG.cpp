@@ -6,6 +6,7 @@
  *  See LICENSES/README.md for more information.
  */
 
+#include "cores/AudioEngine/Utils/AEMixKernels.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
 #include "ActiveAEResampleFFMPEG.h"
 #include "utils/log.h"
@@ -18,10 +19,25 @@ extern "C" {
 
 using namespace ActiveAE;
 
+namespace
+{
+bool IsKernelConversion(AVSampleFormat src, AVSampleFormat dst)
+{
+  src = av_get_packed_sample_fmt(src);
+  dst = av_get_packed_sample_fmt(dst);
+  if (dst == AV_SAMPLE_FMT_FLT)
+    return src == AV_SAMPLE_FMT_S16 || src == AV_SAMPLE_FMT_S32;
+  if (src == AV_SAMPLE_FMT_FLT)
+    return dst == AV_SAMPLE_FMT_S16 || dst == AV_SAMPLE_FMT_S32;
+  return false;
+}
+} // namespace
+
 CActiveAEResampleFFMPEG::CActiveAEResampleFFMPEG()
 {
   m_pContext = NULL;
   m_doesResample = false;
+  m_convertOnly = false;
 }
 
 CActiveAEResampleFFMPEG::~CActiveAEResampleFFMPEG()
@@ -191,9 +207,53 @@ bool CActiveAEResampleFFMPEG::Init(SampleConfig dstConfig,
     CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Init - init resampler failed");
     return false;
   }
+
+  // channels stay as they are, e.g. float from the engine to S16 or S32 of the sink
+  m_convertOnly =
+      !m_doesResample && m_src_channels == m_dst_channels &&
+      av_sample_fmt_is_planar(m_src_fmt) == av_sample_fmt_is_planar(m_dst_fmt) &&
+      IsKernelConversion(m_src_fmt, m_dst_fmt) &&
+      (hasMatrix ? IsIdentityMatrix() : m_src_chan_layout == m_dst_chan_layout);
   return true;
 }
 
+bool CActiveAEResampleFFMPEG::IsIdentityMatrix() const
+{
+  for (int out = 0; out < m_dst_channels; out++)
+  {
+    for (int in = 0; in < m_src_channels; in++)
+    {
+      if (m_rematrix[out][in] != (out == in ? 1.0 : 0.0))
+        return false;
+    }
+  }
+  return true;
+}
+
+void CActiveAEResampleFFMPEG::ConvertFormat(uint8_t** dst_buffer, uint8_t** src_buffer, int samples)
+{
+  const CAEMixKernels& kernels = CAEMixKernels::Get();
+  const int planes = av_sample_fmt_is_planar(m_src_fmt) ? m_src_channels : 1;
+  const uint32_t count = samples * m_src_channels / planes;
+  const AVSampleFormat srcFmt = av_get_packed_sample_fmt(m_src_fmt);
+  const AVSampleFormat dstFmt = av_get_packed_sample_fmt(m_dst_fmt);
+  for (int i = 0; i < planes; i++)
+  {
+    if (srcFmt == AV_SAMPLE_FMT_S16)
+      kernels.S16ToFloat(reinterpret_cast<const int16_t*>(src_buffer[i]),
+                         reinterpret_cast<float*>(dst_buffer[i]), count);
+    else if (srcFmt == AV_SAMPLE_FMT_S32)
+      kernels.S32ToFloat(reinterpret_cast<const int32_t*>(src_buffer[i]),
+                         reinterpret_cast<float*>(dst_buffer[i]), count);
+    else if (dstFmt == AV_SAMPLE_FMT_S16)
+      kernels.FloatToS16(reinterpret_cast<const float*>(src_buffer[i]),
+                         reinterpret_cast<int16_t*>(dst_buffer[i]), count);
+    else
+      kernels.FloatToS32(reinterpret_cast<const float*>(src_buffer[i]),
+                         reinterpret_cast<int32_t*>(dst_buffer[i]), count);
+  }
+}
+
 int CActiveAEResampleFFMPEG::Resample(uint8_t **dst_buffer, int dst_samples, uint8_t **src_buffer, int src_samples, double ratio)
 {
   int delta = 0;
@@ -205,21 +265,33 @@ int CActiveAEResampleFFMPEG::Resample(uint8_t **dst_buffer, int dst_samples, uin
     m_doesResample = true;
   }
 
-  if (m_doesResample)
+  int ret;
+  if (m_convertOnly && !m_doesResample && src_buffer && dst_samples >= src_samples)
+  {
+    ConvertFormat(dst_buffer, src_buffer, src_samples);
+    ret = src_samples;
+  }
+  else
   {
-    if (swr_set_compensation(m_pContext, delta, distance) < 0)
+    // swresample may hold back samples from now on, they must not be overtaken
+    m_convertOnly = false;
+
+    if (m_doesResample)
     {
-      CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Resample - set compensation failed");
-      return -1;
+      if (swr_set_compensation(m_pContext, delta, distance) < 0)
+      {
+        CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Resample - set compensation failed");
+        return -1;
+      }
     }
-  }
 
-  //! @bug libavresample isn't const correct
-  int ret = swr_convert(m_pContext, dst_buffer, dst_samples, const_cast<const uint8_t**>(src_buffer), src_samples);
-  if (ret < 0)
-  {
-    CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Resample - resample failed");
-    return -1;
+    //! @bug libavresample isn't const correct
+    ret = swr_convert(m_pContext, dst_buffer, dst_samples, const_cast<const uint8_t**>(src_buffer), src_samples);
+    if (ret < 0)
+    {
+      CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Resample - resample failed");
+      return -1;
+    }
   }
 
   // special handling for S24 formats which are carried in S32
@@ -261,15 +333,9 @@ int CActiveAEResampleFFMPEG::Resample(uint8_t **dst_buffer, int dst_samples, uin
     {
       int planes = av_sample_fmt_is_planar(m_dst_fmt) ? m_dst_channels : 1;
       int samples = ret * m_dst_channels / planes;
+      const unsigned int shift = 32 - m_dst_bits - m_dst_dither_bits;
       for (int i=0; i<planes; i++)
-      {
-        uint32_t* buf = (uint32_t*)dst_buffer[i];
-        for (int j=0; j<samples; j++)
-        {
-          *buf = *buf >> (32 - m_dst_bits - m_dst_dither_bits);
-          buf++;
-        }
-      }
+        CAEMixKernels::Get().ShiftRightS32((uint32_t*)dst_buffer[i], shift, samples);
     }
   }
   return ret;
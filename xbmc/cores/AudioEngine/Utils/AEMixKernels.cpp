@@ -0,0 +1,583 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEMixKernels.h"
+
+#include "ServiceBroker.h"
+#include "utils/CPUInfo.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <math.h>
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#define AE_MIX_KERNELS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(HAS_NEON) && defined(__ARM_NEON)
+#define AE_MIX_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+constexpr float S16_SCALE = 32768.0f;
+constexpr float S32_SCALE = 2147483648.0f;
+// largest float below 1.0, keeps converted samples within the range of int32
+constexpr float S32_MAX_FLOAT = 0.99999994f;
+
+// tanh like soft clipper, rational function based on the pade-approximation of tanh
+// See: http://www.musicdsp.org/showone.php?id=238
+inline float SoftClamp(float x)
+{
+  if (x < -3.0f)
+    return -1.0f;
+  else if (x > 3.0f)
+    return 1.0f;
+  const float y = x * x;
+  return x * (27.0f + y) / (27.0f + 9.0f * y);
+}
+
+//------------------------------------------------------------------------------
+// scalar
+//------------------------------------------------------------------------------
+
+void MulArrayC(float* data, float mul, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] *= mul;
+}
+
+bool MulAddArrayC(float* dst, const float* src, float mul, uint32_t count)
+{
+  bool needClamp = false;
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    dst[i] += src[i] * mul;
+    if (fabsf(dst[i]) > 1.0f)
+      needClamp = true;
+  }
+  return needClamp;
+}
+
+void MulFramesC(float* data, const float* gains, uint32_t frames, uint32_t stride)
+{
+  for (uint32_t f = 0; f < frames; ++f, data += stride)
+    MulArrayC(data, gains[f], stride);
+}
+
+bool MulAddFramesC(
+    float* dst, const float* src, const float* gains, uint32_t frames, uint32_t stride)
+{
+  bool needClamp = false;
+  for (uint32_t f = 0; f < frames; ++f, dst += stride, src += stride)
+    needClamp |= MulAddArrayC(dst, src, gains[f], stride);
+  return needClamp;
+}
+
+void ClampArrayC(float* data, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] = SoftClamp(data[i]);
+}
+
+void S16ToFloatC(const int16_t* src, float* dst, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    dst[i] = static_cast<float>(src[i]) * (1.0f / S16_SCALE);
+}
+
+void FloatToS16C(const float* src, int16_t* dst, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const float sample = std::clamp(src[i] * S16_SCALE, -S16_SCALE, S16_SCALE - 1.0f);
+    dst[i] = static_cast<int16_t>(lrintf(sample));
+  }
+}
+
+void S32ToFloatC(const int32_t* src, float* dst, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    dst[i] = static_cast<float>(src[i]) * (1.0f / S32_SCALE);
+}
+
+void FloatToS32C(const float* src, int32_t* dst, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const float sample = std::clamp(src[i], -1.0f, S32_MAX_FLOAT) * S32_SCALE;
+    dst[i] = static_cast<int32_t>(lrintf(sample));
+  }
+}
+
+void ShiftRightS32C(uint32_t* data, unsigned int shift, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] >>= shift;
+}
+
+const CAEMixKernels scalarKernels = {
+    MulArrayC,   MulAddArrayC, MulFramesC,  MulAddFramesC,  ClampArrayC,
+    S16ToFloatC, FloatToS16C,  S32ToFloatC, FloatToS32C,    ShiftRightS32C,
+    CAEMixKernels::Isa::SCALAR, "scalar",
+};
+
+//------------------------------------------------------------------------------
+// SSE2
+//------------------------------------------------------------------------------
+
+#if defined(AE_MIX_KERNELS_SSE2)
+inline bool AnyAboveOne(__m128 peak)
+{
+  return _mm_movemask_ps(_mm_cmpgt_ps(peak, _mm_set1_ps(1.0f))) != 0;
+}
+
+inline __m128 Abs(__m128 v)
+{
+  return _mm_and_ps(v, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+}
+
+void MulArraySSE2(float* data, float mul, uint32_t count)
+{
+  const __m128 m = _mm_set1_ps(mul);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    _mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), m));
+
+  MulArrayC(data + i, mul, count - i);
+}
+
+bool MulAddArraySSE2(float* dst, const float* src, float mul, uint32_t count)
+{
+  const __m128 m = _mm_set1_ps(mul);
+  __m128 peak = _mm_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 out = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), m));
+    _mm_storeu_ps(dst + i, out);
+    peak = _mm_max_ps(peak, Abs(out));
+  }
+
+  const bool needClamp = MulAddArrayC(dst + i, src + i, mul, count - i);
+  return AnyAboveOne(peak) || needClamp;
+}
+
+void MulFramesSSE2(float* data, const float* gains, uint32_t frames, uint32_t stride)
+{
+  uint32_t f = 0;
+  if (stride == 1)
+  {
+    for (; f + 4 <= frames; f += 4, data += 4)
+      _mm_storeu_ps(data, _mm_mul_ps(_mm_loadu_ps(data), _mm_loadu_ps(gains + f)));
+  }
+  else if (stride == 2)
+  {
+    for (; f + 2 <= frames; f += 2, data += 4)
+    {
+      const __m128 g = _mm_setr_ps(gains[f], gains[f], gains[f + 1], gains[f + 1]);
+      _mm_storeu_ps(data, _mm_mul_ps(_mm_loadu_ps(data), g));
+    }
+  }
+  else
+  {
+    for (; f < frames; ++f, data += stride)
+      MulArraySSE2(data, gains[f], stride);
+  }
+
+  MulFramesC(data, gains + f, frames - f, stride);
+}
+
+bool MulAddFramesSSE2(
+    float* dst, const float* src, const float* gains, uint32_t frames, uint32_t stride)
+{
+  __m128 peak = _mm_setzero_ps();
+  bool needClamp = false;
+  uint32_t f = 0;
+  if (stride == 1)
+  {
+    for (; f + 4 <= frames; f += 4, dst += 4, src += 4)
+    {
+      const __m128 out =
+          _mm_add_ps(_mm_loadu_ps(dst), _mm_mul_ps(_mm_loadu_ps(src), _mm_loadu_ps(gains + f)));
+      _mm_storeu_ps(dst, out);
+      peak = _mm_max_ps(peak, Abs(out));
+    }
+  }
+  else if (stride == 2)
+  {
+    for (; f + 2 <= frames; f += 2, dst += 4, src += 4)
+    {
+      const __m128 g = _mm_setr_ps(gains[f], gains[f], gains[f + 1], gains[f + 1]);
+      const __m128 out = _mm_add_ps(_mm_loadu_ps(dst), _mm_mul_ps(_mm_loadu_ps(src), g));
+      _mm_storeu_ps(dst, out);
+      peak = _mm_max_ps(peak, Abs(out));
+    }
+  }
+  else
+  {
+    for (; f < frames; ++f, dst += stride, src += stride)
+      needClamp |= MulAddArraySSE2(dst, src, gains[f], stride);
+  }
+
+  needClamp |= MulAddFramesC(dst, src, gains + f, frames - f, stride);
+  return AnyAboveOne(peak) || needClamp;
+}
+
+void ClampArraySSE2(float* data, uint32_t count)
+{
+  const __m128 c27 = _mm_set1_ps(27.0f);
+  const __m128 c9 = _mm_set1_ps(9.0f);
+  const __m128 lo = _mm_set1_ps(-3.0f);
+  const __m128 hi = _mm_set1_ps(3.0f);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    // the approximation reaches exactly +-1 at +-3
+    const __m128 x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(data + i), lo), hi);
+    const __m128 y = _mm_mul_ps(x, x);
+    const __m128 num = _mm_mul_ps(x, _mm_add_ps(c27, y));
+    const __m128 den = _mm_add_ps(c27, _mm_mul_ps(c9, y));
+    _mm_storeu_ps(data + i, _mm_div_ps(num, den));
+  }
+
+  ClampArrayC(data + i, count - i);
+}
+
+void S16ToFloatSSE2(const int16_t* src, float* dst, uint32_t count)
+{
+  const __m128 scale = _mm_set1_ps(1.0f / S16_SCALE);
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    // sign extend by moving the samples into the upper half of each 32 bit lane
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+    _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+  }
+
+  S16ToFloatC(src + i, dst + i, count - i);
+}
+
+void FloatToS16SSE2(const float* src, int16_t* dst, uint32_t count)
+{
+  const __m128 scale = _mm_set1_ps(S16_SCALE);
+  const __m128 lo = _mm_set1_ps(-S16_SCALE);
+  const __m128 hi = _mm_set1_ps(S16_SCALE - 1.0f);
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128 a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale), lo), hi);
+    const __m128 b =
+        _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale), lo), hi);
+    const __m128i out = _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+  }
+
+  FloatToS16C(src + i, dst + i, count - i);
+}
+
+void S32ToFloatSSE2(const int32_t* src, float* dst, uint32_t count)
+{
+  const __m128 scale = _mm_set1_ps(1.0f / S32_SCALE);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(in), scale));
+  }
+
+  S32ToFloatC(src + i, dst + i, count - i);
+}
+
+void FloatToS32SSE2(const float* src, int32_t* dst, uint32_t count)
+{
+  const __m128 scale = _mm_set1_ps(S32_SCALE);
+  const __m128 lo = _mm_set1_ps(-1.0f);
+  const __m128 hi = _mm_set1_ps(S32_MAX_FLOAT);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 in = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), lo), hi);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_cvtps_epi32(_mm_mul_ps(in, scale)));
+  }
+
+  FloatToS32C(src + i, dst + i, count - i);
+}
+
+void ShiftRightS32SSE2(uint32_t* data, unsigned int shift, uint32_t count)
+{
+  const __m128i s = _mm_cvtsi32_si128(static_cast<int>(shift));
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i* p = reinterpret_cast<__m128i*>(data + i);
+    _mm_storeu_si128(p, _mm_srl_epi32(_mm_loadu_si128(p), s));
+  }
+
+  ShiftRightS32C(data + i, shift, count - i);
+}
+
+const CAEMixKernels sse2Kernels = {
+    MulArraySSE2,   MulAddArraySSE2, MulFramesSSE2,  MulAddFramesSSE2,  ClampArraySSE2,
+    S16ToFloatSSE2, FloatToS16SSE2,  S32ToFloatSSE2, FloatToS32SSE2,    ShiftRightS32SSE2,
+    CAEMixKernels::Isa::SSE2, "SSE2",
+};
+#endif
+
+//------------------------------------------------------------------------------
+// NEON
+//------------------------------------------------------------------------------
+
+#if defined(AE_MIX_KERNELS_NEON)
+inline bool AnyAboveOne(float32x4_t peak)
+{
+  float32x2_t m = vpmax_f32(vget_low_f32(peak), vget_high_f32(peak));
+  m = vpmax_f32(m, m);
+  return vget_lane_f32(m, 0) > 1.0f;
+}
+
+// round to nearest, armv7 only converts towards zero
+inline int32x4_t ToInt(float32x4_t v)
+{
+#if defined(__aarch64__)
+  return vcvtnq_s32_f32(v);
+#else
+  const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x80000000));
+  const float32x4_t half =
+      vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(vdupq_n_f32(0.5f)), sign));
+  return vcvtq_s32_f32(vaddq_f32(v, half));
+#endif
+}
+
+void MulArrayNEON(float* data, float mul, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(data + i, vmulq_n_f32(vld1q_f32(data + i), mul));
+
+  MulArrayC(data + i, mul, count - i);
+}
+
+bool MulAddArrayNEON(float* dst, const float* src, float mul, uint32_t count)
+{
+  float32x4_t peak = vdupq_n_f32(0.0f);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t out = vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(src + i), mul);
+    vst1q_f32(dst + i, out);
+    peak = vmaxq_f32(peak, vabsq_f32(out));
+  }
+
+  const bool needClamp = MulAddArrayC(dst + i, src + i, mul, count - i);
+  return AnyAboveOne(peak) || needClamp;
+}
+
+void MulFramesNEON(float* data, const float* gains, uint32_t frames, uint32_t stride)
+{
+  uint32_t f = 0;
+  if (stride == 1)
+  {
+    for (; f + 4 <= frames; f += 4, data += 4)
+      vst1q_f32(data, vmulq_f32(vld1q_f32(data), vld1q_f32(gains + f)));
+  }
+  else if (stride == 2)
+  {
+    for (; f + 2 <= frames; f += 2, data += 4)
+    {
+      const float32x4_t g = vcombine_f32(vdup_n_f32(gains[f]), vdup_n_f32(gains[f + 1]));
+      vst1q_f32(data, vmulq_f32(vld1q_f32(data), g));
+    }
+  }
+  else
+  {
+    for (; f < frames; ++f, data += stride)
+      MulArrayNEON(data, gains[f], stride);
+  }
+
+  MulFramesC(data, gains + f, frames - f, stride);
+}
+
+bool MulAddFramesNEON(
+    float* dst, const float* src, const float* gains, uint32_t frames, uint32_t stride)
+{
+  float32x4_t peak = vdupq_n_f32(0.0f);
+  bool needClamp = false;
+  uint32_t f = 0;
+  if (stride == 1)
+  {
+    for (; f + 4 <= frames; f += 4, dst += 4, src += 4)
+    {
+      const float32x4_t out = vmlaq_f32(vld1q_f32(dst), vld1q_f32(src), vld1q_f32(gains + f));
+      vst1q_f32(dst, out);
+      peak = vmaxq_f32(peak, vabsq_f32(out));
+    }
+  }
+  else if (stride == 2)
+  {
+    for (; f + 2 <= frames; f += 2, dst += 4, src += 4)
+    {
+      const float32x4_t g = vcombine_f32(vdup_n_f32(gains[f]), vdup_n_f32(gains[f + 1]));
+      const float32x4_t out = vmlaq_f32(vld1q_f32(dst), vld1q_f32(src), g);
+      vst1q_f32(dst, out);
+      peak = vmaxq_f32(peak, vabsq_f32(out));
+    }
+  }
+  else
+  {
+    for (; f < frames; ++f, dst += stride, src += stride)
+      needClamp |= MulAddArrayNEON(dst, src, gains[f], stride);
+  }
+
+  needClamp |= MulAddFramesC(dst, src, gains + f, frames - f, stride);
+  return AnyAboveOne(peak) || needClamp;
+}
+
+void ClampArrayNEON(float* data, uint32_t count)
+{
+  const float32x4_t c27 = vdupq_n_f32(27.0f);
+  const float32x4_t lo = vdupq_n_f32(-3.0f);
+  const float32x4_t hi = vdupq_n_f32(3.0f);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t x = vminq_f32(vmaxq_f32(vld1q_f32(data + i), lo), hi);
+    const float32x4_t y = vmulq_f32(x, x);
+    const float32x4_t num = vmulq_f32(x, vaddq_f32(c27, y));
+    const float32x4_t den = vmlaq_n_f32(c27, y, 9.0f);
+#if defined(__aarch64__)
+    vst1q_f32(data + i, vdivq_f32(num, den));
+#else
+    // no division on armv7, refine the reciprocal estimate twice
+    float32x4_t rcp = vrecpeq_f32(den);
+    rcp = vmulq_f32(vrecpsq_f32(den, rcp), rcp);
+    rcp = vmulq_f32(vrecpsq_f32(den, rcp), rcp);
+    vst1q_f32(data + i, vmulq_f32(num, rcp));
+#endif
+  }
+
+  ClampArrayC(data + i, count - i);
+}
+
+void S16ToFloatNEON(const int16_t* src, float* dst, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t in = vcvtq_f32_s32(vmovl_s16(vld1_s16(src + i)));
+    vst1q_f32(dst + i, vmulq_n_f32(in, 1.0f / S16_SCALE));
+  }
+
+  S16ToFloatC(src + i, dst + i, count - i);
+}
+
+void FloatToS16NEON(const float* src, int16_t* dst, uint32_t count)
+{
+  const float32x4_t lo = vdupq_n_f32(-S16_SCALE);
+  const float32x4_t hi = vdupq_n_f32(S16_SCALE - 1.0f);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t in =
+        vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(src + i), S16_SCALE), lo), hi);
+    vst1_s16(dst + i, vqmovn_s32(ToInt(in)));
+  }
+
+  FloatToS16C(src + i, dst + i, count - i);
+}
+
+void S32ToFloatNEON(const int32_t* src, float* dst, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(src + i)), 1.0f / S32_SCALE));
+
+  S32ToFloatC(src + i, dst + i, count - i);
+}
+
+void FloatToS32NEON(const float* src, int32_t* dst, uint32_t count)
+{
+  const float32x4_t lo = vdupq_n_f32(-1.0f);
+  const float32x4_t hi = vdupq_n_f32(S32_MAX_FLOAT);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t in = vminq_f32(vmaxq_f32(vld1q_f32(src + i), lo), hi);
+    vst1q_s32(dst + i, ToInt(vmulq_n_f32(in, S32_SCALE)));
+  }
+
+  FloatToS32C(src + i, dst + i, count - i);
+}
+
+void ShiftRightS32NEON(uint32_t* data, unsigned int shift, uint32_t count)
+{
+  const int32x4_t s = vdupq_n_s32(-static_cast<int32_t>(shift));
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    vst1q_u32(data + i, vshlq_u32(vld1q_u32(data + i), s));
+
+  ShiftRightS32C(data + i, shift, count - i);
+}
+
+const CAEMixKernels neonKernels = {
+    MulArrayNEON,   MulAddArrayNEON, MulFramesNEON,  MulAddFramesNEON,  ClampArrayNEON,
+    S16ToFloatNEON, FloatToS16NEON,  S32ToFloatNEON, FloatToS32NEON,    ShiftRightS32NEON,
+    CAEMixKernels::Isa::NEON, "NEON",
+};
+#endif
+
+const CAEMixKernels& SelectKernels()
+{
+  const CAEMixKernels* kernels = &scalarKernels;
+
+  const auto cpuInfo = CServiceBroker::GetCPUInfo();
+  const unsigned int features = cpuInfo ? cpuInfo->GetCPUFeatures() : 0;
+#if defined(AE_MIX_KERNELS_SSE2)
+  if (features & CPU_FEATURE_SSE2)
+    kernels = &sse2Kernels;
+#endif
+#if defined(AE_MIX_KERNELS_NEON)
+  if (features & CPU_FEATURE_NEON)
+    kernels = &neonKernels;
+#endif
+
+  CLog::Log(LOGINFO, "CAEMixKernels::{} - using {} kernels", __FUNCTION__, kernels->name);
+  return *kernels;
+}
+} // namespace
+
+const CAEMixKernels& CAEMixKernels::Get()
+{
+  static const CAEMixKernels& kernels = SelectKernels();
+  return kernels;
+}
+
+const CAEMixKernels* CAEMixKernels::Get(Isa isa)
+{
+  switch (isa)
+  {
+    case Isa::SCALAR:
+      return &scalarKernels;
+#if defined(AE_MIX_KERNELS_SSE2)
+    case Isa::SSE2:
+      return &sse2Kernels;
+#endif
+#if defined(AE_MIX_KERNELS_NEON)
+    case Isa::NEON:
+      return &neonKernels;
+#endif
+    default:
+      return nullptr;
+  }
+}
@@ -0,0 +1,87 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*!
+ \brief Sample kernels used by ActiveAE for mixing and volume, and by the resampler for format
+ conversion and S24 output.
+
+ Every kernel has a scalar implementation and, depending on the build, an SSE2 or NEON one.
+ The implementation is chosen once from the features reported by CCPUInfo. Buffers don't need
+ any particular alignment.
+ */
+class CAEMixKernels
+{
+public:
+  enum class Isa
+  {
+    SCALAR,
+    SSE2,
+    NEON,
+  };
+
+  /*!
+   \brief data[i] *= mul
+   */
+  void (*MulArray)(float* data, float mul, uint32_t count);
+
+  /*!
+   \brief dst[i] += src[i] * mul
+   \return true if a mixed sample exceeds the range of -1.0 .. 1.0
+   */
+  bool (*MulAddArray)(float* dst, const float* src, float mul, uint32_t count);
+
+  /*!
+   \brief Scale each frame by its own gain, e.g. for fades and the limiter
+   \param stride number of samples per frame and plane
+   */
+  void (*MulFrames)(float* data, const float* gains, uint32_t frames, uint32_t stride);
+
+  /*!
+   \brief Mix each frame scaled by its own gain
+   \return true if a mixed sample exceeds the range of -1.0 .. 1.0
+   */
+  bool (*MulAddFrames)(
+      float* dst, const float* src, const float* gains, uint32_t frames, uint32_t stride);
+
+  /*!
+   \brief Soft clamp samples to -1.0 .. 1.0, see CAEUtil::ClampArray
+   */
+  void (*ClampArray)(float* data, uint32_t count);
+
+  /*!
+   \brief Convert between native endian integer and float samples, in the way swresample does
+   without dithering. Float samples are clipped to -1.0 .. 1.0 when converted to integers.
+   */
+  void (*S16ToFloat)(const int16_t* src, float* dst, uint32_t count);
+  void (*FloatToS16)(const float* src, int16_t* dst, uint32_t count);
+  void (*S32ToFloat)(const int32_t* src, float* dst, uint32_t count);
+  void (*FloatToS32)(const float* src, int32_t* dst, uint32_t count);
+
+  /*!
+   \brief Logical right shift of 32 bit samples, moves left aligned samples to the right
+   */
+  void (*ShiftRightS32)(uint32_t* data, unsigned int shift, uint32_t count);
+
+  Isa isa;
+  const char* name;
+
+  /*!
+   \brief Get the best kernels supported by the CPU
+   */
+  static const CAEMixKernels& Get();
+
+  /*!
+   \brief Get the kernels for an instruction set
+   \return nullptr if the kernels aren't part of this build
+   */
+  static const CAEMixKernels* Get(Isa isa);
+};
@@ -0,0 +1,224 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AEMixKernels.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// odd sizes exercise the scalar tails of the vector kernels
+constexpr uint32_t FRAMES = 1027;
+constexpr uint32_t STRIDES[] = {1, 2, 6, 8};
+
+std::vector<const CAEMixKernels*> GetVectorKernels()
+{
+  std::vector<const CAEMixKernels*> kernels;
+  for (auto isa : {CAEMixKernels::Isa::SSE2, CAEMixKernels::Isa::NEON})
+  {
+    if (const CAEMixKernels* k = CAEMixKernels::Get(isa))
+      kernels.emplace_back(k);
+  }
+  return kernels;
+}
+
+std::vector<float> Random(uint32_t count, float range)
+{
+  std::mt19937 gen(count);
+  std::uniform_real_distribution<float> dist(-range, range);
+  std::vector<float> data(count);
+  for (auto& sample : data)
+    sample = dist(gen);
+  return data;
+}
+
+const CAEMixKernels& Scalar()
+{
+  return *CAEMixKernels::Get(CAEMixKernels::Isa::SCALAR);
+}
+} // namespace
+
+TEST(TestAEMixKernels, MulAddArray)
+{
+  for (const CAEMixKernels* kernels : GetVectorKernels())
+  {
+    const std::vector<float> src = Random(FRAMES, 1.0f);
+    std::vector<float> expected = Random(FRAMES, 0.5f);
+    std::vector<float> actual = expected;
+
+    // offset by one sample to test unaligned buffers
+    EXPECT_FALSE(Scalar().MulAddArray(expected.data() + 1, src.data() + 1, 0.25f, FRAMES - 1));
+    EXPECT_FALSE(kernels->MulAddArray(actual.data() + 1, src.data() + 1, 0.25f, FRAMES - 1));
+    for (uint32_t i = 0; i < FRAMES; ++i)
+      EXPECT_FLOAT_EQ(expected[i], actual[i]) << kernels->name << " at " << i;
+
+    // loud samples have to be detected in the vector part and in the tail
+    for (uint32_t pos : {4u, FRAMES - 1})
+    {
+      std::vector<float> dst(FRAMES, 0.0f);
+      std::vector<float> loud(FRAMES, 0.0f);
+      loud[pos] = 3.0f;
+      EXPECT_TRUE(kernels->MulAddArray(dst.data(), loud.data(), 0.5f, FRAMES))
+          << kernels->name << " at " << pos;
+    }
+  }
+}
+
+TEST(TestAEMixKernels, Frames)
+{
+  for (const CAEMixKernels* kernels : GetVectorKernels())
+  {
+    for (uint32_t stride : STRIDES)
+    {
+      const uint32_t frames = FRAMES / stride;
+      std::vector<float> gains(frames);
+      for (uint32_t f = 0; f < frames; ++f)
+        gains[f] = static_cast<float>(f) / frames;
+
+      const std::vector<float> src = Random(frames * stride, 1.0f);
+      std::vector<float> expected = Random(frames * stride, 0.5f);
+      std::vector<float> actual = expected;
+
+      Scalar().MulFrames(expected.data(), gains.data(), frames, stride);
+      kernels->MulFrames(actual.data(), gains.data(), frames, stride);
+      for (uint32_t i = 0; i < frames * stride; ++i)
+        ASSERT_FLOAT_EQ(expected[i], actual[i]) << kernels->name << " stride " << stride;
+
+      const bool expectedClamp =
+          Scalar().MulAddFrames(expected.data(), src.data(), gains.data(), frames, stride);
+      const bool actualClamp =
+          kernels->MulAddFrames(actual.data(), src.data(), gains.data(), frames, stride);
+      EXPECT_EQ(expectedClamp, actualClamp);
+      for (uint32_t i = 0; i < frames * stride; ++i)
+        ASSERT_FLOAT_EQ(expected[i], actual[i]) << kernels->name << " stride " << stride;
+    }
+  }
+}
+
+TEST(TestAEMixKernels, ClampArray)
+{
+  std::vector<float> data = Random(FRAMES, 5.0f);
+  Scalar().ClampArray(data.data(), FRAMES);
+  for (float sample : data)
+    EXPECT_LE(std::abs(sample), 1.0f + 1e-6f);
+
+  for (const CAEMixKernels* kernels : GetVectorKernels())
+  {
+    std::vector<float> expected = Random(FRAMES, 5.0f);
+    std::vector<float> actual = expected;
+    Scalar().ClampArray(expected.data(), FRAMES);
+    kernels->ClampArray(actual.data(), FRAMES);
+    for (uint32_t i = 0; i < FRAMES; ++i)
+      EXPECT_NEAR(expected[i], actual[i], 1e-6f) << kernels->name << " at " << i;
+  }
+}
+
+TEST(TestAEMixKernels, Conversion)
+{
+  std::vector<float> samples = Random(FRAMES, 1.2f);
+  samples[0] = 1.0f;
+  samples[1] = -1.0f;
+  samples[2] = 0.0f;
+
+  std::vector<int16_t> s16(FRAMES);
+  std::vector<int32_t> s32(FRAMES);
+  Scalar().FloatToS16(samples.data(), s16.data(), FRAMES);
+  Scalar().FloatToS32(samples.data(), s32.data(), FRAMES);
+  EXPECT_EQ(32767, s16[0]);
+  EXPECT_EQ(-32768, s16[1]);
+  EXPECT_EQ(0, s16[2]);
+  EXPECT_EQ(2147483520, s32[0]);
+  EXPECT_EQ(-2147483647 - 1, s32[1]);
+  EXPECT_EQ(0, s32[2]);
+
+  for (const CAEMixKernels* kernels : GetVectorKernels())
+  {
+    std::vector<int16_t> vs16(FRAMES);
+    std::vector<int32_t> vs32(FRAMES);
+    kernels->FloatToS16(samples.data(), vs16.data(), FRAMES);
+    kernels->FloatToS32(samples.data(), vs32.data(), FRAMES);
+    for (uint32_t i = 0; i < FRAMES; ++i)
+    {
+      // rounding of exact halves may differ between instruction sets
+      EXPECT_NEAR(s16[i], vs16[i], 1) << kernels->name << " at " << i;
+      EXPECT_NEAR(s32[i], vs32[i], 128) << kernels->name << " at " << i;
+    }
+
+    std::vector<float> expected(FRAMES);
+    std::vector<float> actual(FRAMES);
+    Scalar().S16ToFloat(s16.data(), expected.data(), FRAMES);
+    kernels->S16ToFloat(s16.data(), actual.data(), FRAMES);
+    for (uint32_t i = 0; i < FRAMES; ++i)
+      EXPECT_EQ(expected[i], actual[i]) << kernels->name << " at " << i;
+
+    Scalar().S32ToFloat(s32.data(), expected.data(), FRAMES);
+    kernels->S32ToFloat(s32.data(), actual.data(), FRAMES);
+    for (uint32_t i = 0; i < FRAMES; ++i)
+      EXPECT_EQ(expected[i], actual[i]) << kernels->name << " at " << i;
+  }
+}
+
+TEST(TestAEMixKernels, ShiftRightS32)
+{
+  const std::vector<float> samples = Random(FRAMES, 1.0f);
+  std::vector<uint32_t> expected(FRAMES);
+  for (uint32_t i = 0; i < FRAMES; ++i)
+    expected[i] = static_cast<uint32_t>(static_cast<int32_t>(samples[i] * 2147483520.0f));
+
+  for (const CAEMixKernels* kernels : GetVectorKernels())
+  {
+    std::vector<uint32_t> actual(expected);
+    std::vector<uint32_t> scalar(expected);
+    Scalar().ShiftRightS32(scalar.data(), 8, FRAMES);
+    kernels->ShiftRightS32(actual.data(), 8, FRAMES);
+    EXPECT_EQ(scalar, actual) << kernels->name;
+  }
+}
+
+// microbenchmark, run with --gtest_also_run_disabled_tests
+TEST(TestAEMixKernels, DISABLED_Throughput)
+{
+  // a typical period of 8 channels, interleaved
+  constexpr uint32_t COUNT = 1024 * 8;
+  constexpr int ROUNDS = 20000;
+
+  const std::vector<float> src = Random(COUNT, 0.5f);
+  std::vector<float> gains = Random(COUNT / 8, 1.0f);
+  std::vector<int16_t> s16(COUNT);
+
+  std::vector<const CAEMixKernels*> all = GetVectorKernels();
+  all.insert(all.begin(), &Scalar());
+  for (const CAEMixKernels* kernels : all)
+  {
+    std::vector<float> dst(COUNT, 0.0f);
+    auto Measure = [&](const char* kernel, const auto& func)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < ROUNDS; ++i)
+        func();
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      std::cout << kernels->name << " " << kernel << ": "
+                << COUNT * static_cast<double>(ROUNDS) / elapsed.count() / 1e6
+                << " Msamples/s\n";
+    };
+
+    Measure("MulArray", [&] { kernels->MulArray(dst.data(), 0.999f, COUNT); });
+    Measure("MulAddArray", [&] { kernels->MulAddArray(dst.data(), src.data(), 0.5f, COUNT); });
+    Measure("MulAddFrames",
+            [&] { kernels->MulAddFrames(dst.data(), src.data(), gains.data(), COUNT / 8, 8); });
+    Measure("ClampArray", [&] { kernels->ClampArray(dst.data(), COUNT); });
+    Measure("FloatToS16", [&] { kernels->FloatToS16(src.data(), s16.data(), COUNT); });
+    Measure("S16ToFloat", [&] { kernels->S16ToFloat(s16.data(), dst.data(), COUNT); });
+  }
+}
@@ -13,6 +13,8 @@
 #include "cores/RetroPlayer/RetroPlayerUtils.h"
 #include "cores/RetroPlayer/guibridge/GUIGameRenderManager.h"
 #include "cores/RetroPlayer/guibridge/GUIRenderHandle.h"
+#include "guilib/GUIComponent.h"
+#include "guilib/GUIRenderBatch.h"
 #include "settings/GameSettings.h"
 #include "settings/MediaSettings.h"
 #include "utils/Geometry.h"
@@ -95,6 +97,8 @@ void CGUIGameControl::Process(unsigned int currentTime, CDirtyRegionList& dirtyr
 
 void CGUIGameControl::Render()
 {
+  // the game is drawn by itself, the controls below have to be drawn first
+  CServiceBroker::GetGUI()->GetRenderBatch().Flush();
   m_renderHandle->Render();
 
   CGUIControl::Render();
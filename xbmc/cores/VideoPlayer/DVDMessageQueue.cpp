@@ -17,7 +17,60 @@
 
 using namespace std::chrono_literals;
 
-CDVDMessageQueue::CDVDMessageQueue(const std::string &owner) : m_hEvent(true), m_owner(owner)
+CDVDMessageQueue::CMessageRing::CMessageRing(size_t capacity)
+{
+  size_t slots = 1;
+  while (slots < capacity)
+    slots <<= 1;
+  m_slots.resize(slots);
+}
+
+void CDVDMessageQueue::CMessageRing::push_front(DVDMessageListItem&& item)
+{
+  Grow();
+  m_head = (m_head + m_slots.size() - 1) & (m_slots.size() - 1);
+  m_slots[m_head] = std::move(item);
+  ++m_count;
+}
+
+void CDVDMessageQueue::CMessageRing::push_back(DVDMessageListItem&& item)
+{
+  Grow();
+  m_slots[Index(m_count)] = std::move(item);
+  ++m_count;
+}
+
+void CDVDMessageQueue::CMessageRing::insert(size_t pos, DVDMessageListItem&& item)
+{
+  push_back(std::move(item));
+  for (size_t i = m_count - 1; i > pos; --i)
+    std::swap((*this)[i], (*this)[i - 1]);
+}
+
+void CDVDMessageQueue::CMessageRing::pop_back()
+{
+  back().message.reset();
+  --m_count;
+}
+
+void CDVDMessageQueue::CMessageRing::Grow()
+{
+  if (m_count < m_slots.size())
+    return;
+
+  std::vector<DVDMessageListItem> slots(m_slots.size() * 2);
+  for (size_t i = 0; i < m_count; ++i)
+    slots[i] = std::move((*this)[i]);
+
+  m_slots = std::move(slots);
+  m_head = 0;
+}
+
+CDVDMessageQueue::CDVDMessageQueue(const std::string& owner)
+  : m_hEvent(true),
+    m_owner(owner),
+    m_messages(256),
+    m_prioMessages(16)
 {
   m_iDataSize     = 0;
   m_bInitialized = false;
@@ -118,11 +171,10 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     if (!front)
       prio++;
 
-    auto it = std::find_if(m_prioMessages.begin(), m_prioMessages.end(),
-                           [prio](const DVDMessageListItem &item){
-                             return prio <= item.priority;
-                           });
-    m_prioMessages.emplace(it, pMsg, priority);
+    size_t pos = 0;
+    while (pos < m_prioMessages.size() && prio > m_prioMessages[pos].priority)
+      ++pos;
+    m_prioMessages.insert(pos, DVDMessageListItem(pMsg, priority));
   }
   else
   {
@@ -134,9 +186,9 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     }
 
     if (front)
-      m_messages.emplace_front(pMsg, priority);
+      m_messages.push_front(DVDMessageListItem(pMsg, priority));
     else
-      m_messages.emplace_back(pMsg, priority);
+      m_messages.push_back(DVDMessageListItem(pMsg, priority));
   }
 
   if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET) && priority == 0)
@@ -152,8 +204,9 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     }
   }
 
-  // inform waiter for new packet
-  m_hEvent.Set();
+  // inform waiter for new packet, skipped while nobody waits to save the event's lock
+  if (m_waiters > 0)
+    m_hEvent.Set();
 
   return MSGQ_OK;
 }
@@ -174,7 +227,8 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
   while (!m_bAbortRequest)
   {
-    std::list<DVDMessageListItem> &msgs = (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
+    CMessageRing& msgs =
+        (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
 
     if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
     {
@@ -205,13 +259,17 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
     else
     {
       m_hEvent.Reset();
+      m_waiters++;
       lock.unlock();
 
       // wait for a new message
-      if (!m_hEvent.Wait(timeout))
-        return MSGQ_TIMEOUT;
+      const bool signaled = m_hEvent.Wait(timeout);
 
       lock.lock();
+      m_waiters--;
+
+      if (!signaled)
+        return MSGQ_TIMEOUT;
     }
   }
 
@@ -275,14 +333,14 @@ unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
     return 0;
 
   unsigned count = 0;
-  for (const auto &item : m_messages)
+  for (size_t i = 0; i < m_messages.size(); ++i)
   {
-    if(item.message->IsType(type))
+    if (m_messages[i].message->IsType(type))
       count++;
   }
-  for (const auto &item : m_prioMessages)
+  for (size_t i = 0; i < m_prioMessages.size(); ++i)
   {
-    if(item.message->IsType(type))
+    if (m_prioMessages[i].message->IsType(type))
       count++;
   }
 
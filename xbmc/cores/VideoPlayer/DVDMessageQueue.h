@@ -14,8 +14,8 @@
 
 #include <algorithm>
 #include <atomic>
-#include <list>
 #include <string>
+#include <vector>
 
 struct DVDMessageListItem
 {
@@ -25,9 +25,11 @@ struct DVDMessageListItem
   }
   DVDMessageListItem() { priority = 0; }
   DVDMessageListItem(const DVDMessageListItem&) = delete;
+  DVDMessageListItem(DVDMessageListItem&&) = default;
   ~DVDMessageListItem() = default;
 
   DVDMessageListItem& operator=(const DVDMessageListItem&) = delete;
+  DVDMessageListItem& operator=(DVDMessageListItem&&) = default;
 
   std::shared_ptr<CDVDMsg> message;
   int priority;
@@ -91,12 +93,63 @@ public:
   bool IsDataBased() const;
 
 private:
+  /*!
+   \brief Double ended queue of messages in preallocated slots.
+
+   Slots are reused once a message has been taken, so queueing a message doesn't allocate
+   unless the ring has to grow. Front is the most recently put message, back the next one
+   to get.
+   */
+  class CMessageRing
+  {
+  public:
+    explicit CMessageRing(size_t capacity);
+
+    bool empty() const { return m_count == 0; }
+    size_t size() const { return m_count; }
+    DVDMessageListItem& front() { return m_slots[m_head]; }
+    DVDMessageListItem& back() { return m_slots[Index(m_count - 1)]; }
+    DVDMessageListItem& operator[](size_t i) { return m_slots[Index(i)]; }
+    const DVDMessageListItem& operator[](size_t i) const { return m_slots[Index(i)]; }
+
+    void push_front(DVDMessageListItem&& item);
+    void push_back(DVDMessageListItem&& item);
+    void insert(size_t pos, DVDMessageListItem&& item);
+    void pop_back();
+
+    template<typename Predicate>
+    void remove_if(Predicate pred)
+    {
+      size_t kept = 0;
+      for (size_t i = 0; i < m_count; ++i)
+      {
+        if (pred((*this)[i]))
+          continue;
+        if (kept != i)
+          (*this)[kept] = std::move((*this)[i]);
+        ++kept;
+      }
+      for (size_t i = kept; i < m_count; ++i)
+        (*this)[i].message.reset();
+      m_count = kept;
+    }
+
+  private:
+    size_t Index(size_t i) const { return (m_head + i) & (m_slots.size() - 1); }
+    void Grow();
+
+    std::vector<DVDMessageListItem> m_slots; // size is a power of two
+    size_t m_head = 0;
+    size_t m_count = 0;
+  };
+
   MsgQueueReturnCode Put(const std::shared_ptr<CDVDMsg>& pMsg, int priority, bool front);
   void UpdateTimeFront();
   void UpdateTimeBack();
 
   CEvent m_hEvent;
   mutable CCriticalSection m_section;
+  int m_waiters = 0;
 
   std::atomic<bool> m_bAbortRequest = false;
   bool m_bInitialized;
@@ -110,7 +163,7 @@ private:
   int m_iMaxDataSize;
   std::string m_owner;
 
-  std::list<DVDMessageListItem> m_messages;
-  std::list<DVDMessageListItem> m_prioMessages;
+  CMessageRing m_messages;
+  CMessageRing m_prioMessages;
 };
 
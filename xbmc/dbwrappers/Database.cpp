@@ -317,6 +317,26 @@ std::string CDatabase::GetSingleValue(const std::string& query) const
   return GetSingleValue(query, *m_pDS);
 }
 
+std::string CDatabase::GetSingleValue(const std::string& query, const BindList& params) const
+{
+  std::string ret;
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return ret;
+
+    if (m_pDS->query(query, params) && m_pDS->num_rows() > 0)
+      ret = m_pDS->fv(0).get_asString();
+
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed on query '{}'", query);
+  }
+  return ret;
+}
+
 int CDatabase::GetSingleValueInt(const std::string& query, Dataset& ds) const
 {
   int ret = 0;
@@ -372,9 +392,9 @@ bool CDatabase::CommitMultipleExecute()
 {
   m_multipleExecute = false;
   BeginTransaction();
-  for (const auto& i : m_multipleQueries)
+  for (const auto& [query, params] : m_multipleQueries)
   {
-    if (!ExecuteQuery(i))
+    if (!(params.empty() ? ExecuteQuery(query) : ExecuteQuery(query, params)))
     {
       RollbackTransaction();
       return false;
@@ -388,7 +408,7 @@ bool CDatabase::ExecuteQuery(const std::string& strQuery)
 {
   if (m_multipleExecute)
   {
-    m_multipleQueries.push_back(strQuery);
+    m_multipleQueries.emplace_back(strQuery, BindList());
     return true;
   }
 
@@ -411,6 +431,33 @@ bool CDatabase::ExecuteQuery(const std::string& strQuery)
   return bReturn;
 }
 
+bool CDatabase::ExecuteQuery(const std::string& strQuery, const BindList& params)
+{
+  if (m_multipleExecute)
+  {
+    m_multipleQueries.emplace_back(strQuery, params);
+    return true;
+  }
+
+  bool bReturn = false;
+
+  try
+  {
+    if (nullptr == m_pDB)
+      return bReturn;
+    if (nullptr == m_pDS)
+      return bReturn;
+    m_pDS->exec(strQuery, params);
+    bReturn = true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed to execute query '{}'", strQuery);
+  }
+
+  return bReturn;
+}
+
 bool CDatabase::ResultQuery(const std::string& strQuery) const
 {
   bool bReturn = false;
@@ -434,6 +481,27 @@ bool CDatabase::ResultQuery(const std::string& strQuery) const
   return bReturn;
 }
 
+bool CDatabase::ResultQuery(const std::string& strQuery, const BindList& params) const
+{
+  bool bReturn = false;
+
+  try
+  {
+    if (nullptr == m_pDB)
+      return bReturn;
+    if (nullptr == m_pDS)
+      return bReturn;
+
+    bReturn = m_pDS->query(strQuery, params);
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed to execute query '{}'", strQuery);
+  }
+
+  return bReturn;
+}
+
 bool CDatabase::QueueInsertQuery(const std::string& strQuery)
 {
   if (strQuery.empty())
@@ -632,6 +700,8 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
   // create the datasets
   m_pDS.reset(m_pDB->CreateDataset());
   m_pDS2.reset(m_pDB->CreateDataset());
+  m_pDS->set_columnar_results(dbSettings.columnarresults);
+  m_pDS2->set_columnar_results(dbSettings.columnarresults);
 
   const int state{m_pDB->connect(create)};
   switch (state)
@@ -712,12 +782,24 @@ void CDatabase::Close()
     return;
   if (nullptr != m_pDS)
     m_pDS->close();
+  if (nullptr != m_pDS2)
+    m_pDS2->close();
+  LogStatementStats();
   m_pDB->disconnect();
   m_pDB.reset();
   m_pDS.reset();
   m_pDS2.reset();
 }
 
+void CDatabase::LogStatementStats() const
+{
+  for (const auto& [sql, stats] : m_pDB->get_statement_stats())
+  {
+    CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} executions, {} prepares, {} us total for statement: {}",
+                stats.executions, stats.prepares, stats.duration.count(), sql);
+  }
+}
+
 bool CDatabase::Compress(bool bForce /* =true */)
 {
   if (!m_sqlite)
@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include "qry_dat.h"
+
 #include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace dbiplus
@@ -27,6 +30,9 @@ struct SortDescription;
 class CDatabase
 {
 public:
+  /*! \brief Values bound to the '?' placeholders of a query, in order */
+  using BindList = std::vector<dbiplus::field_value>;
+
   class Filter
   {
   public:
@@ -114,6 +120,20 @@ public:
 
   std::string PrepareSQL(std::string_view sqlFormat, ...) const;
 
+  /*!
+   * @brief Collect the values for the '?' placeholders of a query.
+   * @remarks Strings are bound as they are, they must not be quoted or escaped.
+   * @return The values to pass to ExecuteQuery(), ResultQuery() or GetSingleValue().
+   */
+  template<typename... Args>
+  static BindList Bind(const Args&... args)
+  {
+    BindList params;
+    params.reserve(sizeof...(args));
+    (params.emplace_back(BindValue(args)), ...);
+    return params;
+  }
+
   /*!
    * @brief Get a single value from a table.
    * @remarks The values of the strWhereClause and strOrderBy parameters have to be FormatSQL'ed when used.
@@ -129,6 +149,13 @@ public:
                              const std::string& strOrderBy = std::string()) const;
   std::string GetSingleValue(const std::string& query) const;
 
+  /*! \brief Get a single value from a query with '?' placeholders.
+   \param query the query in question, identifiers have to be PrepareSQL'ed.
+   \param params the values for the placeholders, see Bind().
+   \return the value from the query, empty on failure.
+   */
+  std::string GetSingleValue(const std::string& query, const BindList& params) const;
+
   /*! \brief Get a single value from a query on a dataset.
    \param query the query in question.
    \param ds the dataset to use for the query.
@@ -176,6 +203,16 @@ public:
    */
   bool ExecuteQuery(const std::string& strQuery);
 
+  /*!
+   * @brief Execute a query with '?' placeholders that does not return any result.
+   *        The statement is parsed once per connection and the values are bound
+   *        without formatting. Queued like ExecuteQuery() by BeginMultipleExecute().
+   * @param strQuery The query to execute, identifiers have to be PrepareSQL'ed.
+   * @param params The values for the placeholders, see Bind().
+   * @return True if the query was executed successfully, false otherwise.
+   */
+  bool ExecuteQuery(const std::string& strQuery, const BindList& params);
+
   /*!
    * @brief Execute a query that returns a result.
    * @remarks Call m_pDS->close(); to clean up the dataset when done.
@@ -184,6 +221,15 @@ public:
    */
   bool ResultQuery(const std::string& strQuery) const;
 
+  /*!
+   * @brief Execute a query with '?' placeholders that returns a result.
+   * @remarks Call m_pDS->close(); to clean up the dataset when done.
+   * @param strQuery The query to execute, identifiers have to be PrepareSQL'ed.
+   * @param params The values for the placeholders, see Bind().
+   * @return True if the query was executed successfully, false otherwise.
+   */
+  bool ResultQuery(const std::string& strQuery, const BindList& params) const;
+
   /*!
    * @brief Start a multiple execution queue. Any ExecuteQuery() function
    *        following this call will be queued rather than executed until
@@ -319,6 +365,18 @@ protected:
 private:
   void InitSettings(DatabaseSettings& dbSettings);
   void UpdateVersionNumber();
+  void LogStatementStats() const;
+
+  static dbiplus::field_value BindValue(std::string_view value)
+  {
+    return dbiplus::field_value(value.data(), value.size());
+  }
+  template<typename T>
+    requires std::is_arithmetic_v<T>
+  static dbiplus::field_value BindValue(T value)
+  {
+    return dbiplus::field_value(value);
+  }
 
   bool m_bMultiInsert{
       false}; /*!< True if there are any queries in the insert queue, false otherwise */
@@ -327,5 +385,5 @@ private:
   unsigned int m_openCount{0};
 
   bool m_multipleExecute{false};
-  std::vector<std::string> m_multipleQueries;
+  std::vector<std::pair<std::string, BindList>> m_multipleQueries;
 };
@@ -73,6 +73,17 @@ std::string Database::prepare(const char* format, ...)
   return result;
 }
 
+void Database::record_statement(const std::string& sql,
+                                bool prepared,
+                                std::chrono::steady_clock::duration duration)
+{
+  StatementStats& stats = statement_stats[sql];
+  stats.executions++;
+  if (prepared)
+    stats.prepares++;
+  stats.duration += std::chrono::duration_cast<std::chrono::microseconds>(duration);
+}
+
 //************* Dataset implementation ***************
 
 Dataset::Dataset() = default;
@@ -378,10 +389,27 @@ const field_value& Dataset::get_field_value(int index)
 
 const sql_record* Dataset::get_sql_record()
 {
-  if (result.records.empty() || frecno >= (int)result.records.size())
+  return get_sql_record(frecno);
+}
+
+const sql_record* Dataset::get_sql_record(int row)
+{
+  if (result.columnar)
+  {
+    if (row < 0 || row >= static_cast<int>(result.columns.rows()))
+      return nullptr;
+
+    const size_t ncols = result.columns.column_count();
+    columnar_record.resize(ncols);
+    for (size_t i = 0; i < ncols; ++i)
+      result.columns.get(row, i, columnar_record[i]);
+    return &columnar_record;
+  }
+
+  if (row < 0 || row >= static_cast<int>(result.records.size()))
     return nullptr;
 
-  return result.records[frecno];
+  return result.records[row];
 }
 
 field_value Dataset::f_old(const char* f_name)
@@ -14,6 +14,7 @@
 
 #include "qry_dat.h"
 
+#include <chrono>
 #include <list>
 #include <map>
 #include <memory>
@@ -41,6 +42,17 @@ constexpr int DB_BAD_RESPONSE = 6;
 constexpr int DB_UNEXPECTED = 7; // This shouldn't ever happen
 constexpr int DB_UNEXPECTED_RESULT = -1; //For integer functions
 
+/* Values bound to the '?' placeholders of a statement, in order */
+using BindList = std::vector<field_value>;
+
+/* Execution counters of a statement run with bound values */
+struct StatementStats
+{
+  uint64_t executions{0};
+  uint64_t prepares{0}; // number of times the statement had to be parsed
+  std::chrono::microseconds duration{0};
+};
+
 /******************* Class Database definition ********************
 
    represents  connection with database server;
@@ -65,6 +77,8 @@ protected:
   std::string ciphers; // SSL - Encryption info
   unsigned int connect_timeout; // seconds
 
+  std::unordered_map<std::string, StatementStats> statement_stats;
+
 public:
   /* constructor */
   Database();
@@ -172,6 +186,15 @@ public:
   virtual std::string vprepare(std::string_view format, va_list args) = 0;
 
   virtual bool in_transaction() { return false; }
+
+  /* counters of statements run with bound values */
+  void record_statement(const std::string& sql,
+                        bool prepared,
+                        std::chrono::steady_clock::duration duration);
+  const std::unordered_map<std::string, StatementStats>& get_statement_stats() const
+  {
+    return statement_stats;
+  }
 };
 
 /******************* Class Dataset definition *********************
@@ -216,6 +239,10 @@ protected:
   result_set result;
   result_set exec_res;
   bool autorefresh{false};
+  /* keep the rows of the next queries in result.columns, see set_columnar_results() */
+  bool columnar_results{false};
+  /* current row of columnar results, handed out by get_sql_record() */
+  sql_record columnar_record;
 
   bool active{false}; // Is Query Opened?
   bool haveError{false};
@@ -291,6 +318,14 @@ public:
   /* status active is OK query */
   virtual bool isActive() { return active; }
 
+  /*! \brief Store the rows of following queries column by column.
+   Large results need far less memory and fewer allocations this way. Rows are read with fv()
+   and the navigation functions as usual, get_sql_record() returns a copy of the current row
+   which stays valid until the dataset moves to another row.
+   */
+  void set_columnar_results(bool columnar) { columnar_results = columnar; }
+  bool get_columnar_results() const { return columnar_results; }
+
   virtual void setSqlParams(sqlType t, const char* sqlFrmt, ...);
 
   /* last inserted id */
@@ -309,6 +344,42 @@ public:
   virtual const void* getExecRes() = 0;
   /* as open, but with our query exec Sql */
   virtual bool query(const std::string& sql) = 0;
+
+  /*! \brief Query with '?' placeholders for values.
+   The statement is parsed once per connection and kept in a cache, identical sql text shares
+   the cached statement. The values are bound as they are, without formatting or quoting.
+   \param sql - statement with '?' placeholders, identifiers still have to be prepared.
+   \param params - values for the placeholders, in order.
+   */
+  virtual bool query(const std::string& sql, const BindList& params) = 0;
+  /*! \brief Execute a statement with '?' placeholders without results to return.
+   \sa query(const std::string&, const BindList&)
+   */
+  virtual int exec(const std::string& sql, const BindList& params) = 0;
+
+  /*! \brief Run a query as forward-only cursor.
+   Unlike query() the rows aren't copied into the result set. step() moves to the next row and
+   the column_*() accessors read its values where the database client keeps them. Besides those
+   only close() may be used while the cursor is open; num_rows(), seek(), fv() etc. can't.
+   \param sql - statement with '?' placeholders, see query(const std::string&, const BindList&).
+   \param params - values for the placeholders, in order.
+   \return true if the query was started, the cursor is positioned before the first row.
+   */
+  virtual bool query_cursor(const std::string& sql, const BindList& params) = 0;
+  /*! \brief Move the cursor to the next row.
+   \return false once there are no more rows.
+   */
+  virtual bool step() = 0;
+  /* Typed access to the columns (starting with 0) of the current cursor row. Text stays valid
+     until the next step() or close(), a NULL column reads as 0 or empty text */
+  virtual int column_count() = 0;
+  virtual bool column_is_null(int col) = 0;
+  virtual int64_t column_int64(int col) = 0;
+  virtual double column_double(int col) = 0;
+  virtual std::string_view column_text(int col) = 0;
+  int column_int(int col) { return static_cast<int>(column_int64(col)); }
+  bool column_bool(int col) { return column_int64(col) != 0; }
+
   /* Close SQL Query*/
   virtual void close();
   /* Refresh dataset (reopen it and set the same cursor position) */
@@ -394,6 +465,9 @@ public:
   /* --------------- for fast access ---------------- */
   const result_set& get_result_set() const { return result; }
   const sql_record* get_sql_record();
+  /* any row of the result set, regardless of the storage. For columnar results the record is a
+     copy that stays valid until the next call */
+  const sql_record* get_sql_record(int row);
 
 private:
   Dataset(const Dataset&) = delete;
@@ -50,6 +50,9 @@ constexpr std::string_view MIN_MYSQL_STR = "5.7.9";
 constexpr unsigned long MIN_MARIADB = 100205;
 constexpr std::string_view MIN_MARIADB_STR = "10.2.5";
 
+// split statements kept per connection, enough for the hot queries of a database
+constexpr size_t MAX_CACHED_STATEMENTS = 64;
+
 /*!
  * \brief Validation of unquoted identifiers
  * \param id Identifier to validate
@@ -63,6 +66,37 @@ bool IsValidIdentifier(std::string_view id)
   return std::ranges::all_of(id, [](char c)
                              { return StringUtils::isasciialphanum(c) || c == '_' || c == '$'; });
 }
+
+/*!
+ * \brief Split a statement at its '?' placeholders, ignoring those in quoted strings
+ * \param sql Statement to split
+ * \return Parts of the statement, one more than the number of placeholders
+ */
+std::vector<std::string> SplitPlaceholders(std::string_view sql)
+{
+  std::vector<std::string> parts(1);
+  char quote = 0;
+  for (size_t i = 0; i < sql.size(); ++i)
+  {
+    const char c = sql[i];
+    if (quote)
+    {
+      if (c == '\\' && i + 1 < sql.size())
+        parts.back() += sql[i++];
+      else if (c == quote)
+        quote = 0;
+    }
+    else if (c == '\'' || c == '"' || c == '`')
+      quote = c;
+    else if (c == '?')
+    {
+      parts.emplace_back();
+      continue;
+    }
+    parts.back() += sql[i];
+  }
+  return parts;
+}
 } // unnamed namespace
 
 namespace dbiplus
@@ -1743,7 +1777,63 @@ std::string MysqlDatabase::mysql_vmprintf(const char* zFormat, va_list ap)
   return acc.Finish();
 }
 
-MysqlDataset::~MysqlDataset() = default;
+std::string MysqlDatabase::bind(const std::string& sql, const BindList& params, bool& prepared)
+{
+  prepared = false;
+  auto it = statement_templates.find(sql);
+  if (it == statement_templates.end())
+  {
+    if (statement_templates.size() >= MAX_CACHED_STATEMENTS)
+      statement_templates.clear();
+    it = statement_templates.try_emplace(sql, SplitPlaceholders(sql)).first;
+    prepared = true;
+  }
+
+  const std::vector<std::string>& parts = it->second;
+  if (parts.size() != params.size() + 1)
+    throw DbErrors("Wrong number of bound values for query: %s", sql.c_str());
+
+  std::string result = parts[0];
+  for (size_t i = 0; i < params.size(); ++i)
+  {
+    const field_value& value = params[i];
+    if (value.get_isNull())
+      result += "NULL";
+    else
+    {
+      switch (value.get_fType())
+      {
+        case fType::ft_String:
+        case fType::ft_WideString:
+        {
+          const std::string str = value.get_asString();
+          std::string escaped(str.size() * 2 + 1, '\0');
+          escaped.resize(mysql_real_escape_string(conn, escaped.data(), str.c_str(), str.size()));
+          result += '\'';
+          result += escaped;
+          result += '\'';
+          break;
+        }
+        case fType::ft_Float:
+        case fType::ft_Double:
+        case fType::ft_LongDouble:
+          result += StringUtils::Format("{}", value.get_asDouble());
+          break;
+        default:
+          result += std::to_string(value.get_asInt64());
+          break;
+      }
+    }
+    result += parts[i + 1];
+  }
+
+  return result;
+}
+
+MysqlDataset::~MysqlDataset()
+{
+  close_cursor();
+}
 
 void MysqlDataset::set_autorefresh(bool val)
 {
@@ -1817,7 +1907,7 @@ void MysqlDataset::make_deletion()
 void MysqlDataset::fill_fields()
 {
   if (!db || (result.record_header.empty()) ||
-      (result.records.size() < static_cast<unsigned int>(frecno)))
+      (result.size() < static_cast<unsigned int>(frecno)))
     return;
 
   if (fields_object->empty()) // Filling columns name
@@ -1834,7 +1924,18 @@ void MysqlDataset::fill_fields()
   }
 
   //Filling result
-  if (!result.records.empty())
+  if (result.columnar)
+  {
+    if (static_cast<unsigned int>(frecno) < result.columns.rows())
+    {
+      const size_t ncols = result.columns.column_count();
+      fields_object->resize(ncols);
+      for (size_t i = 0; i < ncols; ++i)
+        result.columns.get(frecno, i, (*fields_object)[i].val);
+      return;
+    }
+  }
+  else if (!result.records.empty())
   {
     const sql_record* row = result.records[frecno];
     if (row)
@@ -1914,6 +2015,20 @@ int MysqlDataset::exec(const std::string& sql)
   }
 }
 
+int MysqlDataset::exec(const std::string& sql, const BindList& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  const auto start = std::chrono::steady_clock::now();
+
+  bool prepared = false;
+  const int res = exec(static_cast<MysqlDatabase*>(db)->bind(sql, params, prepared));
+
+  db->record_statement(sql, prepared, std::chrono::steady_clock::now() - start);
+  return res;
+}
+
 int MysqlDataset::exec()
 {
   return exec(sql);
@@ -1961,6 +2076,10 @@ bool MysqlDataset::query(const std::string& query)
   for (unsigned int i = 0; i < numColumns; i++)
     result.record_header[i].name = fields[i].name;
 
+  // columnar results take all rows, nothing is left for the loop below then
+  if (columnar_results)
+    fetch_columns(stmt, fields, numColumns);
+
   // returned rows
   while ((row = mysql_fetch_row(stmt)))
   { // have a row of data
@@ -2037,6 +2156,150 @@ bool MysqlDataset::query(const std::string& query)
   return true;
 }
 
+void MysqlDataset::fetch_columns(MYSQL_RES* res, MYSQL_FIELD* fields, unsigned int numColumns)
+{
+  result.columnar = true;
+  result.columns.reset(numColumns);
+  column_store& columns = result.columns;
+  MYSQL_ROW row;
+  while ((row = mysql_fetch_row(res)))
+  {
+    for (unsigned int i = 0; i < numColumns; i++)
+    {
+      // same types and null handling as the rows read by query()
+      switch (fields[i].type)
+      {
+        case MYSQL_TYPE_LONGLONG:
+          columns.add_int64(i, row[i] ? strtoll(row[i], nullptr, 10) : 0);
+          break;
+        case MYSQL_TYPE_DECIMAL:
+        case MYSQL_TYPE_NEWDECIMAL:
+        case MYSQL_TYPE_TINY:
+        case MYSQL_TYPE_SHORT:
+        case MYSQL_TYPE_INT24:
+        case MYSQL_TYPE_LONG:
+          columns.add_int(i, row[i] ? atoi(row[i]) : 0);
+          break;
+        case MYSQL_TYPE_FLOAT:
+        case MYSQL_TYPE_DOUBLE:
+          columns.add_double(i, row[i] ? atof(row[i]) : 0);
+          break;
+        case MYSQL_TYPE_STRING:
+        case MYSQL_TYPE_VAR_STRING:
+        case MYSQL_TYPE_VARCHAR:
+        case MYSQL_TYPE_TINY_BLOB:
+        case MYSQL_TYPE_MEDIUM_BLOB:
+        case MYSQL_TYPE_LONG_BLOB:
+        case MYSQL_TYPE_BLOB:
+          if (row[i])
+            columns.add_text(i, row[i], strlen(row[i]));
+          else
+            columns.add_text(i, "", 0);
+          break;
+        case MYSQL_TYPE_NULL:
+        default:
+          columns.add_null(i);
+          break;
+      }
+    }
+  }
+}
+
+bool MysqlDataset::query(const std::string& query, const BindList& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  const auto start = std::chrono::steady_clock::now();
+
+  bool prepared = false;
+  const bool res = this->query(static_cast<MysqlDatabase*>(db)->bind(query, params, prepared));
+
+  db->record_statement(query, prepared, std::chrono::steady_clock::now() - start);
+  return res;
+}
+
+bool MysqlDataset::query_cursor(const std::string& query, const BindList& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  close();
+
+  bool prepared = false;
+  std::string qry = static_cast<MysqlDatabase*>(db)->bind(query, params, prepared);
+
+  // mysql doesn't understand CAST(foo as integer) => change to CAST(foo as signed integer)
+  size_t loc;
+  while ((loc = ci_find(qry, "as integer)")) != std::string::npos)
+    qry = qry.insert(loc + 3, "signed ");
+
+  if (static_cast<MysqlDatabase*>(db)->setErr(
+          static_cast<MysqlDatabase*>(db)->query_with_reconnect(qry.c_str()), qry.c_str()) !=
+      MYSQL_OK)
+    throw DbErrors(db->getErrorMsg());
+
+  // the client library still buffers the rows, mysql_use_result() would block the connection
+  // for the other datasets until all rows are read. They are read in place though.
+  cursor = mysql_store_result(handle());
+  if (!cursor)
+    throw DbErrors("Missing result set!");
+
+  active = true;
+  return true;
+}
+
+bool MysqlDataset::step()
+{
+  if (!cursor)
+    return false;
+
+  cursor_row = mysql_fetch_row(cursor);
+  if (!cursor_row)
+    return false;
+
+  cursor_lengths = mysql_fetch_lengths(cursor);
+  return true;
+}
+
+int MysqlDataset::column_count()
+{
+  return cursor ? static_cast<int>(mysql_num_fields(cursor)) : 0;
+}
+
+bool MysqlDataset::column_is_null(int col)
+{
+  return !cursor_row || !cursor_row[col];
+}
+
+int64_t MysqlDataset::column_int64(int col)
+{
+  return column_is_null(col) ? 0 : strtoll(cursor_row[col], nullptr, 10);
+}
+
+double MysqlDataset::column_double(int col)
+{
+  return column_is_null(col) ? 0.0 : atof(cursor_row[col]);
+}
+
+std::string_view MysqlDataset::column_text(int col)
+{
+  if (column_is_null(col))
+    return {};
+  return {cursor_row[col], cursor_lengths[col]};
+}
+
+void MysqlDataset::close_cursor()
+{
+  if (cursor)
+  {
+    mysql_free_result(cursor);
+    cursor = nullptr;
+  }
+  cursor_row = nullptr;
+  cursor_lengths = nullptr;
+}
+
 void MysqlDataset::open(const std::string& sql)
 {
   set_select_sql(sql);
@@ -2058,6 +2321,7 @@ void MysqlDataset::open()
 void MysqlDataset::close()
 {
   Dataset::close();
+  close_cursor();
   result.clear();
   edit_object->clear();
   fields_object->clear();
@@ -2078,7 +2342,7 @@ void MysqlDataset::cancel()
 
 int MysqlDataset::num_rows()
 {
-  return static_cast<int>(result.records.size());
+  return static_cast<int>(result.size());
 }
 
 bool MysqlDataset::eof()
@@ -11,6 +11,8 @@
 #include "dataset.h"
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #ifdef HAS_MYSQL
 #include <mysql/mysql.h>
@@ -80,9 +82,15 @@ public:
   int query_with_reconnect(const char* query);
   void configure_connection();
 
+  /* substitutes the '?' placeholders of sql with the escaped values */
+  std::string bind(const std::string& sql, const BindList& params, bool& prepared);
+
 private:
   char et_getdigit(double* val, int* cnt) const;
   std::string mysql_vmprintf(const char* zFormat, va_list ap);
+
+  /* statements split at their placeholders */
+  std::unordered_map<std::string, std::vector<std::string>> statement_templates;
 };
 
 /***************** Class MysqlDataset definition *******************
@@ -96,6 +104,12 @@ class MysqlDataset : public Dataset
 protected:
   MYSQL* handle();
 
+  /* result and current row of an open forward-only cursor */
+  MYSQL_RES* cursor{nullptr};
+  MYSQL_ROW cursor_row{nullptr};
+  unsigned long* cursor_lengths{nullptr};
+  void close_cursor();
+
   /* Makes direct queries to database */
   virtual void make_query(StringList& _sql);
   /* Makes direct inserts into database */
@@ -110,6 +124,8 @@ protected:
   void fill_fields() override;
   /* Changing field values during dataset navigation */
   virtual void free_row(); // free the memory allocated for the current row
+  /* Reads all rows of a stored result into the column store of the result set */
+  void fetch_columns(MYSQL_RES* res, MYSQL_FIELD* fields, unsigned int numColumns);
 
 public:
   /* constructor */
@@ -128,9 +144,19 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  int exec(const std::string& sql, const BindList& params) override;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  bool query(const std::string& query, const BindList& params) override;
+  /* forward-only cursor */
+  bool query_cursor(const std::string& query, const BindList& params) override;
+  bool step() override;
+  int column_count() override;
+  bool column_is_null(int col) override;
+  int64_t column_int64(int col) override;
+  double column_double(int col) override;
+  std::string_view column_text(int col) override;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
@@ -17,7 +17,9 @@
 
 #include "qry_dat.h"
 
+#include <bit>
 #include <cstdlib>
+#include <cstring>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -810,4 +812,92 @@ std::string_view field_value::gft() const
   return "";
 }
 
+void column_store::reset(std::size_t columns)
+{
+  clear();
+  cols.resize(columns);
+}
+
+void column_store::clear()
+{
+  cols.clear();
+  arena.clear();
+}
+
+void column_store::add_null(std::size_t col)
+{
+  cols[col].kinds.push_back(kind::null);
+  cols[col].values.push_back(0);
+}
+
+void column_store::add_int(std::size_t col, int value)
+{
+  cols[col].kinds.push_back(kind::int32);
+  cols[col].values.push_back(value);
+}
+
+void column_store::add_int64(std::size_t col, int64_t value)
+{
+  cols[col].kinds.push_back(kind::int64);
+  cols[col].values.push_back(value);
+}
+
+void column_store::add_double(std::size_t col, double value)
+{
+  cols[col].kinds.push_back(kind::real);
+  cols[col].values.push_back(std::bit_cast<int64_t>(value));
+}
+
+void column_store::add_text(std::size_t col, const char* text, std::size_t len)
+{
+  cols[col].kinds.push_back(kind::text);
+  cols[col].values.push_back(static_cast<int64_t>(arena.size()));
+
+  const auto length = static_cast<uint32_t>(len);
+  arena.append(reinterpret_cast<const char*>(&length), sizeof(length));
+  arena.append(text, length);
+}
+
+void column_store::get(std::size_t row, std::size_t col, field_value& value) const
+{
+  const kind k = cols[col].kinds[row];
+  const int64_t v = cols[col].values[row];
+
+  // set_as*() keep the null flag, so only a value that was null is replaced
+  if (value.get_isNull())
+    value = field_value();
+
+  switch (k)
+  {
+    case kind::null:
+      value.set_asString("", 0);
+      value.set_isNull();
+      break;
+    case kind::int32:
+      value.set_asInt(static_cast<int>(v));
+      break;
+    case kind::int64:
+      value.set_asInt64(v);
+      break;
+    case kind::real:
+      value.set_asDouble(std::bit_cast<double>(v));
+      break;
+    case kind::text:
+    {
+      uint32_t length;
+      std::memcpy(&length, arena.data() + v, sizeof(length));
+      value.set_asString(arena.data() + v + sizeof(length), length);
+      break;
+    }
+  }
+}
+
+std::size_t column_store::allocated_bytes() const
+{
+  std::size_t bytes = cols.capacity() * sizeof(column) + arena.capacity();
+  for (const auto& c : cols)
+    bytes += c.kinds.capacity() * sizeof(kind) + c.values.capacity() * sizeof(int64_t);
+  return bytes;
+}
+
 } // namespace dbiplus
@@ -255,6 +255,52 @@ using record_prop = std::vector<field_prop>;
 using query_data = std::vector<sql_record*>;
 using variant = field_value;
 
+/* Compact storage of query results: one vector of typed values per column instead of a
+   field_value per value and a heap allocated sql_record per row. Text of all columns is kept
+   in one shared arena. get() gives back the field_value a sql_record would have held. */
+class column_store
+{
+public:
+  /* Drop all rows and start over with the given number of columns */
+  void reset(std::size_t columns);
+  void clear();
+
+  std::size_t column_count() const { return cols.size(); }
+  std::size_t rows() const { return cols.empty() ? 0 : cols.front().kinds.size(); }
+
+  /* Append a value to a column, every column has to get one value per row */
+  void add_null(std::size_t col);
+  void add_int(std::size_t col, int value);
+  void add_int64(std::size_t col, int64_t value);
+  void add_double(std::size_t col, double value);
+  void add_text(std::size_t col, const char* text, std::size_t len);
+
+  /* Read a value into an existing field_value, reusing its string buffer */
+  void get(std::size_t row, std::size_t col, field_value& value) const;
+
+  /* Bytes allocated for the stored values */
+  std::size_t allocated_bytes() const;
+
+private:
+  enum class kind : uint8_t
+  {
+    null,
+    int32,
+    int64,
+    real,
+    text
+  };
+
+  struct column
+  {
+    std::vector<kind> kinds;
+    std::vector<int64_t> values; // the number, the bits of a double or the text offset
+  };
+
+  std::vector<column> cols;
+  std::string arena; // text values, each prefixed with its length
+};
+
 class result_set
 {
 public:
@@ -267,10 +313,18 @@ public:
         delete record;
     records.clear();
     record_header.clear();
+    columns.clear();
+    columnar = false;
   };
 
+  /* number of rows, regardless of the storage */
+  std::size_t size() const { return columnar ? columns.rows() : records.size(); }
+
   record_prop record_header;
   query_data records;
+  /* rows are kept here instead of records if the dataset asked for columnar results */
+  column_store columns;
+  bool columnar{false};
 };
 
 #ifdef TARGET_WINDOWS_STORE
@@ -18,6 +18,7 @@
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <chrono>
 #include <sstream>
 #include <stdexcept>
@@ -31,6 +32,9 @@ using namespace std::chrono_literals;
 
 namespace
 {
+// prepared statements kept per connection, enough for the hot queries of a database
+constexpr size_t MAX_CACHED_STATEMENTS = 64;
+
 #define X(VAL) std::make_pair(VAL, #VAL)
 //!@todo Remove ifdefs when sqlite version requirement has been bumped to at least 3.26.0
 constexpr auto sqliteErrorStrings = make_map<int, std::string_view>({
@@ -401,6 +405,8 @@ void SqliteDatabase::disconnect()
 {
   if (!active)
     return;
+  // sqlite refuses to close a connection with unfinalized statements
+  finalize_statements();
   sqlite3_close(conn);
   active = false;
 }
@@ -621,6 +627,44 @@ void SqliteDatabase::rollback_transaction()
   }
 }
 
+// methods for prepared statements
+// ---------------------------------------------
+sqlite3_stmt* SqliteDatabase::get_statement(const std::string& sql, bool& prepared)
+{
+  prepared = false;
+  auto it = statements.find(sql);
+  if (it == statements.end())
+  {
+    sqlite3_stmt* stmt = nullptr;
+    if (setErr(sqlite3_prepare_v2(conn, sql.c_str(), -1, &stmt, nullptr), sql.c_str()) !=
+        SQLITE_OK)
+      return nullptr;
+
+    if (statements.size() >= MAX_CACHED_STATEMENTS)
+    {
+      auto oldest = std::min_element(statements.begin(), statements.end(),
+                                     [](const auto& a, const auto& b)
+                                     { return a.second.last_used < b.second.last_used; });
+      sqlite3_finalize(oldest->second.stmt);
+      statements.erase(oldest);
+    }
+
+    it = statements.try_emplace(sql).first;
+    it->second.stmt = stmt;
+    prepared = true;
+  }
+
+  it->second.last_used = ++statement_clock;
+  return it->second.stmt;
+}
+
+void SqliteDatabase::finalize_statements()
+{
+  for (auto& [sql, statement] : statements)
+    sqlite3_finalize(statement.stmt);
+  statements.clear();
+}
+
 // methods for formatting
 // ---------------------------------------------
 std::string SqliteDatabase::vprepare(std::string_view format, va_list args)
@@ -710,7 +754,10 @@ std::string SqliteDatabase::vprepare(std::string_view format, va_list args)
 
 //************* SqliteDataset implementation ***************
 
-SqliteDataset::~SqliteDataset() = default;
+SqliteDataset::~SqliteDataset()
+{
+  close_cursor();
+}
 
 void SqliteDataset::set_autorefresh(bool val)
 {
@@ -798,7 +845,7 @@ void SqliteDataset::fill_fields()
 {
   //cout <<"rr "<<result.records.size()<<"|" << frecno <<"\n";
   if (!db || (result.record_header.empty()) ||
-      (result.records.size() < static_cast<unsigned int>(frecno)))
+      (result.size() < static_cast<unsigned int>(frecno)))
     return;
 
   if (fields_object->empty()) // Filling columns name
@@ -815,7 +862,18 @@ void SqliteDataset::fill_fields()
   }
 
   //Filling result
-  if (!result.records.empty())
+  if (result.columnar)
+  {
+    if (static_cast<unsigned int>(frecno) < result.columns.rows())
+    {
+      const size_t ncols = result.columns.column_count();
+      fields_object->resize(ncols);
+      for (size_t i = 0; i < ncols; ++i)
+        result.columns.get(frecno, i, (*fields_object)[i].val);
+      return;
+    }
+  }
+  else if (!result.records.empty())
   {
     const sql_record* row = result.records[frecno];
     if (row)
@@ -833,6 +891,126 @@ void SqliteDataset::fill_fields()
     (*fields_object)[i].val = "";
 }
 
+void SqliteDataset::fetch_rows(sqlite3_stmt* stmt)
+{
+  // column headers
+  const unsigned int numColumns = sqlite3_column_count(stmt);
+  result.record_header.resize(numColumns);
+  for (unsigned int i = 0; i < numColumns; i++)
+    result.record_header[i].name = sqlite3_column_name(stmt, i);
+
+  if (columnar_results)
+  {
+    fetch_columns(stmt, numColumns);
+    return;
+  }
+
+  // returned rows
+  while (sqlite3_step(stmt) == SQLITE_ROW)
+  { // have a row of data
+    auto* res = new sql_record;
+    res->resize(numColumns);
+    for (unsigned int i = 0; i < numColumns; i++)
+    {
+      field_value& v = res->at(i);
+      switch (sqlite3_column_type(stmt, i))
+      {
+        case SQLITE_INTEGER:
+          v.set_asInt64(sqlite3_column_int64(stmt, i));
+          break;
+        case SQLITE_FLOAT:
+          v.set_asDouble(sqlite3_column_double(stmt, i));
+          break;
+        case SQLITE_TEXT:
+          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
+                         sqlite3_column_bytes(stmt, i));
+          break;
+        case SQLITE_BLOB:
+          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
+                         sqlite3_column_bytes(stmt, i));
+          break;
+        case SQLITE_NULL:
+        default:
+          v.set_asString("", 0);
+          v.set_isNull();
+          break;
+      }
+    }
+    result.records.push_back(res);
+  }
+}
+
+void SqliteDataset::fetch_columns(sqlite3_stmt* stmt, unsigned int numColumns)
+{
+  result.columnar = true;
+  result.columns.reset(numColumns);
+  column_store& columns = result.columns;
+  while (sqlite3_step(stmt) == SQLITE_ROW)
+  {
+    for (unsigned int i = 0; i < numColumns; i++)
+    {
+      switch (sqlite3_column_type(stmt, i))
+      {
+        case SQLITE_INTEGER:
+          columns.add_int64(i, sqlite3_column_int64(stmt, i));
+          break;
+        case SQLITE_FLOAT:
+          columns.add_double(i, sqlite3_column_double(stmt, i));
+          break;
+        case SQLITE_TEXT:
+        case SQLITE_BLOB:
+          columns.add_text(i, reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
+                           sqlite3_column_bytes(stmt, i));
+          break;
+        case SQLITE_NULL:
+        default:
+          columns.add_null(i);
+          break;
+      }
+    }
+  }
+}
+
+int SqliteDataset::bind(sqlite3_stmt* stmt, const BindList& params)
+{
+  if (static_cast<int>(params.size()) != sqlite3_bind_parameter_count(stmt))
+    return SQLITE_RANGE;
+
+  for (int i = 0; i < static_cast<int>(params.size()); ++i)
+  {
+    const field_value& value = params[i];
+    int res;
+    if (value.get_isNull())
+      res = sqlite3_bind_null(stmt, i + 1);
+    else
+    {
+      switch (value.get_fType())
+      {
+        case fType::ft_String:
+        case fType::ft_WideString:
+        {
+          const std::string str = value.get_asString();
+          res = sqlite3_bind_text(stmt, i + 1, str.c_str(), static_cast<int>(str.size()),
+                                  SQLITE_TRANSIENT);
+          break;
+        }
+        case fType::ft_Float:
+        case fType::ft_Double:
+        case fType::ft_LongDouble:
+          res = sqlite3_bind_double(stmt, i + 1, value.get_asDouble());
+          break;
+        default:
+          res = sqlite3_bind_int64(stmt, i + 1, value.get_asInt64());
+          break;
+      }
+    }
+    if (res != SQLITE_OK)
+      return res;
+  }
+
+  return SQLITE_OK;
+}
+
 //------------- public functions implementation -----------------//
 bool SqliteDataset::dropIndex(const char* table, const char* index)
 {
@@ -944,45 +1122,8 @@ bool SqliteDataset::query(const std::string& query)
       SQLITE_OK)
     throw DbErrors("%s", db->getErrorMsg());
 
-  // column headers
-  const unsigned int numColumns = sqlite3_column_count(stmt);
-  result.record_header.resize(numColumns);
-  for (unsigned int i = 0; i < numColumns; i++)
-    result.record_header[i].name = sqlite3_column_name(stmt, i);
+  fetch_rows(stmt);
 
-  // returned rows
-  while (sqlite3_step(stmt) == SQLITE_ROW)
-  { // have a row of data
-    auto* res = new sql_record;
-    res->resize(numColumns);
-    for (unsigned int i = 0; i < numColumns; i++)
-    {
-      field_value& v = res->at(i);
-      switch (sqlite3_column_type(stmt, i))
-      {
-        case SQLITE_INTEGER:
-          v.set_asInt64(sqlite3_column_int64(stmt, i));
-          break;
-        case SQLITE_FLOAT:
-          v.set_asDouble(sqlite3_column_double(stmt, i));
-          break;
-        case SQLITE_TEXT:
-          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
-                         sqlite3_column_bytes(stmt, i));
-          break;
-        case SQLITE_BLOB:
-          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
-                         sqlite3_column_bytes(stmt, i));
-          break;
-        case SQLITE_NULL:
-        default:
-          v.set_asString("", 0);
-          v.set_isNull();
-          break;
-      }
-    }
-    result.records.push_back(res);
-  }
   if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
   {
     active = true;
@@ -996,6 +1137,156 @@ bool SqliteDataset::query(const std::string& query)
   }
 }
 
+bool SqliteDataset::query(const std::string& query, const BindList& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  close();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  bool prepared = false;
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->get_statement(query, prepared);
+  if (!stmt)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  int res = bind(stmt, params);
+  if (res == SQLITE_OK)
+  {
+    fetch_rows(stmt);
+    res = sqlite3_reset(stmt);
+  }
+  sqlite3_clear_bindings(stmt);
+
+  db->record_statement(query, prepared, std::chrono::steady_clock::now() - start);
+
+  if (db->setErr(res, query.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  active = true;
+  ds_state = dsSelect;
+  this->first();
+  return true;
+}
+
+int SqliteDataset::exec(const std::string& sql, const BindList& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  exec_res.clear();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  bool prepared = false;
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->get_statement(sql, prepared);
+  if (!stmt)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  int res = bind(stmt, params);
+  if (res == SQLITE_OK)
+  {
+    while ((res = sqlite3_step(stmt)) == SQLITE_ROW)
+      ;
+    res = sqlite3_reset(stmt);
+  }
+  sqlite3_clear_bindings(stmt);
+
+  const auto end = std::chrono::steady_clock::now();
+  db->record_statement(sql, prepared, end - start);
+
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for query: {}", duration.count(), sql);
+
+  if (db->setErr(res, sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  return res;
+}
+
+bool SqliteDataset::query_cursor(const std::string& query, const BindList& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  close();
+
+  // the cursor gets a statement of its own as long as it is open, a cached statement could
+  // be needed by another dataset in the meantime
+  if (db->setErr(sqlite3_prepare_v2(handle(), query.c_str(), -1, &cursor, nullptr),
+                 query.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  if (db->setErr(bind(cursor, params), query.c_str()) != SQLITE_OK)
+  {
+    close_cursor();
+    throw DbErrors("%s", db->getErrorMsg());
+  }
+
+  active = true;
+  return true;
+}
+
+bool SqliteDataset::step()
+{
+  if (!cursor)
+    return false;
+
+  const int res = sqlite3_step(cursor);
+  if (res == SQLITE_ROW)
+    return true;
+
+  // stepping a finished statement would run it again
+  if (res == SQLITE_DONE)
+  {
+    close_cursor();
+    return false;
+  }
+
+  db->setErr(res, sqlite3_sql(cursor));
+  DbErrors err("%s", db->getErrorMsg());
+  close_cursor();
+  throw err;
+}
+
+int SqliteDataset::column_count()
+{
+  return cursor ? sqlite3_column_count(cursor) : 0;
+}
+
+bool SqliteDataset::column_is_null(int col)
+{
+  return sqlite3_column_type(cursor, col) == SQLITE_NULL;
+}
+
+int64_t SqliteDataset::column_int64(int col)
+{
+  return sqlite3_column_int64(cursor, col);
+}
+
+double SqliteDataset::column_double(int col)
+{
+  return sqlite3_column_double(cursor, col);
+}
+
+std::string_view SqliteDataset::column_text(int col)
+{
+  const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(cursor, col));
+  if (!text)
+    return {};
+  return {text, static_cast<size_t>(sqlite3_column_bytes(cursor, col))};
+}
+
+void SqliteDataset::close_cursor()
+{
+  if (cursor)
+  {
+    sqlite3_finalize(cursor);
+    cursor = nullptr;
+  }
+}
+
 void SqliteDataset::open(const std::string& sql)
 {
   set_select_sql(sql);
@@ -1017,6 +1308,7 @@ void SqliteDataset::open()
 void SqliteDataset::close()
 {
   Dataset::close();
+  close_cursor();
   result.clear();
   edit_object->clear();
   fields_object->clear();
@@ -1037,7 +1329,7 @@ void SqliteDataset::cancel()
 
 int SqliteDataset::num_rows()
 {
-  return static_cast<int>(result.records.size());
+  return static_cast<int>(result.size());
 }
 
 bool SqliteDataset::eof()
@@ -15,8 +15,10 @@
 #include "dataset.h"
 
 #include <string>
+#include <unordered_map>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace dbiplus
 {
@@ -32,6 +34,17 @@ protected:
   sqlite3* conn{nullptr};
   bool _in_transaction{false};
 
+  /* prepared statements of queries with bound values */
+  struct CachedStatement
+  {
+    sqlite3_stmt* stmt{nullptr};
+    uint64_t last_used{0};
+  };
+  std::unordered_map<std::string, CachedStatement> statements;
+  uint64_t statement_clock{0};
+
+  void finalize_statements();
+
 public:
   /* default constructor */
   SqliteDatabase();
@@ -83,6 +96,10 @@ public:
   std::string vprepare(std::string_view format, va_list args) override;
 
   bool in_transaction() override { return _in_transaction; }
+
+  /* func. returns the cached prepared statement for sql, ready for binding.
+     prepared is set if the statement wasn't in the cache */
+  sqlite3_stmt* get_statement(const std::string& sql, bool& prepared);
 };
 
 /***************** Class SqliteDataset definition *******************
@@ -96,6 +113,10 @@ class SqliteDataset : public Dataset
 protected:
   sqlite3* handle();
 
+  /* statement of an open forward-only cursor */
+  sqlite3_stmt* cursor{nullptr};
+  void close_cursor();
+
   /* Makes direct queries to database */
   virtual void make_query(StringList& _sql);
   /* Makes direct inserts into database */
@@ -112,6 +133,12 @@ protected:
   void fill_fields() override;
   /* Changing field values during dataset navigation */
   virtual void free_row(); // free the memory allocated for the current row
+  /* Reads all rows of a stepped statement into the result set */
+  void fetch_rows(sqlite3_stmt* stmt);
+  /* Reads all rows of a stepped statement into the column store of the result set */
+  void fetch_columns(sqlite3_stmt* stmt, unsigned int numColumns);
+  /* Binds params to a cached statement, returns the sqlite result code */
+  int bind(sqlite3_stmt* stmt, const BindList& params);
 
 public:
   /* constructor */
@@ -130,9 +157,19 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  int exec(const std::string& sql, const BindList& params) override;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  bool query(const std::string& query, const BindList& params) override;
+  /* forward-only cursor */
+  bool query_cursor(const std::string& query, const BindList& params) override;
+  bool step() override;
+  int column_count() override;
+  bool column_is_null(int col) override;
+  int64_t column_int64(int col) override;
+  double column_double(int col) override;
+  std::string_view column_text(int col) override;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
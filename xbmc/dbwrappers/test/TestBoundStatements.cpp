@@ -0,0 +1,128 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TestHelpers.h"
+#include "dbwrappers/Database.h"
+#include "dbwrappers/sqlitedataset.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+class TestBoundStatements : public CSqliteDatabaseTest
+{
+protected:
+  TestBoundStatements() : CSqliteDatabaseTest("TestBoundStatements.db") {}
+
+  void SetUp() override
+  {
+    ASSERT_NO_FATAL_FAILURE(CSqliteDatabaseTest::SetUp());
+    m_ds->exec("DROP TABLE IF EXISTS path");
+    m_ds->exec("CREATE TABLE path (idPath INTEGER PRIMARY KEY, strPath TEXT, rating REAL)");
+  }
+};
+
+TEST_F(TestBoundStatements, RoundTrip)
+{
+  // quotes and placeholders in values are plain data
+  const std::string path = "/media/it's a ?/";
+  m_ds->exec("INSERT INTO path (idPath, strPath, rating) VALUES (?, ?, ?)",
+             CDatabase::Bind(7, path, 8.5));
+
+  field_value null;
+  null.set_isNull();
+  m_ds->exec("INSERT INTO path (idPath, strPath, rating) VALUES (?, ?, ?)",
+             {field_value(8), field_value("/other/"), null});
+
+  ASSERT_TRUE(m_ds->query("SELECT idPath, rating FROM path WHERE strPath=?", CDatabase::Bind(path)));
+  ASSERT_EQ(1, m_ds->num_rows());
+  EXPECT_EQ(7, m_ds->fv(0).get_asInt());
+  EXPECT_DOUBLE_EQ(8.5, m_ds->fv(1).get_asDouble());
+
+  ASSERT_TRUE(m_ds->query("SELECT rating FROM path WHERE idPath=?", CDatabase::Bind(8)));
+  ASSERT_EQ(1, m_ds->num_rows());
+  EXPECT_TRUE(m_ds->fv(0).get_isNull());
+}
+
+TEST_F(TestBoundStatements, StatementCache)
+{
+  const std::string sql = "SELECT idPath FROM path WHERE idPath=?";
+  for (int i = 0; i < 3; ++i)
+  {
+    ASSERT_TRUE(m_ds->query(sql, CDatabase::Bind(i)));
+    EXPECT_EQ(0, m_ds->num_rows());
+  }
+
+  const auto& stats = m_db.get_statement_stats();
+  ASSERT_EQ(1u, stats.count(sql));
+  EXPECT_EQ(3u, stats.at(sql).executions);
+  EXPECT_EQ(1u, stats.at(sql).prepares);
+
+  // evicted statements are prepared again
+  for (int i = 0; i < 100; ++i)
+    m_ds->query("SELECT idPath FROM path WHERE idPath=? + " + std::to_string(i),
+                CDatabase::Bind(i));
+  ASSERT_TRUE(m_ds->query(sql, CDatabase::Bind(1)));
+  EXPECT_EQ(2u, stats.at(sql).prepares);
+}
+
+TEST_F(TestBoundStatements, WrongParameterCount)
+{
+  EXPECT_THROW(m_ds->query("SELECT idPath FROM path WHERE idPath=?", {}), DbErrors);
+  EXPECT_THROW(m_ds->exec("DELETE FROM path WHERE idPath=?", CDatabase::Bind(1, 2)), DbErrors);
+
+  // the statement is still usable afterwards
+  EXPECT_TRUE(m_ds->query("SELECT idPath FROM path WHERE idPath=?", CDatabase::Bind(1)));
+}
+
+TEST_F(TestBoundStatements, Cursor)
+{
+  for (int i = 1; i <= 3; ++i)
+    m_ds->exec("INSERT INTO path (idPath, strPath, rating) VALUES (?, ?, ?)",
+               CDatabase::Bind(i, "/path" + std::to_string(i) + "/", i * 1.5));
+  m_ds->exec("INSERT INTO path (idPath) VALUES (?)", CDatabase::Bind(4));
+
+  ASSERT_TRUE(m_ds->query_cursor("SELECT idPath, strPath, rating FROM path WHERE idPath > ? "
+                                 "ORDER BY idPath",
+                                 CDatabase::Bind(1)));
+  EXPECT_EQ(3, m_ds->column_count());
+
+  ASSERT_TRUE(m_ds->step());
+  EXPECT_EQ(2, m_ds->column_int(0));
+  EXPECT_EQ("/path2/", m_ds->column_text(1));
+  EXPECT_DOUBLE_EQ(3.0, m_ds->column_double(2));
+  EXPECT_FALSE(m_ds->column_is_null(2));
+
+  // the cursor doesn't block other datasets on the same connection
+  std::unique_ptr<Dataset> other(m_db.CreateDataset());
+  ASSERT_TRUE(other->query("SELECT COUNT(1) FROM path"));
+  EXPECT_EQ(4, other->fv(0).get_asInt());
+
+  ASSERT_TRUE(m_ds->step());
+  EXPECT_EQ(3, m_ds->column_int(0));
+
+  ASSERT_TRUE(m_ds->step());
+  EXPECT_EQ(4, m_ds->column_int(0));
+  EXPECT_TRUE(m_ds->column_is_null(1));
+  EXPECT_TRUE(m_ds->column_text(1).empty());
+  EXPECT_EQ(0, m_ds->column_int64(2));
+
+  EXPECT_FALSE(m_ds->step());
+  EXPECT_FALSE(m_ds->step());
+  m_ds->close();
+  EXPECT_FALSE(m_ds->step());
+
+  // a cursor can be closed before all rows were read and the dataset reused
+  ASSERT_TRUE(m_ds->query_cursor("SELECT idPath FROM path", {}));
+  ASSERT_TRUE(m_ds->step());
+  ASSERT_TRUE(m_ds->query("SELECT idPath FROM path WHERE idPath=?", CDatabase::Bind(3)));
+  EXPECT_EQ(1, m_ds->num_rows());
+}
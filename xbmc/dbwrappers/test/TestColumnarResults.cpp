@@ -0,0 +1,172 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TestHelpers.h"
+#include "dbwrappers/sqlitedataset.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#if defined(TARGET_POSIX)
+#include <sys/resource.h>
+#endif
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+class TestColumnarResults : public CSqliteDatabaseTest
+{
+protected:
+  TestColumnarResults() : CSqliteDatabaseTest("TestColumnarResults.db") {}
+
+  void SetUp() override
+  {
+    ASSERT_NO_FATAL_FAILURE(CSqliteDatabaseTest::SetUp());
+    m_ds->exec("DROP TABLE IF EXISTS song");
+    m_ds->exec("CREATE TABLE song (idSong INTEGER PRIMARY KEY, strTitle TEXT, "
+               "strArtistDisp TEXT, iTrack INTEGER, iDuration INTEGER, rating FLOAT, "
+               "strFileName TEXT, comment TEXT)");
+  }
+
+  void AddSongs(int count)
+  {
+    m_db.start_transaction();
+    for (int i = 1; i <= count; ++i)
+      m_ds->exec("INSERT INTO song VALUES (?, ?, ?, ?, ?, ?, ?, ?)",
+                 {field_value(i), field_value(("Title " + std::to_string(i)).c_str()),
+                  field_value(("Artist " + std::to_string(i % 500)).c_str()), field_value(i % 20),
+                  field_value(180 + i % 300), field_value(static_cast<double>(i % 10) / 2),
+                  field_value(("/music/album " + std::to_string(i / 12) + "/track " +
+                               std::to_string(i % 12) + ".flac")
+                                  .c_str()),
+                  field_value("")});
+    m_db.commit_transaction();
+  }
+};
+
+TEST_F(TestColumnarResults, ColumnStore)
+{
+  column_store store;
+  store.reset(2);
+  store.add_int(0, 42);
+  store.add_text(1, "it's", 4);
+  store.add_double(0, 1.5);
+  store.add_null(1);
+  store.add_int64(0, int64_t{1} << 40);
+  store.add_text(1, "", 0);
+  ASSERT_EQ(3u, store.rows());
+
+  field_value value;
+  store.get(0, 0, value);
+  EXPECT_EQ(42, value.get_asInt());
+  store.get(0, 1, value);
+  EXPECT_EQ("it's", value.get_asString());
+  store.get(1, 0, value);
+  EXPECT_DOUBLE_EQ(1.5, value.get_asDouble());
+  store.get(1, 1, value);
+  EXPECT_TRUE(value.get_isNull());
+  store.get(2, 1, value);
+  EXPECT_FALSE(value.get_isNull());
+  EXPECT_EQ("", value.get_asString());
+  store.get(2, 0, value);
+  EXPECT_EQ(int64_t{1} << 40, value.get_asInt64());
+}
+
+TEST_F(TestColumnarResults, SameAsRows)
+{
+  AddSongs(50);
+  m_ds->exec("UPDATE song SET comment=NULL WHERE idSong % 7 = 0");
+
+  const std::string sql = "SELECT * FROM song ORDER BY idSong";
+  ASSERT_TRUE(m_ds->query(sql));
+  std::unique_ptr<Dataset> columnar(m_db.CreateDataset());
+  columnar->set_columnar_results(true);
+  ASSERT_TRUE(columnar->query(sql));
+
+  ASSERT_EQ(m_ds->num_rows(), columnar->num_rows());
+  while (!m_ds->eof())
+  {
+    ASSERT_FALSE(columnar->eof());
+    const sql_record* row = m_ds->get_sql_record();
+    const sql_record* record = columnar->get_sql_record();
+    ASSERT_NE(nullptr, record);
+    for (int i = 0; i < m_ds->fieldCount(); ++i)
+    {
+      EXPECT_EQ(m_ds->fv(i).get_fType(), columnar->fv(i).get_fType());
+      EXPECT_EQ(m_ds->fv(i).get_isNull(), columnar->fv(i).get_isNull());
+      EXPECT_EQ(m_ds->fv(i).get_asString(), columnar->fv(i).get_asString());
+      EXPECT_EQ(row->at(i).get_asString(), record->at(i).get_asString());
+    }
+    EXPECT_EQ(m_ds->fv("strTitle").get_asString(), columnar->fv("strTitle").get_asString());
+    m_ds->next();
+    columnar->next();
+  }
+  EXPECT_TRUE(columnar->eof());
+
+  ASSERT_TRUE(columnar->seek(6));
+  EXPECT_EQ(7, columnar->fv("idSong").get_asInt());
+  EXPECT_TRUE(columnar->fv("comment").get_isNull());
+  ASSERT_TRUE(columnar->seek(7));
+  EXPECT_FALSE(columnar->fv("comment").get_isNull());
+
+  // any row can be read without moving the dataset
+  for (int row : {0, 49, 13})
+  {
+    const sql_record* record = columnar->get_sql_record(row);
+    ASSERT_NE(nullptr, record);
+    EXPECT_EQ(row + 1, record->at(0).get_asInt());
+    EXPECT_EQ("Title " + std::to_string(row + 1), record->at(1).get_asString());
+  }
+  EXPECT_EQ(nullptr, columnar->get_sql_record(50));
+  EXPECT_EQ(8, columnar->fv("idSong").get_asInt());
+}
+
+// benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(TestColumnarResults, DISABLED_SongTable)
+{
+  constexpr int ROWS = 200000;
+  AddSongs(ROWS);
+
+#if defined(TARGET_POSIX)
+  auto PeakRSS = []
+  {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<long>(usage.ru_maxrss);
+  };
+#else
+  auto PeakRSS = [] { return 0L; };
+#endif
+
+  // the peak can only grow, so the columnar run has to go first
+  const long peakBefore = PeakRSS();
+  for (bool columnarResults : {true, false})
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    m_ds->set_columnar_results(columnarResults);
+    ASSERT_TRUE(m_ds->query("SELECT * FROM song"));
+    ASSERT_EQ(ROWS, m_ds->num_rows());
+    int64_t sum = 0;
+    while (!m_ds->eof())
+    {
+      sum += m_ds->fv(0).get_asInt() + m_ds->fv("strTitle").get_asString().size();
+      m_ds->next();
+    }
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    const long peakAfter = PeakRSS();
+    m_ds->close();
+
+    std::cout << (columnarResults ? "columnar" : "rows") << ": " << elapsed.count() << " ms, "
+              << "peak RSS +" << peakAfter - peakBefore << " KiB (" << sum << ")\n";
+  }
+}
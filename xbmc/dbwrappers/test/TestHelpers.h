@@ -0,0 +1,49 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "dbwrappers/sqlitedataset.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+/*!
+ \brief Fixture providing an empty SQLite database in the temp directory and a dataset on it.
+ The database file is removed after each test.
+ */
+class CSqliteDatabaseTest : public ::testing::Test
+{
+protected:
+  explicit CSqliteDatabaseTest(std::string fileName) : m_fileName(std::move(fileName)) {}
+
+  void SetUp() override
+  {
+    m_db.setHostName(std::filesystem::temp_directory_path().string().c_str());
+    m_db.setDatabase(m_fileName.c_str());
+    ASSERT_EQ(dbiplus::DB_CONNECTION_OK, m_db.connect(true));
+
+    m_ds.reset(m_db.CreateDataset());
+  }
+
+  void TearDown() override
+  {
+    m_ds.reset();
+    m_db.disconnect();
+    std::filesystem::remove(std::filesystem::temp_directory_path() / m_fileName);
+  }
+
+  dbiplus::SqliteDatabase m_db;
+  std::unique_ptr<dbiplus::Dataset> m_ds;
+
+private:
+  std::string m_fileName;
+};
@@ -48,6 +48,16 @@ void CCacheStrategy::ClearEndOfInput()
   m_bEndOfInput = false;
 }
 
+bool CCacheStrategy::PreloadData(int64_t iFilePosition, const char* pBuffer, size_t iSize)
+{
+  return false;
+}
+
+size_t CCacheStrategy::CopyCachedData(int64_t iFilePosition, char* pBuffer, size_t iMaxSize)
+{
+  return 0;
+}
+
 CSimpleFileCache::CSimpleFileCache()
   : m_cacheFileRead(new CacheLocalFile())
   , m_cacheFileWrite(new CacheLocalFile())
@@ -445,3 +455,15 @@ CCacheStrategy *CDoubleCache::CreateNew()
   return new CDoubleCache(m_pCache->CreateNew());
 }
 
+bool CDoubleCache::PreloadData(int64_t iFilePosition, const char* pBuffer, size_t iSize)
+{
+  return m_pCache->PreloadData(iFilePosition, pBuffer, iSize);
+}
+
+size_t CDoubleCache::CopyCachedData(int64_t iFilePosition, char* pBuffer, size_t iMaxSize)
+{
+  size_t ret = m_pCache->CopyCachedData(iFilePosition, pBuffer, iMaxSize);
+  if (ret == 0 && m_pCacheOld)
+    ret = m_pCacheOld->CopyCachedData(iFilePosition, pBuffer, iMaxSize);
+  return ret;
+}
@@ -55,6 +55,21 @@ public:
 
   virtual CCacheStrategy *CreateNew() = 0;
 
+  /*!
+   \brief Store data obtained elsewhere (e.g. in an earlier session) without moving the read or
+          write position. Strategies that only hold a single window don't support this.
+   \param iFilePosition position in file of the data
+   \return Whether the data was stored
+   */
+  virtual bool PreloadData(int64_t iFilePosition, const char* pBuffer, size_t iSize);
+
+  /*!
+   \brief Copy cached data without moving the read position
+   \param iFilePosition position in file to copy from
+   \return Number of bytes copied, stops at the first position which is not cached
+   */
+  virtual size_t CopyCachedData(int64_t iFilePosition, char* pBuffer, size_t iMaxSize);
+
   CEvent m_space;
 protected:
   bool  m_bEndOfInput = false;
@@ -124,6 +139,9 @@ public:
 
   CCacheStrategy *CreateNew() override;
 
+  bool PreloadData(int64_t iFilePosition, const char* pBuffer, size_t iSize) override;
+  size_t CopyCachedData(int64_t iFilePosition, char* pBuffer, size_t iMaxSize) override;
+
 protected:
   CCacheStrategy *m_pCache;
   CCacheStrategy *m_pCacheOld;
@@ -9,11 +9,14 @@
 #include "FileCache.h"
 
 #include "CircularCache.h"
+#include "FileCacheStore.h"
+#include "SegmentedCache.h"
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/Thread.h"
+#include "utils/URIUtils.h"
 #include "utils/log.h"
 
 #include <mutex>
@@ -173,17 +176,25 @@ bool CFileCache::Open(const CURL& url)
           cacheSize = m_chunkSize * 2;
       }
 
+      // Keeping several cached ranges only pays off if the source can seek to their end
+      const bool segmented =
+          m_seekPossible > 0 && settings->GetBool(CSettings::SETTING_FILECACHE_SEGMENTED);
+
       if (m_flags & READ_MULTI_STREAM)
-        CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using double memory cache each sized {} bytes",
-                  __FUNCTION__, m_sourcePath, cacheSize);
+        CLog::Log(LOGDEBUG,
+                  "CFileCache::{} - <{}> using double {} memory cache each sized {} bytes",
+                  __FUNCTION__, m_sourcePath, segmented ? "segmented" : "circular", cacheSize);
       else
-        CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using single memory cache sized {} bytes",
-                  __FUNCTION__, m_sourcePath, cacheSize);
+        CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using single {} memory cache sized {} bytes",
+                  __FUNCTION__, m_sourcePath, segmented ? "segmented" : "circular", cacheSize);
 
       const size_t back = cacheSize / 4;
       const size_t front = cacheSize - back;
 
-      m_pCache = std::make_unique<CCircularCache>(front, back);
+      if (segmented)
+        m_pCache = std::make_unique<CSegmentedCache>(front, back);
+      else
+        m_pCache = std::make_unique<CCircularCache>(front, back);
       m_forwardCacheSize = front;
       m_maxForward = m_forwardCacheSize;
     }
@@ -205,6 +216,15 @@ bool CFileCache::Open(const CURL& url)
 
   m_readPos = 0;
   m_writePos = 0;
+
+  m_storeKey.clear();
+  m_storeLoaded = 0;
+  m_storeMaxSize =
+      static_cast<uint64_t>(settings->GetInt(CSettings::SETTING_FILECACHE_PERSISTENTSIZE)) * 1024 *
+      1024;
+  if (m_storeMaxSize > 0 && m_seekPossible > 0 && URIUtils::IsRemote(url.Get()))
+    LoadFromStore(url.Get());
+
   m_writeRate = 1024 * 1024;
   m_writeRateActual = 0;
   m_writeRateLowSpeed = 0;
@@ -217,6 +237,79 @@ bool CFileCache::Open(const CURL& url)
   return true;
 }
 
+void CFileCache::LoadFromStore(const std::string& url)
+{
+  m_storeKey = CFileCacheStore::GetKey(url, m_source, m_fileSize);
+  if (m_storeKey.empty())
+    return;
+
+  std::vector<CFileCacheStore::Segment> segments;
+  if (!CFileCacheStore::Load(m_storeKey, segments))
+    return;
+
+  for (const auto& segment : segments)
+  {
+    // only supported by cache strategies keeping multiple ranges
+    if (!m_pCache->PreloadData(segment.position, segment.data.data(), segment.data.size()))
+      break;
+    m_storeLoaded += segment.data.size();
+  }
+
+  // continue reading the source after the stored head of the file
+  const int64_t cachedEnd = m_pCache->CachedDataEndPosIfSeekTo(0);
+  if (cachedEnd > 0 && m_source.Seek(cachedEnd, SEEK_SET) == cachedEnd)
+  {
+    m_pCache->Reset(0);
+    m_writePos = cachedEnd;
+  }
+
+  CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> preloaded {} bytes from persistent cache",
+            __FUNCTION__, m_sourcePath, m_storeLoaded);
+}
+
+bool CFileCache::GetStoreSegments(std::vector<CFileCacheStore::Segment>& segments) const
+{
+  const int64_t fileSize = m_fileSize;
+  const std::pair<int64_t, int64_t> ranges[] = {
+      {0, std::min(CFileCacheStore::HEAD_SIZE, fileSize)},
+      {std::max(CFileCacheStore::HEAD_SIZE, fileSize - CFileCacheStore::TAIL_SIZE), fileSize}};
+
+  // granularity used to look for cached data after a position which isn't cached
+  constexpr int64_t probeSize = 64 * 1024;
+
+  size_t total = 0;
+  for (const auto& [begin, end] : ranges)
+  {
+    if (begin >= end)
+      continue;
+
+    std::vector<char> buffer(end - begin);
+    int64_t pos = begin;
+    while (pos < end)
+    {
+      char* data = buffer.data() + (pos - begin);
+      const size_t copied = m_pCache->CopyCachedData(pos, data, end - pos);
+      if (copied == 0)
+      {
+        pos = (pos / probeSize + 1) * probeSize;
+        continue;
+      }
+
+      segments.push_back({pos, std::vector<char>(data, data + copied)});
+      pos += copied;
+      total += copied;
+    }
+  }
+
+  // don't rewrite the entry unless this session cached more of the file
+  if (total <= m_storeLoaded)
+    return false;
+
+  CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> storing {} bytes in persistent cache", __FUNCTION__,
+            m_sourcePath, total);
+  return true;
+}
+
 void CFileCache::Process()
 {
   if (!m_pCache)
@@ -579,11 +672,24 @@ void CFileCache::Close()
 {
   StopThread();
 
-  std::unique_lock lock(m_sync);
-  if (m_pCache)
-    m_pCache->Close();
+  std::string storeKey;
+  std::vector<CFileCacheStore::Segment> segments;
+  {
+    std::unique_lock lock(m_sync);
+    if (m_pCache)
+    {
+      if (!m_storeKey.empty() && GetStoreSegments(segments))
+        storeKey = m_storeKey;
+      m_pCache->Close();
+    }
+    m_storeKey.clear();
+
+    m_source.Close();
+  }
 
-  m_source.Close();
+  // writing the entry may take a while, don't block readers of this cache meanwhile
+  if (!storeKey.empty())
+    CFileCacheStore::Save(storeKey, segments, m_storeMaxSize);
 }
 
 int64_t CFileCache::GetPosition()
@@ -10,6 +10,7 @@
 
 #include "CacheStrategy.h"
 #include "File.h"
+#include "FileCacheStore.h"
 #include "IFile.h"
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
@@ -17,6 +18,8 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <string>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -58,6 +61,13 @@ namespace XFILE
     }
 
   private:
+    void LoadFromStore(const std::string& url);
+    /*!
+     \brief Copy the head and tail of the file from the cache for the persistent store
+     \return true if they hold more data than was loaded from the store
+     */
+    bool GetStoreSegments(std::vector<CFileCacheStore::Segment>& segments) const;
+
     std::unique_ptr<CCacheStrategy> m_pCache;
     int m_seekPossible = 0;
     CFile m_source;
@@ -79,6 +89,9 @@ namespace XFILE
     unsigned int m_flags;
     CCriticalSection m_sync;
     std::chrono::milliseconds m_processWait{100ms};
+    std::string m_storeKey;
+    uint64_t m_storeMaxSize = 0;
+    size_t m_storeLoaded = 0;
   };
 
 }
@@ -0,0 +1,223 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileCacheStore.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "threads/CriticalSection.h"
+#include "utils/Digest.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+using namespace XFILE;
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+constexpr const char* STORE_PATH = "special://temp/filecache/";
+constexpr const char* STORE_EXT = ".kfc";
+constexpr char STORE_MAGIC[4] = {'K', 'F', 'C', 'S'};
+constexpr uint32_t STORE_VERSION = 1;
+constexpr uint32_t MAX_SEGMENTS = 64;
+
+CCriticalSection storeSection;
+
+bool ReadAll(CFile& file, void* buffer, size_t size)
+{
+  return file.Read(buffer, size) == static_cast<ssize_t>(size);
+}
+
+bool WriteAll(CFile& file, const void* buffer, size_t size)
+{
+  return file.Write(buffer, size) == static_cast<ssize_t>(size);
+}
+} // namespace
+
+std::string CFileCacheStore::GetKey(const std::string& url, CFile& source, int64_t fileSize)
+{
+  if (fileSize <= 0)
+    return "";
+
+  std::string validator = source.GetProperty(FileProperty::RESPONSE_HEADER, "etag");
+  if (validator.empty())
+  {
+    struct __stat64 st = {};
+    if (source.Stat(&st) == 0 && st.st_mtime != 0)
+      validator = std::to_string(st.st_mtime);
+  }
+
+  // without a validator a changed file could be served from stale data
+  if (validator.empty())
+    return "";
+
+  return CDigest::Calculate(CDigest::Type::MD5,
+                            url + '\n' + std::to_string(fileSize) + '\n' + validator);
+}
+
+std::string CFileCacheStore::GetPath(const std::string& key)
+{
+  return STORE_PATH + key + STORE_EXT;
+}
+
+bool CFileCacheStore::Load(const std::string& key, std::vector<Segment>& segments)
+{
+  segments.clear();
+
+  const std::string path = GetPath(key);
+
+  std::unique_lock lock(storeSection);
+  if (!CFile::Exists(path))
+    return false;
+
+  CFile file;
+  if (!file.Open(path))
+    return false;
+
+  char magic[sizeof(STORE_MAGIC)];
+  uint32_t version = 0;
+  uint32_t count = 0;
+  if (!ReadAll(file, magic, sizeof(magic)) || memcmp(magic, STORE_MAGIC, sizeof(magic)) != 0 ||
+      !ReadAll(file, &version, sizeof(version)) || version != STORE_VERSION ||
+      !ReadAll(file, &count, sizeof(count)) || count > MAX_SEGMENTS)
+  {
+    CLog::Log(LOGWARNING, "CFileCacheStore::{} - invalid store entry {}, removing", __FUNCTION__,
+              path);
+    file.Close();
+    CFile::Delete(path);
+    return false;
+  }
+
+  const int64_t length = file.GetLength();
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    int64_t position = 0;
+    uint32_t size = 0;
+    if (!ReadAll(file, &position, sizeof(position)) || !ReadAll(file, &size, sizeof(size)) ||
+        position < 0 || static_cast<int64_t>(size) > length - file.GetPosition())
+    {
+      segments.clear();
+      return false;
+    }
+
+    Segment& segment = segments.emplace_back();
+    segment.position = position;
+    segment.data.resize(size);
+    if (!ReadAll(file, segment.data.data(), size))
+    {
+      segments.clear();
+      return false;
+    }
+  }
+  file.Close();
+
+  if (segments.empty())
+    return false;
+
+  // Prune() removes the entries with the oldest modification time first. Rewriting the magic
+  // bumps it, so that entries in use are kept.
+  CFile touch;
+  if (touch.OpenForWrite(path, false))
+  {
+    WriteAll(touch, STORE_MAGIC, sizeof(STORE_MAGIC));
+    touch.Close();
+  }
+  return true;
+}
+
+void CFileCacheStore::Save(const std::string& key,
+                           const std::vector<Segment>& segments,
+                           uint64_t maxStoreSize)
+{
+  if (segments.empty())
+    return;
+
+  if (segments.size() > MAX_SEGMENTS)
+  {
+    CLog::Log(LOGINFO,
+              "CFileCacheStore::{} - not storing {}, {} cached ranges exceed the limit of {}",
+              __FUNCTION__, key, segments.size(), MAX_SEGMENTS);
+    return;
+  }
+
+  const std::string path = GetPath(key);
+  const std::string tmpPath = path + ".tmp";
+
+  std::unique_lock lock(storeSection);
+  if (!CDirectory::Exists(STORE_PATH) && !CDirectory::Create(STORE_PATH))
+    return;
+
+  // write to a temporary file first, so concurrent readers never see a partial entry
+  CFile file;
+  if (!file.OpenForWrite(tmpPath, true))
+  {
+    CLog::Log(LOGERROR, "CFileCacheStore::{} - unable to create {}", __FUNCTION__, tmpPath);
+    return;
+  }
+
+  const uint32_t count = static_cast<uint32_t>(segments.size());
+  bool ok = WriteAll(file, STORE_MAGIC, sizeof(STORE_MAGIC)) &&
+            WriteAll(file, &STORE_VERSION, sizeof(STORE_VERSION)) &&
+            WriteAll(file, &count, sizeof(count));
+
+  for (const auto& segment : segments)
+  {
+    if (!ok)
+      break;
+
+    const uint32_t size = static_cast<uint32_t>(segment.data.size());
+    ok = WriteAll(file, &segment.position, sizeof(segment.position)) &&
+         WriteAll(file, &size, sizeof(size)) && WriteAll(file, segment.data.data(), size);
+  }
+  file.Close();
+
+  // renaming doesn't replace an existing file on every platform
+  if (ok && CFile::Exists(path))
+    ok = CFile::Delete(path);
+
+  if (!ok || !CFile::Rename(tmpPath, path))
+  {
+    CLog::Log(LOGERROR, "CFileCacheStore::{} - unable to write {}", __FUNCTION__, path);
+    CFile::Delete(tmpPath);
+    return;
+  }
+
+  Prune(maxStoreSize);
+}
+
+void CFileCacheStore::Prune(uint64_t maxStoreSize)
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(STORE_PATH, items, STORE_EXT, DIR_FLAG_NO_FILE_DIRS))
+    return;
+
+  uint64_t total = 0;
+  for (const auto& item : items)
+    total += item->GetSize();
+
+  if (total <= maxStoreSize)
+    return;
+
+  std::vector<std::shared_ptr<CFileItem>> entries(items.cbegin(), items.cend());
+  std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b)
+            { return a->GetDateTime() < b->GetDateTime(); });
+
+  for (const auto& entry : entries)
+  {
+    if (total <= maxStoreSize)
+      break;
+
+    if (CFile::Delete(entry->GetPath()))
+      total -= entry->GetSize();
+  }
+}
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace XFILE
+{
+class CFile;
+
+/*!
+ \brief Size bounded on-disk store for parts of remote files read by CFileCache.
+
+ Entries are keyed by the URL and a validator of the file content (ETag or modification time
+ together with the size), so a changed file is never served from stale data. The store keeps
+ the head and tail of files, which are read by every player, scanner and thumbnail extractor
+ opening the file. The least recently used entries are removed once the store exceeds its size
+ limit.
+ */
+class CFileCacheStore
+{
+public:
+  struct Segment
+  {
+    int64_t position;
+    std::vector<char> data;
+  };
+
+  /*!
+   \brief Build the key of an opened source file
+   \return The key or an empty string if the content of the file can't be validated
+   */
+  static std::string GetKey(const std::string& url, CFile& source, int64_t fileSize);
+
+  static bool Load(const std::string& key, std::vector<Segment>& segments);
+  static void Save(const std::string& key,
+                   const std::vector<Segment>& segments,
+                   uint64_t maxStoreSize);
+
+  static constexpr int64_t HEAD_SIZE = 2 * 1024 * 1024;
+  static constexpr int64_t TAIL_SIZE = 2 * 1024 * 1024;
+
+private:
+  static std::string GetPath(const std::string& key);
+  static void Prune(uint64_t maxStoreSize);
+};
+
+} // namespace XFILE
@@ -0,0 +1,440 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SegmentedCache.h"
+
+#include "threads/SystemClock.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+CSegmentedCache::CSegmentedCache(size_t front, size_t back)
+  : m_size(front + back), m_size_front(front)
+{
+}
+
+CSegmentedCache::~CSegmentedCache()
+{
+  Close();
+}
+
+int CSegmentedCache::Open()
+{
+  std::unique_lock lock(m_sync);
+
+  // two extra blocks, as the read and write positions may each sit in a partially used block
+  const size_t blocks = (m_size + BLOCK_SIZE - 1) / BLOCK_SIZE + 2;
+
+  m_buf.reset(new (std::nothrow) uint8_t[blocks * BLOCK_SIZE]);
+  if (!m_buf)
+    return CACHE_RC_ERROR;
+
+  m_blocks.clear();
+  m_lru.clear();
+  m_freeSlots.clear();
+  m_freeSlots.reserve(blocks);
+  for (size_t slot = blocks; slot > 0; --slot)
+    m_freeSlots.push_back(slot - 1);
+
+  m_end = 0;
+  m_cur = 0;
+  m_evictions = 0;
+  m_cachedSeeks = 0;
+  return CACHE_RC_OK;
+}
+
+void CSegmentedCache::Close()
+{
+  std::unique_lock lock(m_sync);
+
+  if (m_buf)
+    CLog::Log(LOGDEBUG,
+              "CSegmentedCache::{} - ({}) {} blocks cached, {} evicted, {} seeks served from cache",
+              __FUNCTION__, fmt::ptr(this), m_blocks.size(), m_evictions, m_cachedSeeks);
+
+  m_blocks.clear();
+  m_lru.clear();
+  m_freeSlots.clear();
+  m_buf.reset();
+}
+
+size_t CSegmentedCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t front = static_cast<size_t>(m_end - m_cur);
+  const size_t limit = front < m_size_front ? m_size_front - front : 0;
+
+  // Never return more than limit and size requested by caller
+  return std::min(iRequestSize, limit);
+}
+
+/**
+ * Writes to the block holding m_end. It will only write up to the
+ * end of that block, so multiple calls may be needed.
+ *
+ * A new block is taken from the free pool or, if the pool is
+ * exhausted, by evicting the least recently used block outside
+ * of the current [m_cur, m_end] window.
+ */
+int CSegmentedCache::WriteToCache(const char* buf, size_t len)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t front = static_cast<size_t>(m_end - m_cur);
+  const size_t limit = front < m_size_front ? m_size_front - front : 0;
+
+  const int64_t index = m_end / BLOCK_SIZE;
+  const size_t offset = static_cast<size_t>(m_end % BLOCK_SIZE);
+
+  // limit by max forward size and block boundary
+  len = std::min({len, limit, BLOCK_SIZE - offset});
+
+  if (len == 0 || !m_buf)
+    return 0;
+
+  Block* block = FindBlock(index);
+  if (!block)
+    block = AcquireBlock(index);
+  if (!block)
+    return 0;
+
+  StoreInBlock(*block, offset, buf, len);
+  m_end += len;
+  TouchBlock(*block);
+
+  m_written.Set();
+
+  return static_cast<int>(len);
+}
+
+/**
+ * Reads data from cache. Will only read up till the
+ * end of the current block, so multiple calls
+ * may be needed to empty the whole cache
+ */
+int CSegmentedCache::ReadFromCache(char* buf, size_t len)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t front = static_cast<size_t>(m_end - m_cur);
+  if (front == 0)
+  {
+    if (IsEndOfInput())
+      return 0;
+    else
+      return CACHE_RC_WOULD_BLOCK;
+  }
+
+  if (len == 0 || !m_buf)
+    return 0;
+
+  const int64_t index = m_cur / BLOCK_SIZE;
+  const size_t offset = static_cast<size_t>(m_cur % BLOCK_SIZE);
+
+  Block* block = FindBlock(index);
+  if (!block || offset < block->start || offset >= block->end)
+  {
+    CLog::Log(LOGERROR, "CSegmentedCache::{} - ({}) no cached data at position {}", __FUNCTION__,
+              fmt::ptr(this), m_cur);
+    return CACHE_RC_ERROR;
+  }
+
+  len = std::min({len, front, block->end - offset});
+
+  memcpy(buf, m_buf.get() + block->slot * BLOCK_SIZE + offset, len);
+  m_cur += len;
+  TouchBlock(*block);
+
+  m_space.Set();
+
+  return static_cast<int>(len);
+}
+
+int64_t CSegmentedCache::WaitForData(uint32_t minimum, std::chrono::milliseconds timeout)
+{
+  std::unique_lock lock(m_sync);
+  int64_t avail = m_end - m_cur;
+
+  if (timeout == 0ms || IsEndOfInput())
+    return avail;
+
+  if (minimum > m_size_front)
+    minimum = static_cast<uint32_t>(m_size_front);
+
+  XbmcThreads::EndTime<> endtime{timeout};
+  while (!IsEndOfInput() && avail < minimum && !endtime.IsTimePast())
+  {
+    lock.unlock();
+    m_written.Wait(50ms); // may miss the deadline. shouldn't be a problem.
+    lock.lock();
+    avail = m_end - m_cur;
+  }
+
+  return avail;
+}
+
+int64_t CSegmentedCache::Seek(int64_t pos)
+{
+  std::unique_lock lock(m_sync);
+
+  // if seek is a bit over what we have, try to wait a few seconds for the data to be available.
+  // we try to avoid a (heavy) seek on the source
+  if (pos >= m_end && pos < m_end + 100000)
+  {
+    // Move everything to history to make sure there's sufficient forward space
+    m_cur = m_end;
+
+    lock.unlock();
+    WaitForData(static_cast<uint32_t>(pos - m_cur), 5s);
+    lock.lock();
+
+    if (pos > m_end)
+      CLog::Log(LOGDEBUG,
+                "CSegmentedCache::{} - ({}) Wait for data failed for pos {}, ended up at {}",
+                __FUNCTION__, fmt::ptr(this), pos, m_cur);
+  }
+
+  // only positions connected to the write position can be served without a source seek
+  if (pos >= m_cur && pos <= m_end)
+  {
+    m_cur = pos;
+    return pos;
+  }
+
+  if (pos < m_cur && IsCachedPosition(pos) && GetContiguousEnd(pos) >= m_end)
+  {
+    m_cur = pos;
+    m_cachedSeeks++;
+    return pos;
+  }
+
+  return CACHE_RC_ERROR;
+}
+
+bool CSegmentedCache::Reset(int64_t pos)
+{
+  std::unique_lock lock(m_sync);
+  if (IsCachedPosition(pos))
+  {
+    // continue filling at the end of the cached range holding pos, other ranges are kept
+    if (pos != m_end)
+      m_cachedSeeks++;
+    m_end = GetContiguousEnd(pos);
+    m_cur = pos;
+    return false;
+  }
+  m_end = pos;
+  m_cur = pos;
+
+  return true;
+}
+
+int64_t CSegmentedCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  if (IsCachedPosition(iFilePosition))
+    return GetContiguousEnd(iFilePosition);
+  return iFilePosition;
+}
+
+int64_t CSegmentedCache::CachedDataStartPos()
+{
+  std::unique_lock lock(m_sync);
+
+  int64_t beg = m_cur;
+  while (beg > 0)
+  {
+    const int64_t index = (beg - 1) / BLOCK_SIZE;
+    const size_t offset = static_cast<size_t>(beg - index * BLOCK_SIZE);
+
+    const Block* block = FindBlock(index);
+    if (!block || block->start >= offset || block->end < offset)
+      break;
+
+    beg = index * BLOCK_SIZE + block->start;
+    if (block->start > 0)
+      break;
+  }
+
+  return beg;
+}
+
+int64_t CSegmentedCache::CachedDataEndPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_end;
+}
+
+bool CSegmentedCache::IsCachedPosition(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  if (iFilePosition == m_end)
+    return true;
+
+  if (iFilePosition < 0)
+    return false;
+
+  const Block* block = FindBlock(iFilePosition / BLOCK_SIZE);
+  const size_t offset = static_cast<size_t>(iFilePosition % BLOCK_SIZE);
+  return block && offset >= block->start && offset < block->end;
+}
+
+CCacheStrategy* CSegmentedCache::CreateNew()
+{
+  return new CSegmentedCache(m_size_front, m_size - m_size_front);
+}
+
+/**
+ * Stores the data as history blocks. Blocks holding unread data are
+ * never replaced, preloading stops when no more blocks can be evicted.
+ */
+bool CSegmentedCache::PreloadData(int64_t iFilePosition, const char* pBuffer, size_t iSize)
+{
+  std::unique_lock lock(m_sync);
+
+  if (!m_buf || iFilePosition < 0)
+    return false;
+
+  while (iSize > 0)
+  {
+    const int64_t index = iFilePosition / BLOCK_SIZE;
+    const size_t offset = static_cast<size_t>(iFilePosition % BLOCK_SIZE);
+    const size_t len = std::min(iSize, BLOCK_SIZE - offset);
+
+    Block* block = FindBlock(index);
+    if (block && IsProtectedBlock(index) && (offset > block->end || offset + len < block->start))
+      return false; // don't drop data of the current window
+
+    if (!block)
+      block = AcquireBlock(index);
+    if (!block)
+      return false;
+
+    StoreInBlock(*block, offset, pBuffer, len);
+
+    iFilePosition += len;
+    pBuffer += len;
+    iSize -= len;
+  }
+
+  return true;
+}
+
+size_t CSegmentedCache::CopyCachedData(int64_t iFilePosition, char* pBuffer, size_t iMaxSize)
+{
+  std::unique_lock lock(m_sync);
+
+  size_t copied = 0;
+  while (m_buf && iFilePosition >= 0 && copied < iMaxSize)
+  {
+    const int64_t index = iFilePosition / BLOCK_SIZE;
+    const size_t offset = static_cast<size_t>(iFilePosition % BLOCK_SIZE);
+
+    const Block* block = FindBlock(index);
+    if (!block || offset < block->start || offset >= block->end)
+      break;
+
+    const size_t len = std::min(iMaxSize - copied, block->end - offset);
+    memcpy(pBuffer + copied, m_buf.get() + block->slot * BLOCK_SIZE + offset, len);
+
+    iFilePosition += len;
+    copied += len;
+  }
+
+  return copied;
+}
+
+CSegmentedCache::Block* CSegmentedCache::FindBlock(int64_t index)
+{
+  const auto it = m_blocks.find(index);
+  if (it == m_blocks.end())
+    return nullptr;
+  return &it->second;
+}
+
+CSegmentedCache::Block* CSegmentedCache::AcquireBlock(int64_t index)
+{
+  size_t slot;
+  if (!m_freeSlots.empty())
+  {
+    slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  }
+  else
+  {
+    const auto victim = std::find_if(m_lru.rbegin(), m_lru.rend(), [this](int64_t lruIndex)
+                                     { return !IsProtectedBlock(lruIndex); });
+    if (victim == m_lru.rend())
+      return nullptr;
+
+    const auto it = m_blocks.find(*victim);
+    slot = it->second.slot;
+    m_lru.erase(it->second.lru);
+    m_blocks.erase(it);
+    m_evictions++;
+  }
+
+  m_lru.push_front(index);
+  const auto result = m_blocks.emplace(index, Block{slot, 0, 0, m_lru.begin()});
+  return &result.first->second;
+}
+
+void CSegmentedCache::StoreInBlock(Block& block, size_t offset, const char* buf, size_t len)
+{
+  // data is appended to the valid range if adjacent, else it replaces the stale range
+  if (offset > block.end || offset + len < block.start)
+  {
+    block.start = offset;
+    block.end = offset + len;
+  }
+  else
+  {
+    block.start = std::min(block.start, offset);
+    block.end = std::max(block.end, offset + len);
+  }
+
+  memcpy(m_buf.get() + block.slot * BLOCK_SIZE + offset, buf, len);
+}
+
+void CSegmentedCache::TouchBlock(Block& block)
+{
+  if (block.lru != m_lru.begin())
+    m_lru.splice(m_lru.begin(), m_lru, block.lru);
+}
+
+bool CSegmentedCache::IsProtectedBlock(int64_t index) const
+{
+  return index >= m_cur / static_cast<int64_t>(BLOCK_SIZE) &&
+         index <= m_end / static_cast<int64_t>(BLOCK_SIZE);
+}
+
+int64_t CSegmentedCache::GetContiguousEnd(int64_t pos)
+{
+  int64_t end = pos;
+  while (end >= 0)
+  {
+    const int64_t index = end / BLOCK_SIZE;
+    const size_t offset = static_cast<size_t>(end % BLOCK_SIZE);
+
+    const Block* block = FindBlock(index);
+    if (!block || offset < block->start || offset >= block->end)
+      break;
+
+    end = index * BLOCK_SIZE + block->end;
+    if (block->end < BLOCK_SIZE)
+      break;
+  }
+
+  return end;
+}
@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "CacheStrategy.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace XFILE
+{
+
+/*!
+ \brief Memory cache strategy keeping several sparse byte ranges of the source.
+
+ Unlike CCircularCache, which holds a single contiguous window and drops it on every seek
+ outside of it, this cache stores the data in fixed size blocks taken from a preallocated
+ pool. Blocks which are not part of the current read/write window are kept as history and
+ are only recycled in least recently used order, so seeking back to e.g. a container index
+ or a recently played area is served from memory.
+
+ The range [m_cur, m_end) is always contiguous and backed by blocks which are never evicted.
+ */
+class CSegmentedCache : public CCacheStrategy
+{
+public:
+  CSegmentedCache(size_t front, size_t back);
+  ~CSegmentedCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* buf, size_t len) override;
+  int ReadFromCache(char* buf, size_t len) override;
+  int64_t WaitForData(uint32_t minimum, std::chrono::milliseconds timeout) override;
+
+  int64_t Seek(int64_t pos) override;
+  bool Reset(int64_t pos) override;
+
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  CCacheStrategy* CreateNew() override;
+
+  bool PreloadData(int64_t iFilePosition, const char* pBuffer, size_t iSize) override;
+  size_t CopyCachedData(int64_t iFilePosition, char* pBuffer, size_t iMaxSize) override;
+
+  static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+private:
+  struct Block
+  {
+    size_t slot; /**< index of the block memory in the pool */
+    size_t start; /**< offset in block of beginning of valid data */
+    size_t end; /**< offset in block of end of valid data */
+    std::list<int64_t>::iterator lru; /**< position in m_lru */
+  };
+
+  Block* FindBlock(int64_t index);
+  Block* AcquireBlock(int64_t index);
+  void StoreInBlock(Block& block, size_t offset, const char* buf, size_t len);
+  void TouchBlock(Block& block);
+  bool IsProtectedBlock(int64_t index) const;
+  int64_t GetContiguousEnd(int64_t pos);
+
+  int64_t m_end = 0; /**< index in file of end of valid data (write position) */
+  int64_t m_cur = 0; /**< current reading index in file */
+  size_t m_size; /**< size of the block pool in bytes */
+  size_t m_size_front; /**< maximum amount of unread data ahead of the read position */
+  std::unique_ptr<uint8_t[]> m_buf; /**< block pool */
+  std::unordered_map<int64_t, Block> m_blocks; /**< cached blocks keyed by block index in file */
+  std::list<int64_t> m_lru; /**< block indexes, most recently used first */
+  std::vector<size_t> m_freeSlots;
+  unsigned int m_evictions = 0;
+  unsigned int m_cachedSeeks = 0;
+  CCriticalSection m_sync;
+  CEvent m_written;
+};
+
+} // namespace XFILE
@@ -0,0 +1,178 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/SegmentedCache.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr size_t BLOCK = CSegmentedCache::BLOCK_SIZE;
+
+char ValueAt(int64_t pos)
+{
+  return static_cast<char>(pos * 7 % 251);
+}
+
+void Fill(CSegmentedCache& cache, int64_t from, size_t size)
+{
+  std::vector<char> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = ValueAt(from + i);
+
+  size_t written = 0;
+  while (written < size)
+  {
+    const int ret = cache.WriteToCache(data.data() + written, size - written);
+    ASSERT_GT(ret, 0);
+    written += ret;
+  }
+}
+
+void Drain(CSegmentedCache& cache, int64_t from, size_t size)
+{
+  std::vector<char> data(size);
+  size_t read = 0;
+  while (read < size)
+  {
+    const int ret = cache.ReadFromCache(data.data() + read, size - read);
+    ASSERT_GT(ret, 0);
+    read += ret;
+  }
+
+  for (size_t i = 0; i < size; ++i)
+    ASSERT_EQ(ValueAt(from + i), data[i]) << "at position " << from + i;
+}
+} // namespace
+
+TEST(TestSegmentedCache, SequentialReadWrite)
+{
+  CSegmentedCache cache(8 * BLOCK, 2 * BLOCK);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  Fill(cache, 0, 3 * BLOCK + 100);
+  EXPECT_EQ(static_cast<int64_t>(3 * BLOCK + 100), cache.CachedDataEndPos());
+  Drain(cache, 0, 3 * BLOCK + 100);
+
+  char c;
+  EXPECT_EQ(CACHE_RC_WOULD_BLOCK, cache.ReadFromCache(&c, 1));
+  cache.EndOfInput();
+  EXPECT_EQ(0, cache.ReadFromCache(&c, 1));
+}
+
+TEST(TestSegmentedCache, ForwardLimit)
+{
+  CSegmentedCache cache(2 * BLOCK, 2 * BLOCK);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  Fill(cache, 0, 2 * BLOCK);
+  EXPECT_EQ(0u, cache.GetMaxWriteSize(BLOCK));
+
+  Drain(cache, 0, BLOCK);
+  EXPECT_EQ(BLOCK, cache.GetMaxWriteSize(BLOCK));
+}
+
+TEST(TestSegmentedCache, KeepsRangesAcrossReset)
+{
+  CSegmentedCache cache(4 * BLOCK, 4 * BLOCK);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  // head of the file, e.g. container header
+  Fill(cache, 0, 2 * BLOCK);
+  Drain(cache, 0, 2 * BLOCK);
+
+  // jump to the tail, e.g. index at end of file
+  const int64_t tail = 100 * BLOCK + 10;
+  EXPECT_FALSE(cache.IsCachedPosition(tail));
+  EXPECT_TRUE(cache.Reset(tail));
+  Fill(cache, tail, BLOCK);
+  Drain(cache, tail, BLOCK);
+
+  // seeking back to the head is served from the first range
+  EXPECT_TRUE(cache.IsCachedPosition(100));
+  EXPECT_EQ(static_cast<int64_t>(2 * BLOCK), cache.CachedDataEndPosIfSeekTo(100));
+  EXPECT_FALSE(cache.Reset(100));
+  EXPECT_EQ(static_cast<int64_t>(2 * BLOCK), cache.CachedDataEndPos());
+  Drain(cache, 100, 2 * BLOCK - 100);
+
+  // and continues after the cached range
+  Fill(cache, 2 * BLOCK, BLOCK);
+  Drain(cache, 2 * BLOCK, BLOCK);
+
+  // tail range is still there
+  EXPECT_TRUE(cache.IsCachedPosition(tail));
+}
+
+TEST(TestSegmentedCache, SeekWithinWindow)
+{
+  CSegmentedCache cache(4 * BLOCK, 4 * BLOCK);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  Fill(cache, 0, 3 * BLOCK);
+  Drain(cache, 0, 2 * BLOCK);
+
+  EXPECT_EQ(10, cache.Seek(10));
+  Drain(cache, 10, BLOCK);
+
+  EXPECT_EQ(static_cast<int64_t>(2 * BLOCK + 5), cache.Seek(2 * BLOCK + 5));
+  Drain(cache, 2 * BLOCK + 5, BLOCK - 5);
+
+  cache.EndOfInput();
+  EXPECT_EQ(CACHE_RC_ERROR, cache.Seek(50 * BLOCK));
+}
+
+TEST(TestSegmentedCache, EvictsLeastRecentlyUsed)
+{
+  CSegmentedCache cache(2 * BLOCK, 2 * BLOCK);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  // pool holds 6 blocks, fill 3 separate ranges of 2 blocks each
+  for (int64_t range = 0; range < 3; ++range)
+  {
+    const int64_t pos = range * 10 * BLOCK;
+    cache.Reset(pos);
+    Fill(cache, pos, 2 * BLOCK);
+    Drain(cache, pos, 2 * BLOCK);
+  }
+
+  // a fourth range has to evict the oldest one
+  const int64_t pos = 30 * BLOCK;
+  cache.Reset(pos);
+  Fill(cache, pos, 2 * BLOCK);
+
+  EXPECT_FALSE(cache.IsCachedPosition(0));
+  EXPECT_TRUE(cache.IsCachedPosition(10 * BLOCK));
+  EXPECT_TRUE(cache.IsCachedPosition(20 * BLOCK));
+}
+
+TEST(TestSegmentedCache, PreloadAndCopy)
+{
+  CSegmentedCache cache(4 * BLOCK, 4 * BLOCK);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  std::vector<char> data(BLOCK + 200);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = ValueAt(i);
+  EXPECT_TRUE(cache.PreloadData(0, data.data(), data.size()));
+
+  // preloading doesn't move the read or write position
+  EXPECT_EQ(0, cache.CachedDataEndPos());
+  EXPECT_EQ(static_cast<int64_t>(BLOCK + 200), cache.CachedDataEndPosIfSeekTo(0));
+
+  std::vector<char> copy(2 * BLOCK);
+  EXPECT_EQ(BLOCK + 100, cache.CopyCachedData(100, copy.data(), copy.size()));
+  EXPECT_EQ(ValueAt(100), copy[0]);
+  EXPECT_EQ(0u, cache.CopyCachedData(5 * BLOCK, copy.data(), copy.size()));
+
+  EXPECT_FALSE(cache.Reset(0));
+  Drain(cache, 0, BLOCK + 200);
+}
@@ -13,9 +13,172 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <cstdlib>
+#include <limits>
 #include <string.h>
 using namespace XFILE;
 
+namespace
+{
+// straight forward block compression after J.M.P. van Waveren, "Real-Time DXT Compression":
+// the end points are opposite corners of the bounding box of the colours, moved in a bit, and
+// every pixel takes the nearest of the colours in between. Good enough for artwork, fast enough
+// to run when the image is cached.
+
+uint16_t ToRGB565(const unsigned char* bgr)
+{
+  return static_cast<uint16_t>(((bgr[2] >> 3) << 11) | ((bgr[1] >> 2) << 5) | (bgr[0] >> 3));
+}
+
+void FromRGB565(uint16_t color, unsigned char* bgr)
+{
+  const unsigned int r = (color >> 11) & 0x1f;
+  const unsigned int g = (color >> 5) & 0x3f;
+  const unsigned int b = color & 0x1f;
+  bgr[0] = static_cast<unsigned char>((b << 3) | (b >> 2));
+  bgr[1] = static_cast<unsigned char>((g << 2) | (g >> 4));
+  bgr[2] = static_cast<unsigned char>((r << 3) | (r >> 2));
+}
+
+void WriteLE(unsigned char* dest, uint64_t value, unsigned int bytes)
+{
+  for (unsigned int i = 0; i < bytes; i++)
+    dest[i] = static_cast<unsigned char>(value >> (8 * i));
+}
+
+//! colour part of a block, 8 bytes from 16 BGRA pixels
+void CompressColorBlock(const unsigned char* block, unsigned char* dest)
+{
+  unsigned char minColor[3] = {255, 255, 255};
+  unsigned char maxColor[3] = {0, 0, 0};
+  for (unsigned int i = 0; i < 16; i++)
+  {
+    for (unsigned int c = 0; c < 3; c++)
+    {
+      minColor[c] = std::min(minColor[c], block[i * 4 + c]);
+      maxColor[c] = std::max(maxColor[c], block[i * 4 + c]);
+    }
+  }
+  for (unsigned int c = 0; c < 3; c++)
+  {
+    const int inset = (maxColor[c] - minColor[c]) >> 4;
+    minColor[c] = static_cast<unsigned char>(minColor[c] + inset);
+    maxColor[c] = static_cast<unsigned char>(maxColor[c] - inset);
+  }
+
+  // take the diagonal along the channel varying most: channels falling where it rises go from
+  // max to min
+  unsigned int mainChannel = 0;
+  for (unsigned int c = 1; c < 3; c++)
+  {
+    if (maxColor[c] - minColor[c] > maxColor[mainChannel] - minColor[mainChannel])
+      mainChannel = c;
+  }
+  int mean[3] = {};
+  for (unsigned int i = 0; i < 16; i++)
+  {
+    for (unsigned int c = 0; c < 3; c++)
+      mean[c] += block[i * 4 + c];
+  }
+  for (unsigned int c = 0; c < 3; c++)
+  {
+    if (c == mainChannel)
+      continue;
+    int covariance = 0;
+    for (unsigned int i = 0; i < 16; i++)
+      covariance += (16 * block[i * 4 + c] - mean[c]) *
+                    (16 * block[i * 4 + mainChannel] - mean[mainChannel]);
+    if (covariance < 0)
+      std::swap(minColor[c], maxColor[c]);
+  }
+
+  uint16_t color0 = ToRGB565(maxColor);
+  uint16_t color1 = ToRGB565(minColor);
+  // the first end point has to be the larger one, otherwise the block has just three colours
+  if (color0 < color1)
+    std::swap(color0, color1);
+
+  unsigned char palette[4][3];
+  FromRGB565(color0, palette[0]);
+  FromRGB565(color1, palette[1]);
+  for (unsigned int c = 0; c < 3; c++)
+  {
+    palette[2][c] = static_cast<unsigned char>((2 * palette[0][c] + palette[1][c]) / 3);
+    palette[3][c] = static_cast<unsigned char>((palette[0][c] + 2 * palette[1][c]) / 3);
+  }
+
+  uint32_t indices = 0;
+  if (color0 != color1)
+  {
+    for (unsigned int i = 0; i < 16; i++)
+    {
+      unsigned int best = 0;
+      int bestError = std::numeric_limits<int>::max();
+      for (unsigned int p = 0; p < 4; p++)
+      {
+        int error = 0;
+        for (unsigned int c = 0; c < 3; c++)
+        {
+          const int diff = block[i * 4 + c] - palette[p][c];
+          error += diff * diff;
+        }
+        if (error < bestError)
+        {
+          bestError = error;
+          best = p;
+        }
+      }
+      indices |= best << (2 * i);
+    }
+  }
+
+  WriteLE(dest, color0, 2);
+  WriteLE(dest + 2, color1, 2);
+  WriteLE(dest + 4, indices, 4);
+}
+
+//! alpha part of a DXT5 block, 8 bytes from 16 BGRA pixels
+void CompressAlphaBlock(const unsigned char* block, unsigned char* dest)
+{
+  unsigned char minAlpha = 255;
+  unsigned char maxAlpha = 0;
+  for (unsigned int i = 0; i < 16; i++)
+  {
+    minAlpha = std::min(minAlpha, block[i * 4 + 3]);
+    maxAlpha = std::max(maxAlpha, block[i * 4 + 3]);
+  }
+
+  // the larger end point first selects eight interpolated values
+  unsigned char palette[8] = {maxAlpha, minAlpha};
+  for (unsigned int p = 1; p < 7; p++)
+    palette[p + 1] = static_cast<unsigned char>(((7 - p) * maxAlpha + p * minAlpha) / 7);
+
+  uint64_t indices = 0;
+  if (minAlpha != maxAlpha)
+  {
+    for (unsigned int i = 0; i < 16; i++)
+    {
+      unsigned int best = 0;
+      int bestError = std::numeric_limits<int>::max();
+      for (unsigned int p = 0; p < 8; p++)
+      {
+        const int error = std::abs(block[i * 4 + 3] - palette[p]);
+        if (error < bestError)
+        {
+          bestError = error;
+          best = p;
+        }
+      }
+      indices |= static_cast<uint64_t>(best) << (3 * i);
+    }
+  }
+
+  dest[0] = maxAlpha;
+  dest[1] = minAlpha;
+  WriteLE(dest + 2, indices, 6);
+}
+} // namespace
+
 CDDSImage::CDDSImage()
 {
   m_data = NULL;
@@ -61,6 +224,20 @@ XB_FMT CDDSImage::GetFormat() const
   return XB_FMT_UNKNOWN;
 }
 
+bool CDDSImage::HasAlpha() const
+{
+  switch (GetFormat())
+  {
+    case XB_FMT_DXT3:
+    case XB_FMT_DXT5:
+      return true;
+    case XB_FMT_A8R8G8B8:
+      return (m_desc.pixelFormat.flags & ddpf_alphapixels) != 0;
+    default:
+      return false;
+  }
+}
+
 unsigned int CDDSImage::GetSize() const
 {
   return m_desc.linearSize;
@@ -71,14 +248,17 @@ unsigned char *CDDSImage::GetData() const
   return m_data;
 }
 
-bool CDDSImage::ReadFile(const std::string &inputFile)
+bool CDDSImage::ReadHeader(const std::string& inputFile)
 {
-  // open the file
   CFile file;
   if (!file.Open(inputFile))
     return false;
 
-  // read the header
+  return ReadHeader(file);
+}
+
+bool CDDSImage::ReadHeader(CFile& file)
+{
   uint32_t magic;
   if (file.Read(&magic, 4) != 4)
     return false;
@@ -86,6 +266,21 @@ bool CDDSImage::ReadFile(const std::string &inputFile)
     return false;
   if (!GetFormat())
     return false;  // not supported
+  if (m_desc.linearSize < GetStorageRequirements(m_desc.width, m_desc.height, GetFormat()))
+    return false; // truncated
+  return true;
+}
+
+bool CDDSImage::ReadFile(const std::string &inputFile)
+{
+  // open the file
+  CFile file;
+  if (!file.Open(inputFile))
+    return false;
+
+  // read the header
+  if (!ReadHeader(file))
+    return false;
 
   // allocate our data
   m_data = new unsigned char[m_desc.linearSize];
@@ -100,6 +295,79 @@ bool CDDSImage::ReadFile(const std::string &inputFile)
   return true;
 }
 
+bool CDDSImage::Create(unsigned int width,
+                       unsigned int height,
+                       unsigned int pitch,
+                       const unsigned char* bgra,
+                       XB_FMT format)
+{
+  if (!bgra || width == 0 || height == 0 ||
+      (format != XB_FMT_A8R8G8B8 && format != XB_FMT_DXT1 && format != XB_FMT_DXT5))
+    return false;
+
+  Allocate(width, height, format);
+
+  if (format == XB_FMT_A8R8G8B8)
+  {
+    bool alpha = false;
+    for (unsigned int y = 0; y < height; y++)
+    {
+      const unsigned char* src = bgra + y * pitch;
+      memcpy(m_data + y * width * 4, src, width * 4);
+      for (unsigned int x = 0; x < width && !alpha; x++)
+        alpha = src[x * 4 + 3] != 0xff;
+    }
+    if (alpha)
+      m_desc.pixelFormat.flags |= ddpf_alphapixels;
+    return true;
+  }
+
+  const unsigned int blockSize = format == XB_FMT_DXT1 ? 8 : 16;
+  unsigned char* dest = m_data;
+  unsigned char block[16 * 4];
+  for (unsigned int by = 0; by < height; by += 4)
+  {
+    for (unsigned int bx = 0; bx < width; bx += 4)
+    {
+      // blocks over the edge repeat the last row and column
+      for (unsigned int i = 0; i < 16; i++)
+      {
+        const unsigned int x = std::min(bx + i % 4, width - 1);
+        const unsigned int y = std::min(by + i / 4, height - 1);
+        memcpy(block + i * 4, bgra + y * pitch + x * 4, 4);
+      }
+
+      if (format == XB_FMT_DXT5)
+        CompressAlphaBlock(block, dest);
+      CompressColorBlock(block, dest + blockSize - 8);
+      dest += blockSize;
+    }
+  }
+  return true;
+}
+
+bool CDDSImage::WriteFile(const std::string& outputFile) const
+{
+  if (!m_data)
+    return false;
+
+  CFile file;
+  if (!file.OpenForWrite(outputFile, true))
+    return false;
+
+  if (file.Write("DDS ", 4) != 4 ||
+      file.Write(&m_desc, sizeof(m_desc)) != static_cast<ssize_t>(sizeof(m_desc)) ||
+      file.Write(m_data, m_desc.linearSize) != static_cast<ssize_t>(m_desc.linearSize))
+  {
+    file.Close();
+    CFile::Delete(outputFile);
+    return false;
+  }
+
+  file.Close();
+  return true;
+}
+
 unsigned int CDDSImage::GetStorageRequirements(unsigned int width,
                                                unsigned int height,
                                                XB_FMT format)
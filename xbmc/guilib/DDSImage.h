@@ -13,6 +13,11 @@
 #include <stdint.h>
 #include <string>
 
+namespace XFILE
+{
+class CFile;
+}
+
 class CDDSImage
 {
 public:
@@ -25,10 +30,28 @@ public:
   XB_FMT GetFormat() const;
   unsigned int GetSize() const;
   unsigned char *GetData() const;
+  bool HasAlpha() const;
 
   bool ReadFile(const std::string &file);
 
+  /*! \brief Read only the header of a DDS file, e.g. to check the size of the image without
+   loading it. GetData() stays empty.
+   */
+  bool ReadHeader(const std::string& file);
+
+  /*! \brief Fill the image from BGRA pixels
+   \param format XB_FMT_A8R8G8B8 to store the pixels as they are, XB_FMT_DXT1 or XB_FMT_DXT5 to
+   compress them. DXT1 keeps no alpha.
+   */
+  bool Create(unsigned int width,
+              unsigned int height,
+              unsigned int pitch,
+              const unsigned char* bgra,
+              XB_FMT format);
+  bool WriteFile(const std::string &file) const;
+
 private:
+  bool ReadHeader(XFILE::CFile& file);
   void Allocate(unsigned int width, unsigned int height, XB_FMT format);
   static const char* GetFourCC(XB_FMT format);
 
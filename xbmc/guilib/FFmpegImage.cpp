@@ -47,6 +47,39 @@ Frame::~Frame()
   m_pImage = nullptr;
 }
 
+namespace
+{
+// size from the frame header of a JPEG, the demuxer doesn't tell before decoding
+bool GetJpegSize(const uint8_t* buffer, size_t size, unsigned int& width, unsigned int& height)
+{
+  size_t pos = 2; // SOI
+  while (pos + 9 < size)
+  {
+    if (buffer[pos] != 0xFF)
+      return false;
+    const uint8_t marker = buffer[pos + 1];
+    if (marker == 0xFF) // fill byte
+    {
+      pos++;
+      continue;
+    }
+
+    // SOF0 - SOF15, except DHT, JPG and DAC which share the range
+    if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+    {
+      height = (buffer[pos + 5] << 8) | buffer[pos + 6];
+      width = (buffer[pos + 7] << 8) | buffer[pos + 8];
+      return width > 0 && height > 0;
+    }
+    if (marker == 0xD9 || marker == 0xDA) // EOI or SOS before any frame header
+      return false;
+
+    pos += 2 + ((buffer[pos + 2] << 8) | buffer[pos + 3]);
+  }
+  return false;
+}
+} // namespace
+
 struct ThumbDataManagement
 {
   uint8_t* intermediateBuffer = nullptr; // gets av_alloced
@@ -145,7 +178,7 @@ bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSi
                                       unsigned int width, unsigned int height)
 {
 
-  if (!Initialize(buffer, bufSize))
+  if (!Initialize(buffer, bufSize, width, height))
   {
     //log
     return false;
@@ -157,7 +190,32 @@ bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSi
   return !(m_pFrame == nullptr);
 }
 
-bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
+int CFFmpegImage::GetLowres(unsigned int imageWidth,
+                            unsigned int imageHeight,
+                            unsigned int width,
+                            unsigned int height,
+                            int maxLowres)
+{
+  if (imageWidth == 0 || imageHeight == 0)
+    return 0;
+
+  // the image is needed in the size fitting into width x height
+  double scale = 1.0;
+  if (width > 0)
+    scale = std::min(scale, static_cast<double>(width) / imageWidth);
+  if (height > 0)
+    scale = std::min(scale, static_cast<double>(height) / imageHeight);
+
+  int lowres = 0;
+  while (lowres < maxLowres && scale * (2 << lowres) <= 1.0)
+    lowres++;
+  return lowres;
+}
+
+bool CFFmpegImage::Initialize(unsigned char* buffer,
+                              size_t bufSize,
+                              unsigned int width /* = 0 */,
+                              unsigned int height /* = 0 */)
 {
   int bufferSize = 4096;
   uint8_t* fbuffer = (uint8_t*)av_malloc(bufferSize + AV_INPUT_BUFFER_PADDING_SIZE);
@@ -279,6 +337,18 @@ bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
     return false;
   }
 
+  // let the decoder scale down while decoding (JPEG DCT scaling), this is a lot cheaper than
+  // decoding the full image and scaling it afterwards
+  unsigned int jpegWidth = 0;
+  unsigned int jpegHeight = 0;
+  if ((width > 0 || height > 0) && codec->max_lowres > 0 && is_jpeg &&
+      GetJpegSize(buffer, bufSize, jpegWidth, jpegHeight))
+  {
+    m_codec_ctx->lowres = GetLowres(jpegWidth, jpegHeight, width, height, codec->max_lowres);
+    m_originalWidth = jpegWidth;
+    m_originalHeight = jpegHeight;
+  }
+
   if (avcodec_open2(m_codec_ctx, codec, NULL) < 0)
   {
     avformat_close_input(&m_fctx);
@@ -337,8 +407,9 @@ AVFrame* CFFmpegImage::ExtractFrame()
 
   m_height = frame->height;
   m_width = frame->width;
-  m_originalWidth = m_width;
-  m_originalHeight = m_height;
+  // the decoder may have scaled the image down, see Initialize()
+  m_originalWidth = std::max(m_originalWidth, m_width);
+  m_originalHeight = std::max(m_originalHeight, m_height);
 
   const AVPixFmtDescriptor* pixDescriptor = av_pix_fmt_desc_get(static_cast<AVPixelFormat>(frame->format));
   if (pixDescriptor && ((pixDescriptor->flags & (AV_PIX_FMT_FLAG_ALPHA | AV_PIX_FMT_FLAG_PAL)) != 0))
@@ -71,7 +71,26 @@ public:
                                   unsigned int &bufferoutSize) override;
   void ReleaseThumbnailBuffer() override;
 
-  bool Initialize(unsigned char* buffer, size_t bufSize);
+  /*!
+   \brief Open the image data for decoding
+   \param width,height Smallest size the image is needed in, 0 for the full size. Decoders
+   which can, like the JPEG one, decode at a fraction of the size then.
+   */
+  bool Initialize(unsigned char* buffer,
+                  size_t bufSize,
+                  unsigned int width = 0,
+                  unsigned int height = 0);
+
+  /*!
+   \brief How many times an image may be halved and still cover the given size when scaled to
+   fit it
+   \param maxLowres Most halvings the decoder supports
+   */
+  static int GetLowres(unsigned int imageWidth,
+                       unsigned int imageHeight,
+                       unsigned int width,
+                       unsigned int height,
+                       int maxLowres);
 
   std::shared_ptr<Frame> ReadFrame();
 
@@ -13,7 +13,9 @@
 #include "GUIInfoManager.h"
 #include "GUIListItemLayout.h"
 #include "GUIMessage.h"
+#include "GUILargeTextureManager.h"
 #include "ServiceBroker.h"
+#include "guilib/GUIComponent.h"
 #include "guilib/GUIListItem.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
 #include "guilib/listproviders/IListProvider.h"
@@ -21,6 +23,7 @@
 #include "input/actions/ActionIDs.h"
 #include "input/keyboard/KeyIDs.h"
 #include "input/mouse/MouseEvent.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CharsetConverter.h"
@@ -32,6 +35,7 @@
 #include "windowing/WinSystem.h"
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 
 #include <tinyxml.h>
@@ -135,6 +139,7 @@ CGUIBaseContainer::CGUIBaseContainer(const CGUIBaseContainer& other)
 
 CGUIBaseContainer::~CGUIBaseContainer(void)
 {
+  ClearPrefetch();
   // release the container from items
   for (const auto& item : m_items)
     item->FreeMemory();
@@ -146,6 +151,7 @@ void CGUIBaseContainer::DoProcess(unsigned int currentTime, CDirtyRegionList &di
 
   if (m_pageChangeTimer.IsRunning() && m_pageChangeTimer.GetElapsedMilliseconds() > 200)
     m_pageChangeTimer.Stop();
+  UpdatePrefetch(currentTime);
   m_wasReset = false;
 
   // if not visible, we reset the autoscroll timer
@@ -1014,6 +1020,7 @@ void CGUIBaseContainer::AllocResources()
 void CGUIBaseContainer::FreeResources(bool immediately)
 {
   CGUIControl::FreeResources(immediately);
+  ClearPrefetch();
   if (m_listProvider)
   {
     if (immediately)
@@ -1558,6 +1565,84 @@ void CGUIBaseContainer::GetCacheOffsets(int &cacheBefore, int &cacheAfter) const
   }
 }
 
+void CGUIBaseContainer::UpdatePrefetch(unsigned int currentTime)
+{
+  const int pages =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiPrefetchPages;
+  if (pages <= 0 || !IsVisible() || !m_layout || m_items.empty() || m_itemsPerPage <= 0)
+  {
+    ClearPrefetch();
+    return;
+  }
+
+  // keep going the way we went last
+  if (m_scroller.IsScrollingDown())
+    m_prefetchForward = true;
+  else if (m_scroller.IsScrollingUp())
+    m_prefetchForward = false;
+
+  const float scrollValue = m_scroller.GetValue();
+  if (currentTime > m_prefetchTime)
+  {
+    const float speed =
+        std::abs(scrollValue - m_prefetchScrollValue) / (currentTime - m_prefetchTime);
+    m_scrollSpeed = m_scroller.IsScrolling() ? 0.7f * m_scrollSpeed + 0.3f * speed : 0.0f;
+  }
+  m_prefetchScrollValue = scrollValue;
+  m_prefetchTime = currentTime;
+
+  // rows scrolling by while the art loads won't be seen, so start beyond them
+  constexpr float LOAD_TIME_MS = 250.0f;
+  const float rowSize = m_layout->Size(m_orientation);
+  const int offset = static_cast<int>(scrollValue / rowSize);
+  const int skip = static_cast<int>(m_scrollSpeed * LOAD_TIME_MS / rowSize);
+  int cacheBefore, cacheAfter;
+  GetCacheOffsets(cacheBefore, cacheAfter);
+
+  std::pair<int, int> rows;
+  if (m_prefetchForward)
+  {
+    rows.first = offset + m_itemsPerPage + 1 + cacheAfter + skip;
+    rows.second = rows.first + pages * m_itemsPerPage;
+  }
+  else
+  {
+    rows.second = offset - cacheBefore - skip;
+    rows.first = rows.second - pages * m_itemsPerPage;
+  }
+  if (!m_wasReset && m_prefetchRows == rows)
+    return;
+  m_prefetchRows = rows;
+
+  // nearest items first, as only so many are taken
+  const int itemsPerRow = std::max(1, CorrectOffset(1, 0) - CorrectOffset(0, 0));
+  std::vector<LargeImageRequest> images;
+  for (int i = 0; i < rows.second - rows.first; ++i)
+  {
+    const int row = m_prefetchForward ? rows.first + i : rows.second - 1 - i;
+    for (int col = 0; col < itemsPerRow; ++col)
+    {
+      const int itemNo = CorrectOffset(row, col);
+      if (itemNo >= 0 && itemNo < static_cast<int>(m_items.size()))
+        m_layout->GetPrefetchImages(m_items[itemNo].get(), images);
+    }
+    if (images.size() >= CGUILargeTextureManager::MAX_PREFETCH_IMAGES)
+      break;
+  }
+
+  CServiceBroker::GetGUI()->GetLargeTextureManager().SetPrefetch(this, std::move(images));
+}
+
+void CGUIBaseContainer::ClearPrefetch()
+{
+  if (!m_prefetchRows)
+    return;
+
+  m_prefetchRows.reset();
+  if (CServiceBroker::GetGUI())
+    CServiceBroker::GetGUI()->GetLargeTextureManager().SetPrefetch(this, {});
+}
+
 void CGUIBaseContainer::SetCursor(int cursor)
 {
   if (m_cursor != cursor)
@@ -260,6 +260,18 @@ private:
   // early inertial scroll cancellation
   bool m_waitForScrollEnd = false;
   float m_lastScrollValue = 0.0f;
+
+  /*! \brief Load the art of the items following the visible ones in the scroll direction ahead
+   \sa CGUILargeTextureManager::SetPrefetch
+   */
+  void UpdatePrefetch(unsigned int currentTime);
+  void ClearPrefetch();
+
+  bool m_prefetchForward = true;
+  float m_prefetchScrollValue = 0.0f;
+  unsigned int m_prefetchTime = 0;
+  float m_scrollSpeed = 0.0f; ///< pixels per ms, smoothed over a few frames
+  std::optional<std::pair<int, int>> m_prefetchRows; ///< rows whose art is loaded ahead
 };
 
 
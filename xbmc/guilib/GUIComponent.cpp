@@ -12,6 +12,7 @@
 #include "GUIColorManager.h"
 #include "GUIInfoManager.h"
 #include "GUILargeTextureManager.h"
+#include "GUIRenderBatch.h"
 #include "GUITextureCallbackManager.h"
 #include "GUIWindowManager.h"
 #include "ServiceBroker.h"
@@ -32,6 +33,7 @@ CGUIComponent::CGUIComponent()
     m_guiInfoManager(std::make_unique<CGUIInfoManager>()),
     m_guiColorManager(std::make_unique<CGUIColorManager>()),
     m_guiAudioManager(std::make_unique<CGUIAudioManager>()),
+    m_renderBatch(std::make_unique<CGUIRenderBatch>()),
     m_announcementHandlerContainer(std::make_unique<CGUIAnnouncementHandlerContainer>())
 {
 }
@@ -105,6 +107,11 @@ CGUIAudioManager &CGUIComponent::GetAudioManager()
   return *m_guiAudioManager;
 }
 
+CGUIRenderBatch& CGUIComponent::GetRenderBatch()
+{
+  return *m_renderBatch;
+}
+
 std::shared_ptr<ADDON::CSkinInfo> CGUIComponent::GetSkinInfo()
 {
   return m_skinInfo;
@@ -113,11 +120,13 @@ std::shared_ptr<ADDON::CSkinInfo> CGUIComponent::GetSkinInfo()
 void CGUIComponent::SetSkinInfo(std::shared_ptr<ADDON::CSkinInfo> skin)
 {
   m_skinInfo = std::move(skin);
+  m_guiInfoManager->GetInfoProviders().GetSkinInfoProvider().OnSettingsChanged();
 }
 
 void CGUIComponent::UnloadSkin()
 {
   m_skinInfo.reset();
+  m_guiInfoManager->GetInfoProviders().GetSkinInfoProvider().OnSettingsChanged();
 }
 
 bool CGUIComponent::ConfirmDelete(const std::string& path)
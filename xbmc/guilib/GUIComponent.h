@@ -19,6 +19,7 @@ class CStereoscopicsManager;
 class CGUIInfoManager;
 class CGUIColorManager;
 class CGUIAudioManager;
+class CGUIRenderBatch;
 class CGUIAnnouncementHandlerContainer;
 
 namespace ADDON
@@ -43,6 +44,7 @@ public:
   CGUIInfoManager &GetInfoManager();
   CGUIColorManager &GetColorManager();
   CGUIAudioManager &GetAudioManager();
+  CGUIRenderBatch& GetRenderBatch();
 
   void SetSkinInfo(std::shared_ptr<ADDON::CSkinInfo> skin);
   std::shared_ptr<ADDON::CSkinInfo> GetSkinInfo();
@@ -60,6 +62,7 @@ protected:
   std::unique_ptr<CGUIInfoManager> m_guiInfoManager;
   std::unique_ptr<CGUIColorManager> m_guiColorManager;
   std::unique_ptr<CGUIAudioManager> m_guiAudioManager;
+  std::unique_ptr<CGUIRenderBatch> m_renderBatch;
   std::unique_ptr<CGUIAnnouncementHandlerContainer> m_announcementHandlerContainer;
   std::shared_ptr<ADDON::CSkinInfo> m_skinInfo;
 };
@@ -23,6 +23,7 @@
 #include <vector>
 
 class CGUIListItem; // forward
+struct LargeImageRequest;
 class CAction;
 
 class CGUIMessage;
@@ -248,6 +249,15 @@ public:
 
   // push information updates
   virtual void UpdateInfo(const CGUIListItem* item = NULL) {}
+
+  /*!
+   \brief Add the images the control would load in the background for a list item, so they can be
+   loaded before the item is shown. See CGUILargeTextureManager::SetPrefetch.
+   */
+  virtual void GetPrefetchImages(const CGUIListItem* item,
+                                 std::vector<LargeImageRequest>& images) const
+  {
+  }
   virtual void SetPushUpdates(bool pushUpdates) { m_pushedUpdates = pushUpdates; }
 
   virtual bool IsGroup() const { return false; }
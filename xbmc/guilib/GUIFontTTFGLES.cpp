@@ -8,6 +8,7 @@
 
 #include "GUIFontTTFGLES.h"
 
+#include "GUIComponent.h"
 #include "GUIFont.h"
 #include "GUIFontManager.h"
 #include "ServiceBroker.h"
@@ -52,28 +53,19 @@ CGUIFontTTFGLES::~CGUIFontTTFGLES(void)
   // It's important that all the CGUIFontCacheEntry objects are
   // destructed before the CGUIFontTTFGLES goes out of scope, because
   // our virtual methods won't be accessible after this point
+  if (CServiceBroker::GetGUI())
+    CServiceBroker::GetGUI()->GetRenderBatch().Flush();
   m_dynamicCache.Flush();
   DeleteHardwareTexture();
 }
 
 bool CGUIFontTTFGLES::FirstBegin()
 {
-  CRenderSystemGLES* renderSystem =
-      dynamic_cast<CRenderSystemGLES*>(CServiceBroker::GetRenderSystem());
-  renderSystem->EnableGUIShader(ShaderMethodGLES::SM_FONTS);
   GLenum pixformat = GL_ALPHA; // deprecated
   GLenum internalFormat = GL_ALPHA;
 
-  if (renderSystem->ScissorsCanEffectClipping())
-  {
-    m_scissorClip = true;
-  }
-  else
-  {
-    m_scissorClip = false;
-    renderSystem->ResetScissors();
-    renderSystem->EnableGUIShader(ShaderMethodGLES::SM_FONTS_SHADER_CLIP);
-  }
+  // the shader is set up when the queued draws are drawn, see DrawQueued()
+  glActiveTexture(GL_TEXTURE0);
 
   if (m_textureStatus == TEXTURE_REALLOCATED)
   {
@@ -126,12 +118,6 @@ bool CGUIFontTTFGLES::FirstBegin()
     m_textureStatus = TEXTURE_READY;
   }
 
-  // Turn Blending On
-  glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
-  glEnable(GL_BLEND);
-  glActiveTexture(GL_TEXTURE0);
-  glBindTexture(GL_TEXTURE_2D, m_nTexture);
-
   return true;
 }
 
@@ -144,9 +130,83 @@ void CGUIFontTTFGLES::LastEnd()
   if (!winSystem)
     return;
 
+  CGraphicContext& context = winSystem->GetGfxContext();
+  CGUIRenderBatch& batch = CServiceBroker::GetGUI()->GetRenderBatch();
+
+  // the GUI transform changes without the batch being flushed, so it's kept with every draw
+  const size_t first = m_queuedDraws.size();
+  CRect bounds;
+  for (const auto& trans : m_vertexTrans)
+  {
+    if (trans.m_vertexBuffer->bufferHandle == 0)
+      continue;
+
+    const float x = trans.m_translateX + trans.m_offsetX;
+    const float y = trans.m_translateY + trans.m_offsetY;
+
+    // calculate the fractional offset to the ideal position
+    float fractX = context.ScaleFinalXCoord(trans.m_translateX, trans.m_translateY);
+    float fractY = context.ScaleFinalYCoord(trans.m_translateX, trans.m_translateY);
+    fractX = -fractX + std::round(fractX);
+    fractY = -fractY + std::round(fractY);
+
+    m_queuedDraws.emplace_back(QueuedDraw{
+        trans.m_vertexBuffer->bufferHandle, trans.m_vertexBuffer->size, trans.m_clip,
+        context.GetGUIMatrix(), context.GetGUIScaleX(), context.GetGUIScaleY(), x, y, fractX,
+        fractY, context.GetTransformDepth()});
+
+    // the area the vertices end up in, with a pixel to spare for the fractional offset
+    const CRect& extent = trans.m_vertexBuffer->bounds;
+    CGUIRenderBatch::Vertex corners[4]{};
+    const float cornersX[] = {extent.x1 - 1, extent.x2 + 1, extent.x2 + 1, extent.x1 - 1};
+    const float cornersY[] = {extent.y1 - 1, extent.y1 - 1, extent.y2 + 1, extent.y2 + 1};
+    for (int i = 0; i < 4; ++i)
+    {
+      const float cornerX = x + cornersX[i] * context.GetGUIScaleX();
+      const float cornerY = y + cornersY[i] * context.GetGUIScaleY();
+      corners[i].x = context.ScaleFinalXCoord(cornerX, cornerY);
+      corners[i].y = context.ScaleFinalYCoord(cornerX, cornerY);
+      corners[i].z = context.ScaleFinalZCoord(cornerX, cornerY);
+    }
+    bounds.Union(CGUIRenderBatch::GetBounds(corners, 4));
+  }
+
+  CGUIRenderBatch::State state;
+  state.shader = static_cast<int>(ShaderMethodGLES::SM_FONTS);
+  state.texture0 = m_texture.get();
+  state.blend = true;
+  batch.AddQueued(state, *this, first, m_queuedDraws.size(), bounds);
+
+  // without batching every label is drawn on its own
+  if (!batch.IsEnabled())
+    batch.Flush();
+}
+
+unsigned int CGUIFontTTFGLES::DrawQueued(const CGUIRenderBatch::State& state,
+                                         size_t first,
+                                         size_t last)
+{
+  CWinSystemBase* const winSystem = CServiceBroker::GetWinSystem();
+  if (!winSystem)
+    return 0;
+
   CRenderSystemGLES* renderSystem =
       dynamic_cast<CRenderSystemGLES*>(CServiceBroker::GetRenderSystem());
 
+  renderSystem->EnableGUIShader(ShaderMethodGLES::SM_FONTS);
+  const bool scissorClip = renderSystem->ScissorsCanEffectClipping();
+  if (!scissorClip)
+  {
+    renderSystem->ResetScissors();
+    renderSystem->EnableGUIShader(ShaderMethodGLES::SM_FONTS_SHADER_CLIP);
+  }
+
+  // Turn Blending On
+  glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
+  glEnable(GL_BLEND);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, m_nTexture);
+
   GLint posLoc = renderSystem->GUIShaderGetPos();
   GLint colLoc = renderSystem->GUIShaderGetCol();
   GLint tex0Loc = renderSystem->GUIShaderGetCoord0();
@@ -162,125 +222,98 @@ void CGUIFontTTFGLES::LastEnd()
   glEnableVertexAttribArray(colLoc);
   glEnableVertexAttribArray(tex0Loc);
 
-  if (!m_vertexTrans.empty())
-  {
-    // Deal with the vertices that can be hardware clipped and therefore translated
+  // Bind our pre-calculated array to GL_ELEMENT_ARRAY_BUFFER
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_elementArrayHandle);
+  // Store current scissor
+  CGraphicContext& context = winSystem->GetGfxContext();
+  CRect scissor = context.StereoCorrection(context.GetScissors());
 
-    // Bind our pre-calculated array to GL_ELEMENT_ARRAY_BUFFER
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_elementArrayHandle);
-    // Store current scissor
-    CGraphicContext& context = winSystem->GetGfxContext();
-    CRect scissor = context.StereoCorrection(context.GetScissors());
+  unsigned int drawCalls = 0;
+  for (size_t i = first; i < last; i++)
+  {
+    const QueuedDraw& draw = m_queuedDraws[i];
 
-    for (size_t i = 0; i < m_vertexTrans.size(); i++)
+    // Apply the clip rectangle
+    CRect clip = renderSystem->ClipRectToScissorRect(draw.clip);
+    if (!clip.IsEmpty())
     {
-      if (m_vertexTrans[i].m_vertexBuffer->bufferHandle == 0)
-      {
+      // intersect with current scissor
+      clip.Intersect(scissor);
+      // skip empty clip
+      if (clip.IsEmpty())
         continue;
-      }
-
-      // Apply the clip rectangle
-      CRect clip = renderSystem->ClipRectToScissorRect(m_vertexTrans[i].m_clip);
-      if (!clip.IsEmpty())
-      {
-        // intersect with current scissor
-        clip.Intersect(scissor);
-        // skip empty clip
-        if (clip.IsEmpty())
-          continue;
-      }
-      if (m_scissorClip)
-      {
-        // clip using scissors
-        renderSystem->SetScissors(clip);
-      }
-      else
-      {
-        // clip using vertex shader
-        renderSystem->ResetScissors();
-
-        const float clipBoundaries[4] = {
-            (m_vertexTrans[i].m_clip.x1 - m_vertexTrans[i].m_translateX -
-             m_vertexTrans[i].m_offsetX) /
-                context.GetGUIScaleX(),
-            (m_vertexTrans[i].m_clip.y1 - m_vertexTrans[i].m_translateY -
-             m_vertexTrans[i].m_offsetY) /
-                context.GetGUIScaleY(),
-            (m_vertexTrans[i].m_clip.x2 - m_vertexTrans[i].m_translateX -
-             m_vertexTrans[i].m_offsetX) /
-                context.GetGUIScaleX(),
-            (m_vertexTrans[i].m_clip.y2 - m_vertexTrans[i].m_translateY -
-             m_vertexTrans[i].m_offsetY) /
-                context.GetGUIScaleY()};
-
-        glUniform4fv(clipUniformLoc, 1, clipBoundaries);
-
-        const float textureSteps[4] = {1.f / static_cast<float>(m_textureWidth),
-                                       1.f / static_cast<float>(m_textureHeight), 1.f, 1.f};
-
-        glUniform4fv(coordStepUniformLoc, 1, textureSteps);
-      }
-
-      // calculate the fractional offset to the ideal position
-      float fractX =
-          context.ScaleFinalXCoord(m_vertexTrans[i].m_translateX, m_vertexTrans[i].m_translateY);
-      float fractY =
-          context.ScaleFinalYCoord(m_vertexTrans[i].m_translateX, m_vertexTrans[i].m_translateY);
-      fractX = -fractX + std::round(fractX);
-      fractY = -fractY + std::round(fractY);
-
-      // proj * model * gui * scroll * translation * scaling * correction factor
-      CMatrixGL matrix = glMatrixProject.Get();
-      matrix.MultMatrixf(glMatrixModview.Get());
-      matrix.MultMatrixf(CMatrixGL(context.GetGUIMatrix()));
-      matrix.Translatef(m_vertexTrans[i].m_offsetX, m_vertexTrans[i].m_offsetY, 0.0f);
-      matrix.Translatef(m_vertexTrans[i].m_translateX, m_vertexTrans[i].m_translateY, 0.0f);
-      // the gui matrix messes with the scale. correct it here for now.
-      matrix.Scalef(context.GetGUIScaleX(), context.GetGUIScaleY(), 1.0f);
-      // the gui matrix doesn't align to exact pixel coords atm. correct it here for now.
-      matrix.Translatef(fractX, fractY, 0.0f);
-
-      // Apply the depth value of the layer
-      float depth = CServiceBroker::GetWinSystem()->GetGfxContext().GetTransformDepth();
-      glUniform1f(depthLoc, depth);
-
-      glUniformMatrix4fv(matrixUniformLoc, 1, GL_FALSE, matrix);
-
-      // Bind the buffer to the OpenGL context's GL_ARRAY_BUFFER binding point
-      glBindBuffer(GL_ARRAY_BUFFER, m_vertexTrans[i].m_vertexBuffer->bufferHandle);
-
-      // Do the actual drawing operation, split into groups of characters no
-      // larger than the pre-determined size of the element array
-      for (size_t character = 0; m_vertexTrans[i].m_vertexBuffer->size > character;
-           character += ELEMENT_ARRAY_MAX_CHAR_INDEX)
-      {
-        size_t count = m_vertexTrans[i].m_vertexBuffer->size - character;
-        count = std::min<size_t>(count, ELEMENT_ARRAY_MAX_CHAR_INDEX);
-
-        // Set up the offsets of the various vertex attributes within the buffer
-        // object bound to GL_ARRAY_BUFFER
-        glVertexAttribPointer(
-            posLoc, 3, GL_FLOAT, GL_FALSE, sizeof(SVertex),
-            reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, x)));
-        glVertexAttribPointer(
-            colLoc, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SVertex),
-            reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, r)));
-        glVertexAttribPointer(
-            tex0Loc, 2, GL_FLOAT, GL_FALSE, sizeof(SVertex),
-            reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, u)));
-
-        glDrawElements(GL_TRIANGLES, 6 * count, GL_UNSIGNED_SHORT, 0);
-      }
-
-      glMatrixModview.Pop();
     }
-    // Restore the original scissor rectangle
-    if (m_scissorClip)
-      renderSystem->SetScissors(scissor);
-    // Unbind GL_ARRAY_BUFFER and GL_ELEMENT_ARRAY_BUFFER
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    if (scissorClip)
+    {
+      // clip using scissors
+      renderSystem->SetScissors(clip);
+    }
+    else
+    {
+      // clip using vertex shader
+      renderSystem->ResetScissors();
+
+      const float clipBoundaries[4] = {
+          (draw.clip.x1 - draw.x) / draw.scaleX, (draw.clip.y1 - draw.y) / draw.scaleY,
+          (draw.clip.x2 - draw.x) / draw.scaleX, (draw.clip.y2 - draw.y) / draw.scaleY};
+
+      glUniform4fv(clipUniformLoc, 1, clipBoundaries);
+
+      const float textureSteps[4] = {1.f / static_cast<float>(m_textureWidth),
+                                     1.f / static_cast<float>(m_textureHeight), 1.f, 1.f};
+
+      glUniform4fv(coordStepUniformLoc, 1, textureSteps);
+    }
+
+    // proj * model * gui * scroll * translation * scaling * correction factor
+    CMatrixGL matrix = glMatrixProject.Get();
+    matrix.MultMatrixf(glMatrixModview.Get());
+    matrix.MultMatrixf(CMatrixGL(draw.guiMatrix));
+    matrix.Translatef(draw.x, draw.y, 0.0f);
+    // the gui matrix messes with the scale. correct it here for now.
+    matrix.Scalef(draw.scaleX, draw.scaleY, 1.0f);
+    // the gui matrix doesn't align to exact pixel coords atm. correct it here for now.
+    matrix.Translatef(draw.fractX, draw.fractY, 0.0f);
+
+    // Apply the depth value of the layer
+    glUniform1f(depthLoc, draw.depth);
+
+    glUniformMatrix4fv(matrixUniformLoc, 1, GL_FALSE, matrix);
+
+    // Bind the buffer to the OpenGL context's GL_ARRAY_BUFFER binding point
+    glBindBuffer(GL_ARRAY_BUFFER, draw.bufferHandle);
+
+    // Do the actual drawing operation, split into groups of characters no
+    // larger than the pre-determined size of the element array
+    for (size_t character = 0; draw.size > character; character += ELEMENT_ARRAY_MAX_CHAR_INDEX)
+    {
+      size_t count = draw.size - character;
+      count = std::min<size_t>(count, ELEMENT_ARRAY_MAX_CHAR_INDEX);
+
+      // Set up the offsets of the various vertex attributes within the buffer
+      // object bound to GL_ARRAY_BUFFER
+      glVertexAttribPointer(
+          posLoc, 3, GL_FLOAT, GL_FALSE, sizeof(SVertex),
+          reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, x)));
+      glVertexAttribPointer(
+          colLoc, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SVertex),
+          reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, r)));
+      glVertexAttribPointer(
+          tex0Loc, 2, GL_FLOAT, GL_FALSE, sizeof(SVertex),
+          reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, u)));
+
+      glDrawElements(GL_TRIANGLES, 6 * count, GL_UNSIGNED_SHORT, 0);
+      drawCalls++;
+    }
+
+    glMatrixModview.Pop();
   }
+  // Restore the original scissor rectangle
+  if (scissorClip)
+    renderSystem->SetScissors(scissor);
+  // Unbind GL_ARRAY_BUFFER and GL_ELEMENT_ARRAY_BUFFER
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
   // Disable the attributes used by this shader
   glDisableVertexAttribArray(posLoc);
@@ -288,6 +321,13 @@ void CGUIFontTTFGLES::LastEnd()
   glDisableVertexAttribArray(tex0Loc);
 
   renderSystem->DisableGUIShader();
+
+  return drawCalls;
+}
+
+void CGUIFontTTFGLES::ClearQueued()
+{
+  m_queuedDraws.clear();
 }
 
 CVertexBuffer CGUIFontTTFGLES::CreateVertexBuffer(const std::vector<SVertex>& vertices) const
@@ -311,13 +351,30 @@ CVertexBuffer CGUIFontTTFGLES::CreateVertexBuffer(const std::vector<SVertex>& ve
     glBindBuffer(GL_ARRAY_BUFFER, 0);
   }
 
-  return CVertexBuffer(bufferHandle, vertices.size() / 4, this);
+  CRect bounds;
+  if (!vertices.empty())
+  {
+    bounds = CRect(vertices[0].x, vertices[0].y, vertices[0].x, vertices[0].y);
+    for (const SVertex& vertex : vertices)
+    {
+      bounds.x1 = std::min(bounds.x1, vertex.x);
+      bounds.y1 = std::min(bounds.y1, vertex.y);
+      bounds.x2 = std::max(bounds.x2, vertex.x);
+      bounds.y2 = std::max(bounds.y2, vertex.y);
+    }
+  }
+
+  return CVertexBuffer(bufferHandle, vertices.size() / 4, this, bounds);
 }
 
 void CGUIFontTTFGLES::DestroyVertexBuffer(CVertexBuffer& buffer) const
 {
   if (buffer.bufferHandle != 0)
   {
+    // queued draws may still use it
+    if (CServiceBroker::GetGUI())
+      CServiceBroker::GetGUI()->GetRenderBatch().Flush();
+
     // Release the buffer name for reuse
     glDeleteBuffers(1, static_cast<GLuint*>(&buffer.bufferHandle));
     buffer.bufferHandle = 0;
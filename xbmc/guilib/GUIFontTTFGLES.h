@@ -9,13 +9,15 @@
 #pragma once
 
 #include "GUIFontTTF.h"
+#include "GUIRenderBatch.h"
+#include "utils/TransformMatrix.h"
 
 #include <string>
 #include <vector>
 
 #include "system_gl.h"
 
-class CGUIFontTTFGLES : public CGUIFontTTF
+class CGUIFontTTFGLES : public CGUIFontTTF, public CGUIRenderBatch::IDrawer
 {
 public:
   explicit CGUIFontTTFGLES(const std::string& fontIdent);
@@ -24,6 +26,9 @@ public:
   bool FirstBegin() override;
   void LastEnd() override;
 
+  unsigned int DrawQueued(const CGUIRenderBatch::State& state, size_t first, size_t last) override;
+  void ClearQueued() override;
+
   CVertexBuffer CreateVertexBuffer(const std::vector<SVertex>& vertices) const override;
   void DestroyVertexBuffer(CVertexBuffer& bufferHandle) const override;
   static void CreateStaticVertexBuffers(void);
@@ -55,5 +60,20 @@ private:
   TextureStatus m_textureStatus{TEXTURE_VOID};
 
   static bool m_staticVertexBufferCreated;
-  bool m_scissorClip{false};
+
+  struct QueuedDraw
+  {
+    GLuint bufferHandle;
+    size_t size;
+    CRect clip;
+    TransformMatrix guiMatrix;
+    float scaleX;
+    float scaleY;
+    float x; // translation and scroll offset
+    float y;
+    float fractX;
+    float fractY;
+    float depth;
+  };
+  std::vector<QueuedDraw> m_queuedDraws;
 };
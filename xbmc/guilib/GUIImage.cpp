@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "GUIMessage.h"
+#include "GUILargeTextureManager.h"
 #include "ImageSettings.h"
 #include "ServiceBroker.h"
 #include "utils/log.h"
@@ -111,6 +112,18 @@ void CGUIImage::UpdateInfo(const CGUIListItem *item)
     SetFileName(m_info.GetLabel(m_parentID, true, &m_currentFallback));
 }
 
+void CGUIImage::GetPrefetchImages(const CGUIListItem* item,
+                                  std::vector<LargeImageRequest>& images) const
+{
+  // constant images are the same for all items, so they are loaded already
+  if (!item || m_info.IsConstant())
+    return;
+
+  LargeImageRequest request;
+  if (m_textureCurrent->GetLargeImageRequest(m_info.GetItemLabel(item, true), request))
+    images.emplace_back(std::move(request));
+}
+
 void CGUIImage::AllocateOnDemand()
 {
   // if we're hidden, we can free our resources and return
@@ -70,6 +70,8 @@ public:
   void SetInvalid() override;
   bool CanFocus() const override;
   void UpdateInfo(const CGUIListItem *item = NULL) override;
+  void GetPrefetchImages(const CGUIListItem* item,
+                         std::vector<LargeImageRequest>& images) const override;
 
   virtual void SetInfo(const KODI::GUILIB::GUIINFO::CGUIInfoLabel &info);
   virtual void SetFileName(const std::string& strFileName, bool setConstant = false, const bool useCache = true);
@@ -81,14 +81,170 @@ void CGUIIncludes::Clear()
   m_skinvariables.clear();
   m_files.clear();
   m_expressions.clear();
+  m_fileConditions.clear();
+  m_cache.Close();
+  m_cacheDigest.clear();
+  m_cachedFiles = 0;
 }
 
 void CGUIIncludes::Load(const std::string &file)
 {
+  // only the main entrypoint is cached, files included by documents are loaded on resolving them
+  const bool isEntrypoint = m_files.empty();
+  if (isEntrypoint && LoadFromCache(file))
+    return;
+
   if (!Load_Internal(file))
     return;
   FlattenExpressions();
   FlattenSkinVariableConditions();
+
+  if (isEntrypoint)
+    StoreInCache(file);
+}
+
+void CGUIIncludes::EnableCache(const std::string& skinId, const std::string& skinVersion)
+{
+  m_cache.Open(skinId, skinVersion);
+}
+
+bool CGUIIncludes::LoadFromCache(const std::string& file)
+{
+  CGUISkinCache::Entry entry;
+  if (!m_cache.IsOpen() || !m_cache.Load(file, "", entry) ||
+      !HaveValues(entry.conditions, nullptr))
+    return false;
+
+  for (const TiXmlElement* child = entry.root->FirstChildElement(); child;
+       child = child->NextSiblingElement())
+  {
+    const std::string& type = child->ValueStr();
+    const std::string name = XMLUtils::GetAttribute(child, type == "default" ? "type" : "name");
+    if (type == "default")
+      m_defaults.try_emplace(name, *child);
+    else if (type == "variable")
+      m_skinvariables.try_emplace(name, *child);
+    else if (type == "constant")
+      m_constants.try_emplace(name, XMLUtils::GetAttribute(child, "value"));
+    else if (type == "expression")
+      m_expressions.try_emplace(name, XMLUtils::GetAttribute(child, "value"));
+    else if (type == "include" && child->LastChild() && child->LastChild()->ToElement())
+    {
+      // the parameters with their defaults, followed by the body
+      Params params;
+      for (const TiXmlElement* param = child->FirstChildElement("param"); param;
+           param = param->NextSiblingElement("param"))
+        params.try_emplace(XMLUtils::GetAttribute(param, "name"),
+                           XMLUtils::GetAttribute(param, "value"));
+      m_includes.try_emplace(name, *child->LastChild()->ToElement(), std::move(params));
+    }
+  }
+
+  m_files = std::move(entry.sources);
+  m_fileConditions = std::move(entry.conditions);
+  m_cacheDigest = std::move(entry.digest);
+  m_cachedFiles = m_files.size();
+
+  CLog::Log(LOGINFO, "Loaded include components of {} files from the skin cache", m_files.size());
+  return true;
+}
+
+void CGUIIncludes::StoreInCache(const std::string& file)
+{
+  if (!m_cache.IsOpen())
+    return;
+
+  TiXmlElement root("includes");
+  for (const auto& [type, node] : m_defaults)
+    root.InsertEndChild(node);
+  for (const auto& [name, node] : m_skinvariables)
+    root.InsertEndChild(node);
+  for (const auto& [tag, values] :
+       {std::pair{"constant", &m_constants}, std::pair{"expression", &m_expressions}})
+  {
+    for (const auto& [name, value] : *values)
+    {
+      TiXmlElement node(tag);
+      node.SetAttribute("name", name);
+      node.SetAttribute("value", value);
+      root.InsertEndChild(node);
+    }
+  }
+  for (const auto& [name, include] : m_includes)
+  {
+    TiXmlElement node("include");
+    node.SetAttribute("name", name);
+    for (const auto& [param, value] : include.second)
+    {
+      TiXmlElement paramNode("param");
+      paramNode.SetAttribute("name", param);
+      paramNode.SetAttribute("value", value);
+      node.InsertEndChild(paramNode);
+    }
+    node.InsertEndChild(include.first);
+    root.InsertEndChild(node);
+  }
+
+  // documents cached before were resolved with other include components
+  m_cache.Clear();
+  m_cacheDigest = m_cache.Store(file, "", root, m_files, m_fileConditions);
+  m_cachedFiles = m_files.size();
+}
+
+bool CGUIIncludes::HaveValues(const CGUISkinCache::Conditions& conditions,
+                              std::map<INFO::InfoPtr, bool>* infos)
+{
+  for (const auto& [condition, value] : conditions)
+  {
+    INFO::InfoPtr info = CServiceBroker::GetGUI()->GetInfoManager().Register(condition);
+    if (!info || info->Get(INFO::DEFAULT_CONTEXT) != value)
+      return false;
+
+    if (infos)
+      infos->emplace(std::move(info), value);
+  }
+  return true;
+}
+
+std::unique_ptr<TiXmlElement> CGUIIncludes::GetCachedDocument(
+    const std::string& file, std::map<INFO::InfoPtr, bool>& includeConditions)
+{
+  includeConditions.clear();
+
+  CGUISkinCache::Entry entry;
+  if (m_cacheDigest.empty() || !m_cache.Load(file, m_cacheDigest, entry) ||
+      !HaveValues(entry.conditions, &includeConditions))
+  {
+    includeConditions.clear();
+    return nullptr;
+  }
+
+  // load the files included when resolving the document, for the skin variables they define
+  for (size_t i = 1; i < entry.sources.size(); ++i)
+  {
+    if (!HasLoaded(entry.sources[i]))
+      Load(entry.sources[i]);
+  }
+
+  return std::move(entry.root);
+}
+
+void CGUIIncludes::CacheDocument(const std::string& file,
+                                 const TiXmlElement& node,
+                                 const std::map<INFO::InfoPtr, bool>& includeConditions)
+{
+  if (m_cacheDigest.empty())
+    return;
+
+  // the document itself, followed by the files included when resolving it
+  std::vector<std::string> sources{file};
+  sources.insert(sources.end(), m_files.begin() + m_cachedFiles, m_files.end());
+
+  CGUISkinCache::Conditions conditions;
+  for (const auto& [info, value] : includeConditions)
+    conditions.emplace_back(info->GetExpression(), value);
+
+  m_cache.Store(file, m_cacheDigest, node, sources, conditions);
 }
 
 bool CGUIIncludes::Load_Internal(const std::string &file)
@@ -221,8 +377,10 @@ void CGUIIncludes::LoadIncludes(const TiXmlElement *node)
 
       if (condition)
       { // load include file if condition evals to true
-        if (CServiceBroker::GetGUI()->GetInfoManager().Register(condition)->Get(
-                INFO::DEFAULT_CONTEXT))
+        const bool value = CServiceBroker::GetGUI()->GetInfoManager().Register(condition)->Get(
+            INFO::DEFAULT_CONTEXT);
+        m_fileConditions.emplace_back(condition, value);
+        if (value)
           Load_Internal(file);
       }
       else
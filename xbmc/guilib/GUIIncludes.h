@@ -8,10 +8,12 @@
 
 #pragma once
 
+#include "guilib/GUISkinCache.h"
 #include "interfaces/info/InfoBool.h"
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -28,6 +30,8 @@ namespace INFO
 
 class CGUIIncludes
 {
+  friend class TestGUIIncludesHelper;
+
 public:
   CGUIIncludes();
   ~CGUIIncludes();
@@ -46,6 +50,37 @@ public:
   */
   void Load(const std::string &file);
 
+  /*!
+   \brief Keep the loaded include components and the documents resolved with them in the skin
+   cache, see CGUISkinCache. Must be called before loading the main entrypoint.
+
+   \param skinId the id of the skin
+   \param skinVersion the version of the skin
+   */
+  void EnableCache(const std::string& skinId, const std::string& skinVersion);
+
+  /*!
+   \brief Get a document resolved before, if none of its files and none of the values of its
+   include conditions changed since.
+
+   \param file the file of the document
+   \param includeConditions [out] the conditions of the resolved includes
+   \return the resolved document, nullptr if not cached
+   */
+  std::unique_ptr<TiXmlElement> GetCachedDocument(
+      const std::string& file, std::map<INFO::InfoPtr, bool>& includeConditions);
+
+  /*!
+   \brief Cache a document resolved by Resolve().
+
+   \param file the file of the document
+   \param node the resolved document
+   \param includeConditions the conditions of the resolved includes
+   */
+  void CacheDocument(const std::string& file,
+                     const TiXmlElement& node,
+                     const std::map<INFO::InfoPtr, bool>& includeConditions);
+
   /*!
    \brief Resolve all include components (defaults, constants, variables, expressions and includes)
    for the given \code{node}. Place the conditions specified for <include> elements in \code{includeConditions}.
@@ -83,6 +118,11 @@ private:
 
   bool HasLoaded(const std::string &file) const;
 
+  bool LoadFromCache(const std::string& file);
+  void StoreInCache(const std::string& file);
+  static bool HaveValues(const CGUISkinCache::Conditions& conditions,
+                         std::map<INFO::InfoPtr, bool>* infos);
+
   void LoadDefaults(const TiXmlElement *node);
   void LoadIncludes(const TiXmlElement *node);
   void LoadVariables(const TiXmlElement *node);
@@ -122,6 +162,11 @@ private:
   std::string ResolveExpressions(const std::string &expression) const;
 
   std::vector<std::string> m_files;
+  CGUISkinCache::Conditions m_fileConditions; ///< conditions of the included files
+
+  CGUISkinCache m_cache;
+  std::string m_cacheDigest; ///< of the cached include components, empty if not cached
+  size_t m_cachedFiles = 0; ///< number of files loaded with the cached include components
 
   struct StringHash
   {
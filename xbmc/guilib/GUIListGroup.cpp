@@ -96,6 +96,13 @@ void CGUIListGroup::UpdateVisibility(const CGUIListItem *item)
   m_item = item;
 }
 
+void CGUIListGroup::GetPrefetchImages(const CGUIListItem* item,
+                                      std::vector<LargeImageRequest>& images) const
+{
+  for (const CGUIControl* control : m_children)
+    control->GetPrefetchImages(item, images);
+}
+
 void CGUIListGroup::UpdateInfo(const CGUIListItem *item)
 {
   for (iControls it = m_children.begin(); it != m_children.end(); it++)
@@ -33,6 +33,8 @@ public:
   void ResetAnimation(ANIMATION_TYPE type) override;
   void UpdateVisibility(const CGUIListItem *item = NULL) override;
   void UpdateInfo(const CGUIListItem *item) override;
+  void GetPrefetchImages(const CGUIListItem* item,
+                         std::vector<LargeImageRequest>& images) const override;
   void SetInvalid() override;
 
   void EnlargeWidth(float difference);
@@ -92,6 +92,12 @@ void CGUIListItemLayout::Process(CGUIListItem *item, int parentID, unsigned int
   m_group.DoProcess(currentTime, dirtyregions);
 }
 
+void CGUIListItemLayout::GetPrefetchImages(const CGUIListItem* item,
+                                           std::vector<LargeImageRequest>& images) const
+{
+  m_group.GetPrefetchImages(item, images);
+}
+
 void CGUIListItemLayout::Render(CGUIListItem *item, int parentID)
 {
   m_group.DoRender();
@@ -35,6 +35,7 @@ public:
   void SetInvalid() { m_invalidated = true; }
   void FreeResources(bool immediately = false);
   void SetParentControl(CGUIControl* control) { m_group.SetParentControl(control); }
+  void GetPrefetchImages(const CGUIListItem* item, std::vector<LargeImageRequest>& images) const;
   void AssignDepth();
 
   //#ifdef GUILIB_PYTHON_COMPATIBILITY
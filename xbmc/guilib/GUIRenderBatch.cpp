@@ -0,0 +1,167 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIRenderBatch.h"
+
+#include <algorithm>
+#include <limits>
+
+CGUIRenderBatch::SubmitQuadsFunc CGUIRenderBatch::m_submitQuadsFunc;
+
+void CGUIRenderBatch::Register(const SubmitQuadsFunc& submitQuadsFunction)
+{
+  m_submitQuadsFunc = submitQuadsFunction;
+}
+
+CRect CGUIRenderBatch::GetBounds(const Vertex* vertices, size_t count)
+{
+  CRect bounds(vertices[0].x, vertices[0].y, vertices[0].x, vertices[0].y);
+  for (size_t i = 0; i < count; ++i)
+  {
+    // rotated out of the screen plane, the projection may move it anywhere
+    if (vertices[i].z != 0.0f)
+    {
+      constexpr float max = std::numeric_limits<float>::max();
+      return CRect(-max, -max, max, max);
+    }
+    bounds.x1 = std::min(bounds.x1, vertices[i].x);
+    bounds.y1 = std::min(bounds.y1, vertices[i].y);
+    bounds.x2 = std::max(bounds.x2, vertices[i].x);
+    bounds.y2 = std::max(bounds.y2, vertices[i].y);
+  }
+  return bounds;
+}
+
+void CGUIRenderBatch::AddQuad(const State& state, const Vertex* vertices)
+{
+  const CRect bounds = GetBounds(vertices, 4);
+
+  Entry* entry = FindEntry(state, nullptr, bounds);
+  if (!entry)
+  {
+    entry = &NextEntry();
+    entry->state = state;
+    entry->bounds = bounds;
+  }
+  else
+    entry->bounds.Union(bounds);
+
+  entry->vertices.insert(entry->vertices.end(), vertices, vertices + 4);
+}
+
+void CGUIRenderBatch::AddQueued(
+    const State& state, IDrawer& drawer, size_t first, size_t last, const CRect& bounds)
+{
+  if (first == last)
+    return;
+
+  Entry* entry = FindEntry(state, &drawer, bounds);
+  // only a range following on the one before can be merged
+  if (entry && entry->last == first)
+  {
+    entry->bounds.Union(bounds);
+    entry->last = last;
+    return;
+  }
+
+  entry = &NextEntry();
+  entry->state = state;
+  entry->bounds = bounds;
+  entry->drawer = &drawer;
+  entry->first = first;
+  entry->last = last;
+
+  if (std::find(m_drawers.begin(), m_drawers.end(), &drawer) == m_drawers.end())
+    m_drawers.emplace_back(&drawer);
+}
+
+CGUIRenderBatch::Entry* CGUIRenderBatch::FindEntry(const State& state,
+                                                   const IDrawer* drawer,
+                                                   const CRect& bounds)
+{
+  for (size_t i = m_used; i > 0 && m_used - i < LOOKBACK; --i)
+  {
+    Entry& entry = m_entries[i - 1];
+    if (entry.drawer == drawer && entry.state == state &&
+        (drawer || entry.vertices.size() < MAX_QUADS * 4))
+      return &entry;
+
+    // drawing it earlier would put it below something drawn on top before
+    if (entry.bounds.Intersects(bounds))
+      break;
+  }
+  return nullptr;
+}
+
+CGUIRenderBatch::Entry& CGUIRenderBatch::NextEntry()
+{
+  if (m_used == m_entries.size())
+    m_entries.emplace_back();
+
+  Entry& entry = m_entries[m_used++];
+  entry.drawer = nullptr;
+  entry.vertices.clear();
+  return entry;
+}
+
+void CGUIRenderBatch::Flush()
+{
+  // the draws below change the render state themselves
+  if (m_flushing || m_used == 0)
+    return;
+
+  m_flushing = true;
+  m_lastState.reset();
+
+  for (size_t i = 0; i < m_used; ++i)
+  {
+    const Entry& entry = m_entries[i];
+    Count(entry.state);
+    if (entry.drawer)
+    {
+      m_frame.drawCalls += entry.drawer->DrawQueued(entry.state, entry.first, entry.last);
+    }
+    else
+    {
+      if (m_submitQuadsFunc)
+        m_submitQuadsFunc(entry.state, entry.vertices);
+      m_frame.drawCalls++;
+      m_frame.quads += entry.vertices.size() / 4;
+    }
+  }
+
+  for (IDrawer* drawer : m_drawers)
+    drawer->ClearQueued();
+
+  m_drawers.clear();
+  m_used = 0;
+  m_flushing = false;
+}
+
+void CGUIRenderBatch::CountUnbatchedDraw()
+{
+  Flush();
+  m_frame.drawCalls++;
+  m_frame.stateChanges++;
+  m_lastState.reset();
+}
+
+void CGUIRenderBatch::Count(const State& state)
+{
+  if (!m_lastState || !(*m_lastState == state))
+    m_frame.stateChanges++;
+  m_lastState = state;
+}
+
+void CGUIRenderBatch::EndFrame()
+{
+  Flush();
+  if (m_frame.drawCalls > 0)
+    m_lastFrame = m_frame;
+  m_frame = {};
+}
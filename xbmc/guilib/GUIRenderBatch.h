@@ -0,0 +1,158 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/ColorUtils.h"
+#include "utils/Geometry.h"
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+class CTexture;
+
+struct GUIRenderStats
+{
+  unsigned int drawCalls{0};
+  unsigned int stateChanges{0}; ///< shader, texture or blend state differing from the draw before
+  unsigned int quads{0};
+};
+
+/*!
+ \ingroup textures
+ \brief Collects the draws of the GUI controls in a frame and submits them in as few draw calls
+ as possible
+
+ Quads of the same render state are merged into an earlier draw, as long as none of the draws in
+ between overlaps them, so the result is the same as drawing everything in order. The batch is
+ drawn before anything else changes the render state, see CRenderSystemBase::FlushRenderBatch().
+ */
+class CGUIRenderBatch
+{
+public:
+  //! everything a draw depends on besides its vertices
+  struct State
+  {
+    int shader{0};
+    CTexture* texture0{nullptr};
+    CTexture* texture1{nullptr};
+    bool blend{false};
+    KODI::UTILS::COLOR::Color color{0xFFFFFFFF};
+    float depth{0.0f};
+
+    bool operator==(const State& other) const = default;
+  };
+
+  struct Vertex
+  {
+    float x, y, z;
+    float u1, v1;
+    float u2, v2;
+  };
+
+  /*!
+   \brief Renderers which draw from their own vertex buffers, like fonts, queue their draws
+   themselves and are called back for ranges of them
+   */
+  class IDrawer
+  {
+  public:
+    virtual ~IDrawer() = default;
+    /*!
+     \brief Draw some of the queued draws
+     \return number of draw calls issued
+     */
+    virtual unsigned int DrawQueued(const State& state, size_t first, size_t last) = 0;
+    //! all queued draws have been drawn
+    virtual void ClearQueued() = 0;
+  };
+
+  using SubmitQuadsFunc =
+      std::function<void(const State& state, const std::vector<Vertex>& vertices)>;
+
+  //! quads of a draw are indexed with 16 bit
+  static constexpr size_t MAX_QUADS = 16384;
+
+  static void Register(const SubmitQuadsFunc& submitQuadsFunction);
+
+  /*!
+   \brief Area covered by some vertices, everything if they aren't flat on the screen
+   */
+  static CRect GetBounds(const Vertex* vertices, size_t count);
+
+  /*!
+   \brief Whether draws are collected across controls, otherwise every texture and label is
+   drawn on its own
+   */
+  void SetEnabled(bool enabled) { m_enabled = enabled; }
+  bool IsEnabled() const { return m_enabled; }
+
+  /*!
+   \brief Queue a quad
+   \param vertices The four corners, top left first and clockwise
+   */
+  void AddQuad(const State& state, const Vertex* vertices);
+
+  /*!
+   \brief Queue draws of a drawer
+   \param first,last Range of the draws in the drawer
+   \param bounds Area the draws may touch
+   */
+  void AddQueued(
+      const State& state, IDrawer& drawer, size_t first, size_t last, const CRect& bounds);
+
+  /*!
+   \brief Draw everything queued
+   */
+  void Flush();
+
+  /*!
+   \brief Count a draw which doesn't go through the batch
+   */
+  void CountUnbatchedDraw();
+
+  /*!
+   \brief Finish the counters of a frame
+   */
+  void EndFrame();
+
+  //! counters of the last frame which drew anything
+  const GUIRenderStats& GetFrameStats() const { return m_lastFrame; }
+
+private:
+  struct Entry
+  {
+    State state;
+    CRect bounds;
+    IDrawer* drawer{nullptr}; ///< nullptr for quads
+    size_t first{0};
+    size_t last{0};
+    std::vector<Vertex> vertices;
+  };
+
+  Entry* FindEntry(const State& state, const IDrawer* drawer, const CRect& bounds);
+  Entry& NextEntry();
+  void Count(const State& state);
+
+  //! how many draws back a draw may be merged into
+  static constexpr size_t LOOKBACK = 16;
+
+  static SubmitQuadsFunc m_submitQuadsFunc;
+
+  bool m_enabled{false};
+  bool m_flushing{false};
+  // entries are kept for their vertex buffers, only the first m_used ones are queued
+  std::vector<Entry> m_entries;
+  size_t m_used{0};
+  std::vector<IDrawer*> m_drawers;
+
+  std::optional<State> m_lastState;
+  GUIRenderStats m_frame;
+  GUIRenderStats m_lastFrame;
+};
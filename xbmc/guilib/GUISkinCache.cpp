@@ -0,0 +1,360 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUISkinCache.h"
+
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Digest.h"
+#include "utils/SystemInfo.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <cstring>
+#include <mutex>
+
+#include <tinyxml.h>
+
+using namespace XFILE;
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+constexpr const char* CACHE_PATH = "special://temp/skincache/";
+constexpr const char* CACHE_EXT = ".ksc";
+constexpr char CACHE_MAGIC[4] = {'K', 'S', 'K', 'C'};
+constexpr uint32_t CACHE_VERSION = 1;
+constexpr int MAX_DEPTH = 256;
+
+enum NodeType : uint8_t
+{
+  NODE_ELEMENT,
+  NODE_TEXT,
+  NODE_CDATA,
+};
+
+/* An element is stored as its name, its attributes and its children, each list preceded by its
+ * size. Text children are stored with their value only, comments and declarations are dropped.
+ */
+class CWriter
+{
+public:
+  void Put(const void* data, size_t size) { m_buffer.append(static_cast<const char*>(data), size); }
+  void Put(uint8_t value) { Put(&value, sizeof(value)); }
+  void Put(uint32_t value) { Put(&value, sizeof(value)); }
+  void Put(int64_t value) { Put(&value, sizeof(value)); }
+  void Put(const std::string& value)
+  {
+    Put(static_cast<uint32_t>(value.size()));
+    Put(value.data(), value.size());
+  }
+
+  void Put(const TiXmlElement& element)
+  {
+    Put(element.ValueStr());
+
+    uint32_t count = 0;
+    for (const TiXmlAttribute* attribute = element.FirstAttribute(); attribute;
+         attribute = attribute->Next())
+      ++count;
+    Put(count);
+    for (const TiXmlAttribute* attribute = element.FirstAttribute(); attribute;
+         attribute = attribute->Next())
+    {
+      Put(std::string(attribute->Name()));
+      Put(attribute->ValueStr());
+    }
+
+    count = 0;
+    for (const TiXmlNode* child = element.FirstChild(); child; child = child->NextSibling())
+    {
+      if (child->ToElement() || child->ToText())
+        ++count;
+    }
+    Put(count);
+    for (const TiXmlNode* child = element.FirstChild(); child; child = child->NextSibling())
+    {
+      if (const TiXmlElement* childElement = child->ToElement())
+      {
+        Put(static_cast<uint8_t>(NODE_ELEMENT));
+        Put(*childElement);
+      }
+      else if (const TiXmlText* text = child->ToText())
+      {
+        Put(static_cast<uint8_t>(text->CDATA() ? NODE_CDATA : NODE_TEXT));
+        Put(text->ValueStr());
+      }
+    }
+  }
+
+  const std::string& GetBuffer() const { return m_buffer; }
+
+private:
+  std::string m_buffer;
+};
+
+class CReader
+{
+public:
+  CReader(const uint8_t* data, size_t size) : m_data(data), m_end(data + size) {}
+
+  bool Get(void* data, size_t size)
+  {
+    if (static_cast<size_t>(m_end - m_data) < size)
+      return false;
+    memcpy(data, m_data, size);
+    m_data += size;
+    return true;
+  }
+  bool Get(uint8_t& value) { return Get(&value, sizeof(value)); }
+  bool Get(uint32_t& value) { return Get(&value, sizeof(value)); }
+  bool Get(int64_t& value) { return Get(&value, sizeof(value)); }
+  bool Get(std::string& value)
+  {
+    uint32_t size = 0;
+    if (!Get(size) || static_cast<size_t>(m_end - m_data) < size)
+      return false;
+    value.assign(reinterpret_cast<const char*>(m_data), size);
+    m_data += size;
+    return true;
+  }
+
+  std::unique_ptr<TiXmlElement> GetElement(int depth)
+  {
+    std::string value;
+    uint32_t count = 0;
+    if (depth > MAX_DEPTH || !Get(value) || !Get(count))
+      return nullptr;
+
+    auto element = std::make_unique<TiXmlElement>(value);
+    std::string name;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      if (!Get(name) || !Get(value))
+        return nullptr;
+      element->SetAttribute(name, value);
+    }
+
+    if (!Get(count))
+      return nullptr;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      uint8_t type = 0;
+      if (!Get(type))
+        return nullptr;
+
+      if (type == NODE_ELEMENT)
+      {
+        std::unique_ptr<TiXmlElement> child = GetElement(depth + 1);
+        if (!child)
+          return nullptr;
+        element->LinkEndChild(child.release());
+      }
+      else if ((type == NODE_TEXT || type == NODE_CDATA) && Get(value))
+      {
+        auto text = std::make_unique<TiXmlText>(value);
+        text->SetCDATA(type == NODE_CDATA);
+        element->LinkEndChild(text.release());
+      }
+      else
+        return nullptr;
+    }
+    return element;
+  }
+
+  bool AtEnd() const { return m_data == m_end; }
+
+private:
+  const uint8_t* m_data;
+  const uint8_t* m_end;
+};
+
+bool GetStamp(const std::string& path, int64_t& size, int64_t& time)
+{
+  struct __stat64 st = {};
+  if (CFile::Stat(path, &st) != 0)
+    return false;
+
+  size = st.st_size;
+  time = st.st_mtime;
+  return true;
+}
+} // namespace
+
+void CGUISkinCache::Open(const std::string& skinId, const std::string& skinVersion)
+{
+  std::unique_lock lock(m_critSection);
+  m_path = URIUtils::AddFileToFolder(CACHE_PATH, skinId + "/");
+  // resolving may differ between builds
+  m_key = skinVersion + ' ' + CSysInfo::GetVersion();
+}
+
+void CGUISkinCache::Close()
+{
+  std::unique_lock lock(m_critSection);
+  m_path.clear();
+  m_key.clear();
+}
+
+void CGUISkinCache::Clear()
+{
+  std::unique_lock lock(m_critSection);
+  if (IsOpen() && CDirectory::Exists(m_path) && !CDirectory::RemoveRecursive(m_path))
+    CLog::Log(LOGWARNING, "CGUISkinCache::{} - failed to remove {}", __FUNCTION__, m_path);
+}
+
+std::string CGUISkinCache::GetPath(const std::string& name) const
+{
+  return m_path + CDigest::Calculate(CDigest::Type::MD5, name) + CACHE_EXT;
+}
+
+bool CGUISkinCache::Load(const std::string& name, const std::string& key, Entry& entry) const
+{
+  std::vector<uint8_t> buffer;
+  std::string path;
+  std::string cacheKey;
+  {
+    std::unique_lock lock(m_critSection);
+    if (!IsOpen())
+      return false;
+
+    path = GetPath(name);
+    cacheKey = m_key + '\n' + key;
+    CFile file;
+    if (!CFile::Exists(path) || file.LoadFile(path, buffer) <= 0)
+      return false;
+  }
+
+  CReader reader(buffer.data(), buffer.size());
+  char magic[sizeof(CACHE_MAGIC)];
+  uint32_t version = 0;
+  std::string value;
+  if (!reader.Get(magic, sizeof(magic)) || memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0 ||
+      !reader.Get(version) || version != CACHE_VERSION)
+  {
+    CLog::Log(LOGWARNING, "CGUISkinCache::{} - invalid cache entry {}, removing", __FUNCTION__,
+              path);
+    CFile::Delete(path);
+    return false;
+  }
+
+  if (!reader.Get(value) || value != cacheKey || !reader.Get(value) || value != name)
+  {
+    CLog::Log(LOGDEBUG, "CGUISkinCache::{} - cache entry of {} is outdated", __FUNCTION__, name);
+    return false;
+  }
+
+  uint32_t count = 0;
+  if (!reader.Get(count))
+    return false;
+  entry.sources.clear();
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    int64_t size = 0;
+    int64_t time = 0;
+    int64_t currentSize = 0;
+    int64_t currentTime = 0;
+    if (!reader.Get(value) || !reader.Get(size) || !reader.Get(time))
+      return false;
+    if (!GetStamp(value, currentSize, currentTime) || currentSize != size || currentTime != time)
+    {
+      CLog::Log(LOGDEBUG, "CGUISkinCache::{} - {} changed, not using the cache entry of {}",
+                __FUNCTION__, value, name);
+      return false;
+    }
+    entry.sources.emplace_back(value);
+  }
+
+  if (!reader.Get(count))
+    return false;
+  entry.conditions.clear();
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    uint8_t conditionValue = 0;
+    if (!reader.Get(value) || !reader.Get(conditionValue))
+      return false;
+    entry.conditions.emplace_back(value, conditionValue != 0);
+  }
+
+  entry.root = reader.GetElement(0);
+  if (!entry.root || !reader.AtEnd())
+  {
+    CLog::Log(LOGWARNING, "CGUISkinCache::{} - invalid cache entry {}, removing", __FUNCTION__,
+              path);
+    entry.root.reset();
+    CFile::Delete(path);
+    return false;
+  }
+
+  entry.digest = CDigest::Calculate(CDigest::Type::MD5, buffer.data(), buffer.size());
+  return true;
+}
+
+std::string CGUISkinCache::Store(const std::string& name,
+                                 const std::string& key,
+                                 const TiXmlElement& root,
+                                 const std::vector<std::string>& sources,
+                                 const Conditions& conditions) const
+{
+  std::unique_lock lock(m_critSection);
+  if (!IsOpen())
+    return "";
+
+  CWriter writer;
+  writer.Put(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  writer.Put(CACHE_VERSION);
+  writer.Put(m_key + '\n' + key);
+  writer.Put(name);
+
+  writer.Put(static_cast<uint32_t>(sources.size()));
+  for (const auto& source : sources)
+  {
+    int64_t size = 0;
+    int64_t time = 0;
+    if (!GetStamp(source, size, time))
+      return "";
+    writer.Put(source);
+    writer.Put(size);
+    writer.Put(time);
+  }
+
+  writer.Put(static_cast<uint32_t>(conditions.size()));
+  for (const auto& [condition, value] : conditions)
+  {
+    writer.Put(condition);
+    writer.Put(static_cast<uint8_t>(value));
+  }
+
+  writer.Put(root);
+
+  if ((!CDirectory::Exists(CACHE_PATH) && !CDirectory::Create(CACHE_PATH)) ||
+      (!CDirectory::Exists(m_path) && !CDirectory::Create(m_path)))
+    return "";
+
+  // write to a temporary file first, so a partial entry is never read
+  const std::string path = GetPath(name);
+  const std::string tmpPath = path + ".tmp";
+  const std::string& buffer = writer.GetBuffer();
+  CFile file;
+  bool ok = file.OpenForWrite(tmpPath, true) &&
+            file.Write(buffer.data(), buffer.size()) == static_cast<ssize_t>(buffer.size());
+  file.Close();
+
+  // renaming doesn't replace an existing file on every platform
+  if (ok && CFile::Exists(path))
+    ok = CFile::Delete(path);
+
+  if (!ok || !CFile::Rename(tmpPath, path))
+  {
+    CLog::Log(LOGERROR, "CGUISkinCache::{} - unable to write {}", __FUNCTION__, path);
+    CFile::Delete(tmpPath);
+    return "";
+  }
+
+  return CDigest::Calculate(CDigest::Type::MD5, buffer);
+}
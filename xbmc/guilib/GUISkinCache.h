@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+class TiXmlElement;
+
+/*!
+ \brief On-disk cache of parsed and resolved skin documents.
+
+ Element trees are stored in a compact binary form in special://temp/skincache/, one directory per
+ skin, and restored without parsing XML or resolving includes. An entry is only used for the same
+ skin version and Kodi build, and as long as none of the files it was built from changed. It also
+ records the include conditions it was resolved with, which the user of the cache has to check
+ against their current values.
+ */
+class CGUISkinCache
+{
+public:
+  using Conditions = std::vector<std::pair<std::string, bool>>;
+
+  struct Entry
+  {
+    std::unique_ptr<TiXmlElement> root;
+    std::vector<std::string> sources; ///< files the document was built from
+    Conditions conditions; ///< include conditions and their values the document was resolved with
+    std::string digest; ///< changes whenever anything stored in the entry does
+  };
+
+  /*!
+   \brief Use the entries of the given skin.
+   \param skinId the id of the skin
+   \param skinVersion the version of the skin
+   */
+  void Open(const std::string& skinId, const std::string& skinVersion);
+  void Close();
+  bool IsOpen() const { return !m_path.empty(); }
+
+  /*!
+   \brief Remove all entries of the skin.
+   */
+  void Clear();
+
+  /*!
+   \brief Load the entry of a document.
+   \param name the name of the document, usually the path of its file
+   \param key anything else the document depends on, must match the one it was stored with
+   \param entry [out] the entry
+   \return true if there is a valid entry, false otherwise
+   */
+  bool Load(const std::string& name, const std::string& key, Entry& entry) const;
+
+  /*!
+   \brief Store the entry of a document, replacing any previous one.
+   \param name the name of the document, usually the path of its file
+   \param key anything else the document depends on
+   \param root the document
+   \param sources the files the document was built from
+   \param conditions the include conditions and their values the document was resolved with
+   \return the digest of the entry, empty if it couldn't be stored
+   */
+  std::string Store(const std::string& name,
+                    const std::string& key,
+                    const TiXmlElement& root,
+                    const std::vector<std::string>& sources,
+                    const Conditions& conditions) const;
+
+private:
+  std::string GetPath(const std::string& name) const;
+
+  std::string m_path; ///< directory of the entries of the skin
+  std::string m_key; ///< skin version and Kodi build
+  mutable CCriticalSection m_critSection;
+};
@@ -311,6 +311,9 @@ void CGUITexture::Render(float left,
 
   int orientation = GetOrientation();
   OrientateTexture(texture, u3, v3, orientation);
+  if (m_texture.m_atlas)
+    texture += CPoint(m_texture.m_atlasX * m_texCoordsScaleU,
+                      m_texture.m_atlasY * m_texCoordsScaleV);
 
   if (m_diffuse.size())
   {
@@ -365,7 +368,8 @@ bool CGUITexture::AllocResources()
     if (!IsAllocated())
     {
       CTextureArray texture;
-      texture = CServiceBroker::GetGUI()->GetTextureManager().Load(m_info.filename, true);
+      texture = CServiceBroker::GetGUI()->GetTextureManager().Load(m_info.filename, true,
+                                                                   AllowAtlas());
       if (texture.size())
       {
         m_isAllocated = NORMAL;
@@ -402,7 +406,8 @@ bool CGUITexture::AllocResources()
   }
   else if (!IsAllocated())
   {
-    CTextureArray texture = CServiceBroker::GetGUI()->GetTextureManager().Load(m_info.filename);
+    CTextureArray texture =
+        CServiceBroker::GetGUI()->GetTextureManager().Load(m_info.filename, false, AllowAtlas());
 
     // set allocated to true even if we couldn't load the image to save
     // us hitting the disk every frame
@@ -540,7 +545,8 @@ void CGUITexture::FreeResources(bool immediately /* = false */)
     CServiceBroker::GetGUI()->GetTextureCallbackManager().UnregisterOnWindowResizeCallback(*this);
   }
   else if (m_isAllocated == NORMAL && m_texture.size())
-    CServiceBroker::GetGUI()->GetTextureManager().ReleaseTexture(m_info.filename, immediately);
+    CServiceBroker::GetGUI()->GetTextureManager().ReleaseTexture(m_info.filename, immediately,
+                                                                 m_texture.m_atlas);
 
   if (m_diffuse.size())
     CServiceBroker::GetGUI()->GetTextureManager().ReleaseTexture(m_info.diffuse, immediately);
@@ -745,6 +751,32 @@ bool CGUITexture::SetAspectRatio(const CAspectRatio& aspect)
     return false;
 }
 
+bool CGUITexture::GetLargeImageRequest(const std::string& filename,
+                                       LargeImageRequest& request) const
+{
+  // see AllocResources() and SetFileName()
+  if (filename.empty() || StringUtils::EndsWithNoCase(filename, ".gif"))
+    return false;
+  if (!m_info.useLarge && CServiceBroker::GetGUI()->GetTextureManager().CanLoad(filename))
+    return false;
+
+  request.path = filename;
+  if (m_requestWidth != REQUEST_SIZE_UNSET && m_requestHeight != REQUEST_SIZE_UNSET)
+  {
+    request.width = m_requestWidth;
+    request.height = m_requestHeight;
+  }
+  else
+  {
+    const CGraphicContext& gfxContext = CServiceBroker::GetWinSystem()->GetGfxContext();
+    request.width = static_cast<int>(m_width / gfxContext.GetGUIScaleX() + 0.5f);
+    request.height = static_cast<int>(m_height / gfxContext.GetGUIScaleY() + 0.5f);
+  }
+  request.aspectRatio = m_aspect.ratio;
+  request.useCache = m_use_cache;
+  return true;
+}
+
 bool CGUITexture::SetFileName(const std::string& filename)
 {
   if (m_info.filename == filename) return false;
@@ -773,6 +805,13 @@ void CGUITexture::SetScalingMethod(TEXTURE_SCALING scalingMethod)
 {
   m_scalingMethod = scalingMethod;
 
+  // the atlas page is shared, so get a texture of our own, it's allocated again on demand
+  if (m_texture.m_atlas && !AllowAtlas())
+  {
+    FreeResources(true);
+    return;
+  }
+
   m_texture.SetScalingMethod(m_scalingMethod);
 }
 
@@ -51,6 +51,7 @@ public:
 };
 
 class CGUITexture;
+struct LargeImageRequest;
 
 using CreateGUITextureFunc = std::function<CGUITexture*(
     float posX, float posY, float width, float height, const CTextureInfo& texture)>;
@@ -112,6 +113,14 @@ public:
   const CRect& GetRenderRect() const { return m_vertex; }
   bool IsLazyLoaded() const { return m_info.useLarge; }
 
+  /*!
+   \brief How the texture would request an image from the large texture manager
+   \param filename image to request
+   \param request [out] the request
+   \return false if the image wouldn't be loaded by the large texture manager
+   */
+  bool GetLargeImageRequest(const std::string& filename, LargeImageRequest& request) const;
+
   /*!
    * @brief Get the diffuse color (info color) associated to this texture
    * @return the infocolor associated to this texture
@@ -148,6 +157,8 @@ protected:
               float v3);
   static void OrientateTexture(CRect &rect, float width, float height, int orientation);
   void ResetAnimState();
+  //! whether our texture may be packed onto a shared atlas page, which is scaled linearly
+  bool AllowAtlas() const { return m_scalingMethod != TEXTURE_SCALING::NEAREST; }
 
   // functions that our implementation classes handle
   virtual void Allocate() {}; ///< called after our textures have been allocated
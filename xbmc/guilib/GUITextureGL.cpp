@@ -8,6 +8,7 @@
 
 #include "GUITextureGL.h"
 
+#include "GUIComponent.h"
 #include "ServiceBroker.h"
 #include "Texture.h"
 #include "rendering/gl/RenderSystemGL.h"
@@ -23,6 +24,7 @@
 void CGUITextureGL::Register()
 {
   CGUITexture::Register(CGUITextureGL::CreateTexture, CGUITextureGL::DrawQuad);
+  CGUIRenderBatch::Register(CGUITextureGL::SubmitQuads);
 }
 
 CGUITexture* CGUITextureGL::CreateTexture(
@@ -35,7 +37,6 @@ CGUITextureGL::CGUITextureGL(
     float posX, float posY, float width, float height, const CTextureInfo& texture)
   : CGUITexture(posX, posY, width, height, texture)
 {
-  m_renderSystem = dynamic_cast<CRenderSystemGL*>(CServiceBroker::GetRenderSystem());
 }
 
 CGUITextureGL* CGUITextureGL::Clone() const
@@ -50,8 +51,6 @@ void CGUITextureGL::Begin(KODI::UTILS::COLOR::Color color)
   if (m_diffuse.size())
     m_diffuse.m_textures[0]->LoadToGPU();
 
-  texture->BindToUnit(0);
-
   // Setup Colors
   m_col[0] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color);
   m_col[1] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color);
@@ -59,115 +58,39 @@ void CGUITextureGL::Begin(KODI::UTILS::COLOR::Color color)
   m_col[3] = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::A, color);
 
   bool hasAlpha = m_texture.m_textures[m_currentFrame]->HasAlpha() || m_col[3] < 255;
+  const bool hasBlendColor =
+      m_col[0] != 255 || m_col[1] != 255 || m_col[2] != 255 || m_col[3] != 255;
 
+  ShaderMethodGL shader;
   if (m_diffuse.size())
   {
-    if (m_col[0] == 255 && m_col[1] == 255 && m_col[2] == 255 && m_col[3] == 255 )
-    {
-      m_renderSystem->EnableShader(ShaderMethodGL::SM_MULTI);
-    }
-    else
-    {
-      m_renderSystem->EnableShader(ShaderMethodGL::SM_MULTI_BLENDCOLOR);
-    }
-
+    shader = hasBlendColor ? ShaderMethodGL::SM_MULTI_BLENDCOLOR : ShaderMethodGL::SM_MULTI;
     hasAlpha |= m_diffuse.m_textures[0]->HasAlpha();
-
-    m_diffuse.m_textures[0]->BindToUnit(1);
-  }
-  else
-  {
-    if (m_col[0] == 255 && m_col[1] == 255 && m_col[2] == 255 && m_col[3] == 255)
-    {
-      m_renderSystem->EnableShader(ShaderMethodGL::SM_TEXTURE_NOBLEND);
-    }
-    else
-    {
-      m_renderSystem->EnableShader(ShaderMethodGL::SM_TEXTURE);
-    }
-  }
-
-  if (hasAlpha)
-  {
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
-    glEnable(GL_BLEND);
   }
   else
   {
-    glDisable(GL_BLEND);
+    shader = hasBlendColor ? ShaderMethodGL::SM_TEXTURE : ShaderMethodGL::SM_TEXTURE_NOBLEND;
   }
 
-  m_packedVertices.clear();
-  m_idx.clear();
+  m_batch = &CServiceBroker::GetGUI()->GetRenderBatch();
+  m_state.shader = static_cast<int>(shader);
+  m_state.texture0 = texture;
+  m_state.texture1 = m_diffuse.size() ? m_diffuse.m_textures[0].get() : nullptr;
+  m_state.blend = hasAlpha;
+  m_state.color = color;
+  m_state.depth = m_depth;
 }
 
 void CGUITextureGL::End()
 {
-  if (!m_packedVertices.empty())
-  {
-    GLint posLoc  = m_renderSystem->ShaderGetPos();
-    GLint tex0Loc = m_renderSystem->ShaderGetCoord0();
-    GLint tex1Loc = m_renderSystem->ShaderGetCoord1();
-    GLint uniColLoc = m_renderSystem->ShaderGetUniCol();
-    GLint depthLoc = m_renderSystem->ShaderGetDepth();
-
-    GLuint VertexVBO;
-    GLuint IndexVBO;
-
-    glGenBuffers(1, &VertexVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VertexVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex) * m_packedVertices.size(),
-                 m_packedVertices.data(), GL_STATIC_DRAW);
-
-    glUniform1f(depthLoc, m_depth);
-
-    if (uniColLoc >= 0)
-    {
-      glUniform4f(uniColLoc,(m_col[0] / 255.0f), (m_col[1] / 255.0f), (m_col[2] / 255.0f), (m_col[3] / 255.0f));
-    }
-
-    if (m_diffuse.size())
-    {
-      glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                            reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, u2)));
-      glEnableVertexAttribArray(tex1Loc);
-    }
-
-    glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(PackedVertex),
-                          reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, x)));
-    glEnableVertexAttribArray(posLoc);
-    glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                          reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, u1)));
-    glEnableVertexAttribArray(tex0Loc);
-
-    glGenBuffers(1, &IndexVBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexVBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(ushort)*m_idx.size(), m_idx.data(), GL_STATIC_DRAW);
-
-    glDrawElements(GL_TRIANGLES, m_packedVertices.size()*6 / 4, GL_UNSIGNED_SHORT, 0);
-
-    if (m_diffuse.size())
-      glDisableVertexAttribArray(tex1Loc);
-
-    glDisableVertexAttribArray(posLoc);
-    glDisableVertexAttribArray(tex0Loc);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glDeleteBuffers(1, &VertexVBO);
-    glDeleteBuffers(1, &IndexVBO);
-  }
-
-  if (m_diffuse.size())
-    glActiveTexture(GL_TEXTURE0);
-  glEnable(GL_BLEND);
-
-  m_renderSystem->DisableShader();
+  // without batching every texture is drawn on its own
+  if (!m_batch->IsEnabled())
+    m_batch->Flush();
 }
 
 void CGUITextureGL::Draw(float *x, float *y, float *z, const CRect &texture, const CRect &diffuse, int orientation)
 {
-  PackedVertex vertices[4];
+  CGUIRenderBatch::Vertex vertices[4];
 
   // Setup texture coordinates
   // TopLeft
@@ -236,25 +159,118 @@ void CGUITextureGL::Draw(float *x, float *y, float *z, const CRect &texture, con
       vertices[3].v2 = diffuse.y2;
     }
   }
+  else
+  {
+    for (auto& vertex : vertices)
+      vertex.u2 = vertex.v2 = 0.0f;
+  }
 
   for (int i=0; i<4; i++)
   {
     vertices[i].x = x[i];
     vertices[i].y = y[i];
     vertices[i].z = z[i];
-    m_packedVertices.push_back(vertices[i]);
   }
 
-  if ((m_packedVertices.size() / 4) > (m_idx.size() / 6))
+  m_batch->AddQuad(m_state, vertices);
+}
+
+void CGUITextureGL::SubmitQuads(const CGUIRenderBatch::State& state,
+                                const std::vector<CGUIRenderBatch::Vertex>& vertices)
+{
+  CRenderSystemGL* renderSystem =
+      dynamic_cast<CRenderSystemGL*>(CServiceBroker::GetRenderSystem());
+
+  state.texture0->BindToUnit(0);
+  renderSystem->EnableShader(static_cast<ShaderMethodGL>(state.shader));
+  if (state.texture1)
+    state.texture1->BindToUnit(1);
+
+  if (state.blend)
+  {
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
+    glEnable(GL_BLEND);
+  }
+  else
+  {
+    glDisable(GL_BLEND);
+  }
+
+  GLint posLoc = renderSystem->ShaderGetPos();
+  GLint tex0Loc = renderSystem->ShaderGetCoord0();
+  GLint tex1Loc = renderSystem->ShaderGetCoord1();
+  GLint uniColLoc = renderSystem->ShaderGetUniCol();
+  GLint depthLoc = renderSystem->ShaderGetDepth();
+
+  // the same indices serve every batch, only their number differs
+  static std::vector<GLushort> indices;
+  const size_t quads = vertices.size() / 4;
+  for (size_t i = indices.size() / 6 * 4; i < vertices.size(); i += 4)
   {
-    size_t i = m_packedVertices.size() - 4;
-    m_idx.push_back(i+0);
-    m_idx.push_back(i+1);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+3);
-    m_idx.push_back(i+0);
+    indices.push_back(i + 0);
+    indices.push_back(i + 1);
+    indices.push_back(i + 2);
+    indices.push_back(i + 2);
+    indices.push_back(i + 3);
+    indices.push_back(i + 0);
   }
+
+  GLuint VertexVBO;
+  GLuint IndexVBO;
+
+  glGenBuffers(1, &VertexVBO);
+  glBindBuffer(GL_ARRAY_BUFFER, VertexVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(CGUIRenderBatch::Vertex) * vertices.size(), vertices.data(),
+               GL_STATIC_DRAW);
+
+  glUniform1f(depthLoc, state.depth);
+
+  if (uniColLoc >= 0)
+  {
+    using namespace KODI::UTILS::GL;
+    glUniform4f(uniColLoc, GetChannelFromARGB(ColorChannel::R, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::G, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::B, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::A, state.color) / 255.0f);
+  }
+
+  if (state.texture1)
+  {
+    glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+                          reinterpret_cast<const GLvoid*>(offsetof(CGUIRenderBatch::Vertex, u2)));
+    glEnableVertexAttribArray(tex1Loc);
+  }
+
+  glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+                        reinterpret_cast<const GLvoid*>(offsetof(CGUIRenderBatch::Vertex, x)));
+  glEnableVertexAttribArray(posLoc);
+  glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+                        reinterpret_cast<const GLvoid*>(offsetof(CGUIRenderBatch::Vertex, u1)));
+  glEnableVertexAttribArray(tex0Loc);
+
+  glGenBuffers(1, &IndexVBO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexVBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * quads * 6, indices.data(),
+               GL_STATIC_DRAW);
+
+  glDrawElements(GL_TRIANGLES, quads * 6, GL_UNSIGNED_SHORT, 0);
+
+  if (state.texture1)
+    glDisableVertexAttribArray(tex1Loc);
+
+  glDisableVertexAttribArray(posLoc);
+  glDisableVertexAttribArray(tex0Loc);
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+  glDeleteBuffers(1, &VertexVBO);
+  glDeleteBuffers(1, &IndexVBO);
+
+  if (state.texture1)
+    glActiveTexture(GL_TEXTURE0);
+  glEnable(GL_BLEND);
+
+  renderSystem->DisableShader();
 }
 
 void CGUITextureGL::DrawQuad(const CRect& rect,
@@ -265,6 +281,8 @@ void CGUITextureGL::DrawQuad(const CRect& rect,
                              const bool blending)
 {
   CRenderSystemGL *renderSystem = dynamic_cast<CRenderSystemGL*>(CServiceBroker::GetRenderSystem());
+  CServiceBroker::GetGUI()->GetRenderBatch().CountUnbatchedDraw();
+
   if (texture)
   {
     texture->LoadToGPU();
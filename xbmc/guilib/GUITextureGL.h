@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "GUIRenderBatch.h"
 #include "GUITexture.h"
 #include "utils/ColorUtils.h"
 
@@ -15,8 +16,6 @@
 
 #include "system_gl.h"
 
-class CRenderSystemGL;
-
 class CGUITextureGL : public CGUITexture
 {
 public:
@@ -30,6 +29,8 @@ public:
                        const CRect* texCoords = nullptr,
                        const float depth = 1.0,
                        const bool blending = true);
+  static void SubmitQuads(const CGUIRenderBatch::State& state,
+                          const std::vector<CGUIRenderBatch::Vertex>& vertices);
 
   CGUITextureGL(float posX, float posY, float width, float height, const CTextureInfo& texture);
   ~CGUITextureGL() override = default;
@@ -46,15 +47,7 @@ private:
 
   std::array<GLubyte, 4> m_col;
 
-  struct PackedVertex
-  {
-    float x, y, z;
-    float u1, v1;
-    float u2, v2;
-  };
-
-  std::vector<PackedVertex> m_packedVertices;
-  std::vector<GLushort> m_idx;
-  CRenderSystemGL *m_renderSystem;
+  CGUIRenderBatch* m_batch{nullptr};
+  CGUIRenderBatch::State m_state;
 };
 
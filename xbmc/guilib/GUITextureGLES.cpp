@@ -8,6 +8,7 @@
 
 #include "GUITextureGLES.h"
 
+#include "GUIComponent.h"
 #include "ServiceBroker.h"
 #include "Texture.h"
 #include "guilib/TextureFormats.h"
@@ -19,10 +20,12 @@
 #include "windowing/WinSystem.h"
 
 #include <cstddef>
+#include <utility>
 
 void CGUITextureGLES::Register()
 {
   CGUITexture::Register(CGUITextureGLES::CreateTexture, CGUITextureGLES::DrawQuad);
+  CGUIRenderBatch::Register(CGUITextureGLES::SubmitQuads);
 }
 
 CGUITexture* CGUITextureGLES::CreateTexture(
@@ -70,6 +73,8 @@ void CGUITextureGLES::Begin(KODI::UTILS::COLOR::Color color)
   const bool hasBlendColor =
       m_col[0] != 255 || m_col[1] != 255 || m_col[2] != 255 || m_col[3] != 255;
 
+  ShaderMethodGLES shader;
+  m_swapUnits = false;
   if (m_diffuse.size())
   {
     if (m_isGLES20 && (texture->GetSwizzle() == KD_TEX_SWIZ_111R ||
@@ -77,19 +82,19 @@ void CGUITextureGLES::Begin(KODI::UTILS::COLOR::Color color)
     {
       if (texture->GetSwizzle() == KD_TEX_SWIZ_111R &&
           m_diffuse.m_textures[0]->GetSwizzle() == KD_TEX_SWIZ_111R)
-        m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_111R_111R_BLENDCOLOR);
+        shader = ShaderMethodGLES::SM_MULTI_111R_111R_BLENDCOLOR;
       else if (hasBlendColor)
-        m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_RGBA_111R_BLENDCOLOR);
+        shader = ShaderMethodGLES::SM_MULTI_RGBA_111R_BLENDCOLOR;
       else
-        m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_RGBA_111R);
+        shader = ShaderMethodGLES::SM_MULTI_RGBA_111R;
     }
     else if (hasBlendColor)
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI_BLENDCOLOR);
+      shader = ShaderMethodGLES::SM_MULTI_BLENDCOLOR;
     }
     else
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_MULTI);
+      shader = ShaderMethodGLES::SM_MULTI;
     }
 
     hasAlpha |= m_diffuse.m_textures[0]->HasAlpha();
@@ -97,99 +102,45 @@ void CGUITextureGLES::Begin(KODI::UTILS::COLOR::Color color)
     // We don't need a 111R_RGBA version of the GLES 2.0 shaders, so in the
     // unlikely event of having an alpha-only texture, switch with the
     // diffuse.
-    if (texture->GetSwizzle() == KD_TEX_SWIZ_111R)
-    {
-      texture->BindToUnit(1);
-      m_diffuse.m_textures[0]->BindToUnit(0);
-    }
-    else
-    {
-      texture->BindToUnit(0);
-      m_diffuse.m_textures[0]->BindToUnit(1);
-    }
+    m_swapUnits = texture->GetSwizzle() == KD_TEX_SWIZ_111R;
   }
   else
   {
     if (m_isGLES20 && texture->GetSwizzle() == KD_TEX_SWIZ_111R)
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE_111R);
+      shader = ShaderMethodGLES::SM_TEXTURE_111R;
     }
     else if (hasBlendColor)
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE);
+      shader = ShaderMethodGLES::SM_TEXTURE;
     }
     else
     {
-      m_renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE_NOBLEND);
+      shader = ShaderMethodGLES::SM_TEXTURE_NOBLEND;
     }
-
-    texture->BindToUnit(0);
   }
 
-  if (hasAlpha)
-  {
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
-    glEnable( GL_BLEND );
-  }
-  else
-  {
-    glDisable(GL_BLEND);
-  }
-
-  m_packedVertices.clear();
+  m_batch = &CServiceBroker::GetGUI()->GetRenderBatch();
+  m_state.shader = static_cast<int>(shader);
+  m_state.texture0 = texture;
+  m_state.texture1 = m_diffuse.size() ? m_diffuse.m_textures[0].get() : nullptr;
+  if (m_swapUnits)
+    std::swap(m_state.texture0, m_state.texture1);
+  m_state.blend = hasAlpha;
+  m_state.color = (m_col[3] << 24) | (m_col[0] << 16) | (m_col[1] << 8) | m_col[2];
+  m_state.depth = m_depth;
 }
 
 void CGUITextureGLES::End()
 {
-  if (!m_packedVertices.empty())
-  {
-    GLint posLoc  = m_renderSystem->GUIShaderGetPos();
-    GLint tex0Loc = m_renderSystem->GUIShaderGetCoord0();
-    GLint tex1Loc = m_renderSystem->GUIShaderGetCoord1();
-    GLint uniColLoc = m_renderSystem->GUIShaderGetUniCol();
-    GLint depthLoc = m_renderSystem->GUIShaderGetDepth();
-
-    if(uniColLoc >= 0)
-    {
-      glUniform4f(uniColLoc,(m_col[0] / 255.0f), (m_col[1] / 255.0f), (m_col[2] / 255.0f), (m_col[3] / 255.0f));
-    }
-
-    glUniform1f(depthLoc, m_depth);
-
-    if(m_diffuse.size())
-    {
-      if (m_texture.m_textures[m_currentFrame]->GetSwizzle() == KD_TEX_SWIZ_111R)
-        std::swap(tex0Loc, tex1Loc);
-      glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                            (char*)m_packedVertices.data() + offsetof(PackedVertex, u2));
-      glEnableVertexAttribArray(tex1Loc);
-    }
-    glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(PackedVertex),
-                          (char*)m_packedVertices.data() + offsetof(PackedVertex, x));
-    glEnableVertexAttribArray(posLoc);
-    glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
-                          (char*)m_packedVertices.data() + offsetof(PackedVertex, u1));
-    glEnableVertexAttribArray(tex0Loc);
-
-    glDrawElements(GL_TRIANGLES, m_packedVertices.size()*6 / 4, GL_UNSIGNED_SHORT, m_idx.data());
-
-    if (m_diffuse.size())
-      glDisableVertexAttribArray(tex1Loc);
-
-    glDisableVertexAttribArray(posLoc);
-    glDisableVertexAttribArray(tex0Loc);
-  }
-
-  if (m_diffuse.size())
-    glActiveTexture(GL_TEXTURE0);
-  glEnable(GL_BLEND);
-
-  m_renderSystem->DisableGUIShader();
+  // without batching every texture is drawn on its own
+  if (!m_batch->IsEnabled())
+    m_batch->Flush();
 }
 
 void CGUITextureGLES::Draw(float *x, float *y, float *z, const CRect &texture, const CRect &diffuse, int orientation)
 {
-  PackedVertex vertices[4];
+  CGUIRenderBatch::Vertex vertices[4];
 
   // Setup texture coordinates
   // TopLeft
@@ -258,25 +209,105 @@ void CGUITextureGLES::Draw(float *x, float *y, float *z, const CRect &texture, c
       vertices[3].v2 = diffuse.y2;
     }
   }
+  else
+  {
+    for (auto& vertex : vertices)
+      vertex.u2 = vertex.v2 = 0.0f;
+  }
 
   for (int i=0; i<4; i++)
   {
     vertices[i].x = x[i];
     vertices[i].y = y[i];
     vertices[i].z = z[i];
-    m_packedVertices.push_back(vertices[i]);
+    // the coordinates follow the textures to their units
+    if (m_swapUnits)
+    {
+      std::swap(vertices[i].u1, vertices[i].u2);
+      std::swap(vertices[i].v1, vertices[i].v2);
+    }
   }
 
-  if ((m_packedVertices.size() / 4) > (m_idx.size() / 6))
+  m_batch->AddQuad(m_state, vertices);
+}
+
+void CGUITextureGLES::SubmitQuads(const CGUIRenderBatch::State& state,
+                                  const std::vector<CGUIRenderBatch::Vertex>& vertices)
+{
+  CRenderSystemGLES* renderSystem =
+      dynamic_cast<CRenderSystemGLES*>(CServiceBroker::GetRenderSystem());
+
+  renderSystem->EnableGUIShader(static_cast<ShaderMethodGLES>(state.shader));
+  state.texture0->BindToUnit(0);
+  if (state.texture1)
+    state.texture1->BindToUnit(1);
+
+  if (state.blend)
+  {
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
+    glEnable( GL_BLEND );
+  }
+  else
+  {
+    glDisable(GL_BLEND);
+  }
+
+  GLint posLoc  = renderSystem->GUIShaderGetPos();
+  GLint tex0Loc = renderSystem->GUIShaderGetCoord0();
+  GLint tex1Loc = renderSystem->GUIShaderGetCoord1();
+  GLint uniColLoc = renderSystem->GUIShaderGetUniCol();
+  GLint depthLoc = renderSystem->GUIShaderGetDepth();
+
+  // the same indices serve every batch, only their number differs
+  static std::vector<GLushort> indices;
+  for (size_t i = indices.size() / 6 * 4; i < vertices.size(); i += 4)
   {
-    size_t i = m_packedVertices.size() - 4;
-    m_idx.push_back(i+0);
-    m_idx.push_back(i+1);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+2);
-    m_idx.push_back(i+3);
-    m_idx.push_back(i+0);
+    indices.push_back(i + 0);
+    indices.push_back(i + 1);
+    indices.push_back(i + 2);
+    indices.push_back(i + 2);
+    indices.push_back(i + 3);
+    indices.push_back(i + 0);
   }
+
+  if(uniColLoc >= 0)
+  {
+    using namespace KODI::UTILS::GL;
+    glUniform4f(uniColLoc, GetChannelFromARGB(ColorChannel::R, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::G, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::B, state.color) / 255.0f,
+                GetChannelFromARGB(ColorChannel::A, state.color) / 255.0f);
+  }
+
+  glUniform1f(depthLoc, state.depth);
+
+  const char* data = reinterpret_cast<const char*>(vertices.data());
+  if (state.texture1)
+  {
+    glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+                          data + offsetof(CGUIRenderBatch::Vertex, u2));
+    glEnableVertexAttribArray(tex1Loc);
+  }
+  glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+                        data + offsetof(CGUIRenderBatch::Vertex, x));
+  glEnableVertexAttribArray(posLoc);
+  glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(CGUIRenderBatch::Vertex),
+                        data + offsetof(CGUIRenderBatch::Vertex, u1));
+  glEnableVertexAttribArray(tex0Loc);
+
+  glDrawElements(GL_TRIANGLES, vertices.size() * 6 / 4, GL_UNSIGNED_SHORT, indices.data());
+
+  if (state.texture1)
+    glDisableVertexAttribArray(tex1Loc);
+
+  glDisableVertexAttribArray(posLoc);
+  glDisableVertexAttribArray(tex0Loc);
+
+  if (state.texture1)
+    glActiveTexture(GL_TEXTURE0);
+  glEnable(GL_BLEND);
+
+  renderSystem->DisableGUIShader();
 }
 
 void CGUITextureGLES::DrawQuad(const CRect& rect,
@@ -287,6 +318,8 @@ void CGUITextureGLES::DrawQuad(const CRect& rect,
                                const bool blending)
 {
   CRenderSystemGLES *renderSystem = dynamic_cast<CRenderSystemGLES*>(CServiceBroker::GetRenderSystem());
+  CServiceBroker::GetGUI()->GetRenderBatch().CountUnbatchedDraw();
+
   if (texture)
   {
     texture->LoadToGPU();
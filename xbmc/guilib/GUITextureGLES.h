@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "GUIRenderBatch.h"
 #include "GUITexture.h"
 #include "utils/ColorUtils.h"
 
@@ -16,14 +17,6 @@
 
 #include "system_gl.h"
 
-struct PackedVertex
-{
-  float x, y, z;
-  float u1, v1;
-  float u2, v2;
-};
-typedef std::vector<PackedVertex> PackedVertices;
-
 class CRenderSystemGLES;
 
 class CGUITextureGLES : public CGUITexture
@@ -39,6 +32,8 @@ public:
                        const CRect* texCoords = nullptr,
                        const float depth = 1.0,
                        const bool blending = true);
+  static void SubmitQuads(const CGUIRenderBatch::State& state,
+                          const std::vector<CGUIRenderBatch::Vertex>& vertices);
 
   CGUITextureGLES(float posX, float posY, float width, float height, const CTextureInfo& texture);
   ~CGUITextureGLES() override = default;
@@ -55,8 +50,9 @@ private:
 
   std::array<GLubyte, 4> m_col;
 
-  PackedVertices m_packedVertices;
-  std::vector<GLushort> m_idx;
+  CGUIRenderBatch* m_batch{nullptr};
+  CGUIRenderBatch::State m_state;
+  bool m_swapUnits{false}; ///< texture on unit 1 and diffuse on unit 0
   CRenderSystemGLES *m_renderSystem;
   bool m_isGLES20{true};
 };
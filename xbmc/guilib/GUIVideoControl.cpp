@@ -9,6 +9,7 @@
 #include "GUIVideoControl.h"
 
 #include "GUIComponent.h"
+#include "GUIRenderBatch.h"
 #include "GUITexture.h"
 #include "GUIWindowManager.h"
 #include "ServiceBroker.h"
@@ -47,6 +48,8 @@ void CGUIVideoControl::Render()
   if (CServiceBroker::GetWinSystem()->GetGfxContext().GetRenderOrder() ==
       RENDER_ORDER_FRONT_TO_BACK)
     return;
+  // the player draws by itself, the controls below have to be drawn first
+  CServiceBroker::GetGUI()->GetRenderBatch().Flush();
   auto& components = CServiceBroker::GetAppComponents();
   const auto appPlayer = components.GetComponent<CApplicationPlayer>();
   if (appPlayer->IsRenderingVideo())
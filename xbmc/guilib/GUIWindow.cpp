@@ -126,6 +126,19 @@ bool CGUIWindow::Load(const std::string& strFileName, bool bContainsPath)
 
 bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLowerPath)
 {
+  // use the window resolved in a previous run if none of its files and include conditions changed
+  auto skin = CServiceBroker::GetGUI()->GetSkinInfo();
+  if (skin)
+  {
+    const std::unique_ptr<TiXmlElement> cachedRoot =
+        skin->GetCachedWindow(strPath, m_xmlIncludeConditions);
+    if (cachedRoot)
+    {
+      CLog::Log(LOGDEBUG, "Using cached resolved xml for {}", strPath);
+      return Load(cachedRoot.get());
+    }
+  }
+
   // load window xml if we don't have it stored yet
   if (!m_windowXMLRootElement)
   {
@@ -154,7 +167,11 @@ bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLower
   else
     CLog::Log(LOGDEBUG, "Using already stored xml root node for {}", strPath);
 
-  return Load(Prepare(m_windowXMLRootElement).get());
+  const std::unique_ptr<TiXmlElement> preparedRoot = Prepare(m_windowXMLRootElement);
+  if (skin && preparedRoot)
+    skin->CacheWindow(strPath, *preparedRoot, m_xmlIncludeConditions);
+
+  return Load(preparedRoot.get());
 }
 
 std::unique_ptr<TiXmlElement> CGUIWindow::Prepare(const std::unique_ptr<TiXmlElement>& rootElement)
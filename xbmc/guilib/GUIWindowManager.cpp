@@ -12,6 +12,7 @@
 #include "GUIDialog.h"
 #include "GUIInfoManager.h"
 #include "GUIPassword.h"
+#include "GUIRenderBatch.h"
 #include "GUITexture.h"
 #include "ServiceBroker.h"
 #include "WindowIDs.h"
@@ -1376,6 +1377,10 @@ bool CGUIWindowManager::Render()
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   CSingleExit lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
+  CGUIRenderBatch& batch = CServiceBroker::GetGUI()->GetRenderBatch();
+  batch.SetEnabled(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiBatchRendering);
+
   int bufferAge = CServiceBroker::GetWinSystem()->GetBufferAge();
   bool visualizeDirtyRegions =
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiVisualizeDirtyRegions;
@@ -1433,11 +1438,15 @@ bool CGUIWindowManager::Render()
       CGUITexture::DrawQuad(i, 0x4c00ff00);
   }
 
+  // everything has to be on screen before the video is drawn over it in RenderEx()
+  batch.Flush();
+
   return hasRendered;
 }
 
 void CGUIWindowManager::AfterRender()
 {
+  CServiceBroker::GetGUI()->GetRenderBatch().EndFrame();
   CServiceBroker::GetWinSystem()->GetGfxContext().ResetDepth();
   CGUIWindow* pWindow = GetWindow(GetActiveWindow());
   if (pWindow)
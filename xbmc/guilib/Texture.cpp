@@ -100,7 +100,9 @@ std::unique_ptr<CTexture> CTexture::LoadFromFile(const std::string& texturePath,
                                                  unsigned int idealWidth,
                                                  unsigned int idealHeight,
                                                  CAspectRatio::AspectRatio aspectRatio,
-                                                 const std::string& strMimeType)
+                                                 const std::string& strMimeType,
+                                                 unsigned int maxDecodeWidth,
+                                                 unsigned int maxDecodeHeight)
 {
 #if defined(TARGET_ANDROID)
   CURL url(texturePath);
@@ -125,7 +127,8 @@ std::unique_ptr<CTexture> CTexture::LoadFromFile(const std::string& texturePath,
   }
 #endif
   std::unique_ptr<CTexture> texture = CTexture::CreateTexture();
-  if (texture->LoadFromFileInternal(texturePath, idealWidth, idealHeight, aspectRatio, strMimeType))
+  if (texture->LoadFromFileInternal(texturePath, idealWidth, idealHeight, aspectRatio, strMimeType,
+                                    maxDecodeWidth, maxDecodeHeight))
     return texture;
   return {};
 }
@@ -144,21 +147,48 @@ std::unique_ptr<CTexture> CTexture::LoadFromFileInMemory(unsigned char* buffer,
   return {};
 }
 
+bool CTexture::SupportsDXT()
+{
+  const CRenderSystemBase* renderSystem = CServiceBroker::GetRenderSystem();
+  return renderSystem && renderSystem->IsExtSupported("GL_EXT_texture_compression_s3tc");
+}
+
 bool CTexture::LoadFromFileInternal(const std::string& texturePath,
                                     unsigned int idealWidth,
                                     unsigned int idealHeight,
                                     CAspectRatio::AspectRatio aspectRatio,
-                                    const std::string& strMimeType)
+                                    const std::string& strMimeType,
+                                    unsigned int maxDecodeWidth,
+                                    unsigned int maxDecodeHeight)
 {
   if (URIUtils::HasExtension(texturePath, ".dds"))
   { // special case for DDS images
     CDDSImage image;
-    if (image.ReadFile(texturePath))
+    if (!image.ReadFile(texturePath))
+      return false;
+
+    // compressed ones go to the GPU as they are
+    if (image.GetFormat() != XB_FMT_A8R8G8B8 && !SupportsDXT())
+      return false;
+
+    const KD_TEX_ALPHA alpha = image.HasAlpha() ? KD_TEX_ALPHA_STRAIGHT : KD_TEX_ALPHA_OPAQUE;
+    switch (image.GetFormat())
     {
-      Update(image.GetWidth(), image.GetHeight(), 0, image.GetFormat(), image.GetData(), false);
-      return true;
+      case XB_FMT_DXT1:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_S3TC_RGB8, alpha, KD_TEX_SWIZ_RGBA);
+      case XB_FMT_DXT3:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_S3TC_RGB8_A4, alpha, KD_TEX_SWIZ_RGBA);
+      case XB_FMT_DXT5:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_S3TC_RGBA8, alpha, KD_TEX_SWIZ_RGBA);
+      case XB_FMT_A8R8G8B8:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_SDR_BGRA8, alpha, KD_TEX_SWIZ_RGBA);
+      default:
+        return false;
     }
-    return false;
   }
 
   // Read image into memory to use our vfs
@@ -207,7 +237,8 @@ bool CTexture::LoadFromFileInternal(const std::string& texturePath,
   else
     pImage = ImageFactory::CreateLoaderFromMimeType(strMimeType);
 
-  if (!LoadIImage(pImage, buf.data(), buf.size(), idealWidth, idealHeight, aspectRatio))
+  if (!LoadIImage(pImage, buf.data(), buf.size(), idealWidth, idealHeight, aspectRatio,
+                  maxDecodeWidth, maxDecodeHeight))
   {
     CLog::Log(LOGDEBUG, "{} - Load of {} failed.", __FUNCTION__, CURL::GetRedacted(texturePath));
     delete pImage;
@@ -243,13 +274,31 @@ bool CTexture::LoadIImage(IImage* pImage,
                           unsigned int bufSize,
                           unsigned int idealWidth,
                           unsigned int idealHeight,
-                          CAspectRatio::AspectRatio aspectRatio)
+                          CAspectRatio::AspectRatio aspectRatio,
+                          unsigned int maxDecodeWidth,
+                          unsigned int maxDecodeHeight)
 {
   if (pImage == nullptr)
     return false;
 
   unsigned int maxTextureSize = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
-  if (!pImage->LoadImageFromMemory(buffer, bufSize, maxTextureSize, maxTextureSize))
+
+  // the decoder may scale down to the size the image ends up in. Without a limit from the caller
+  // that's only known up front when it's fitted into the ideal size: centered images keep their
+  // own size, stretched and scaled ones may need more than the fitted size in one direction.
+  if (aspectRatio == CAspectRatio::KEEP && !maxDecodeWidth && !maxDecodeHeight)
+  {
+    maxDecodeWidth = idealWidth;
+    maxDecodeHeight = idealHeight;
+  }
+  unsigned int decodeWidth = maxTextureSize;
+  unsigned int decodeHeight = maxTextureSize;
+  if (maxDecodeWidth)
+    decodeWidth = std::min(maxDecodeWidth, maxTextureSize);
+  if (maxDecodeHeight)
+    decodeHeight = std::min(maxDecodeHeight, maxTextureSize);
+
+  if (!pImage->LoadImageFromMemory(buffer, bufSize, decodeWidth, decodeHeight))
     return false;
 
   if (pImage->Width() == 0 || pImage->Height() == 0)
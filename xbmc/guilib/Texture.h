@@ -46,6 +46,9 @@ public:
    \param idealHeight the ideal height of the texture (defaults to 0, no ideal height).
    \param aspectRatio the aspect ratio mode of the texture (defaults to "center").
    \param strMimeType mimetype of the given texture if available (defaults to empty)
+   \param maxDecodeWidth,maxDecodeHeight the size the caller fits the texture into afterwards, 0 for
+   no limit. The decoder may scale the image down to no less than that. The ideal size serves as
+   that limit for "keep" on its own.
    \return a CTexture std::unique_ptr to the created texture - nullptr if the texture failed to load.
    */
   static std::unique_ptr<CTexture> LoadFromFile(
@@ -53,7 +56,9 @@ public:
       unsigned int idealWidth = 0,
       unsigned int idealHeight = 0,
       CAspectRatio::AspectRatio aspectRatio = CAspectRatio::CENTER,
-      const std::string& strMimeType = "");
+      const std::string& strMimeType = "",
+      unsigned int maxDecodeWidth = 0,
+      unsigned int maxDecodeHeight = 0);
 
   /*! \brief Load a texture from a file in memory
    Loads a texture from a file in memory, restricting in size if needed based on maxHeight and maxWidth.
@@ -74,6 +79,10 @@ public:
       unsigned int idealHeight = 0,
       CAspectRatio::AspectRatio aspectRatio = CAspectRatio::CENTER);
 
+  /*! \brief Whether DXT compressed textures, e.g. from .dds files, can be uploaded to the GPU
+   */
+  static bool SupportsDXT();
+
   bool LoadFromMemory(unsigned int width,
                       unsigned int height,
                       unsigned int pitch,
@@ -151,11 +160,15 @@ protected:
                             unsigned int idealWidth,
                             unsigned int idealHeight,
                             CAspectRatio::AspectRatio aspectRatio,
-                            const std::string& strMimeType = "");
+                            const std::string& strMimeType = "",
+                            unsigned int maxDecodeWidth = 0,
+                            unsigned int maxDecodeHeight = 0);
   bool LoadIImage(IImage* pImage,
                   unsigned char* buffer,
                   unsigned int bufSize,
                   unsigned int idealWidth,
                   unsigned int idealHeight,
-                  CAspectRatio::AspectRatio aspectRatio);
+                  CAspectRatio::AspectRatio aspectRatio,
+                  unsigned int maxDecodeWidth = 0,
+                  unsigned int maxDecodeHeight = 0);
 };
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TextureAtlas.h"
+
+#include "ServiceBroker.h"
+#include "Texture.h"
+#include "rendering/RenderSystem.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+// every texture gets a border of one pixel repeating its edges, so that linear filtering at
+// the edges doesn't pick up the neighbours on the page
+constexpr unsigned int GUTTER = 1;
+constexpr unsigned int BYTES_PER_PIXEL = 4;
+} // namespace
+
+std::optional<std::pair<unsigned int, unsigned int>> CTextureAtlasPacker::Add(unsigned int width,
+                                                                              unsigned int height)
+{
+  if (width > m_size || height > m_size)
+    return {};
+
+  // lowest shelf with enough room left
+  Shelf* best = nullptr;
+  for (Shelf& shelf : m_shelves)
+  {
+    if (shelf.height >= height && m_size - shelf.width >= width &&
+        (!best || shelf.height < best->height))
+      best = &shelf;
+  }
+
+  // a new shelf is better than wasting more than half the height of an existing one
+  const unsigned int top = m_shelves.empty() ? 0 : m_shelves.back().y + m_shelves.back().height;
+  if ((!best || best->height > 2 * height) && m_size - top >= height)
+    best = &m_shelves.emplace_back(Shelf{top, height, 0});
+
+  if (!best)
+    return {};
+
+  const std::pair<unsigned int, unsigned int> position{best->width, best->y};
+  best->width += width;
+  m_usedArea += width * height;
+  return position;
+}
+
+std::optional<CTextureAtlas::Region> CTextureAtlas::Add(const CTexture& texture)
+{
+  const unsigned int width = texture.GetWidth();
+  const unsigned int height = texture.GetHeight();
+  if (!texture.GetPixels() || texture.GetTextureFormat() != KD_TEX_FMT_SDR_BGRA8 ||
+      texture.GetSwizzle() != KD_TEX_SWIZ_RGBA || width == 0 || height == 0 ||
+      width > MAX_TEXTURE_SIZE || height > MAX_TEXTURE_SIZE)
+    return {};
+
+  const unsigned int paddedWidth = width + 2 * GUTTER;
+  const unsigned int paddedHeight = height + 2 * GUTTER;
+  const bool alpha = texture.HasAlpha();
+
+  for (Page& page : m_pages)
+  {
+    // the staging pixels of a page are gone once it was uploaded, see CTexture::LoadToGPU()
+    if (page.alpha != alpha || !page.texture->GetPixels())
+      continue;
+
+    if (const auto position = page.packer.Add(paddedWidth, paddedHeight))
+    {
+      const unsigned int x = position->first + GUTTER;
+      const unsigned int y = position->second + GUTTER;
+      Copy(texture, *page.texture, x, y);
+      return Region{page.texture, x, y};
+    }
+  }
+
+  const unsigned int size =
+      std::min(PAGE_SIZE, CServiceBroker::GetRenderSystem()->GetMaxTextureSize());
+  std::shared_ptr<CTexture> pageTexture = CTexture::CreateTexture(size, size, XB_FMT_A8R8G8B8);
+  if (!pageTexture || !pageTexture->GetPixels() || pageTexture->GetTextureWidth() != size ||
+      pageTexture->GetTextureHeight() != size)
+    return {};
+
+  std::memset(pageTexture->GetPixels(), 0, pageTexture->GetPitch() * pageTexture->GetRows());
+  pageTexture->SetAlpha(alpha);
+
+  Page& page = m_pages.emplace_back(Page{std::move(pageTexture), CTextureAtlasPacker(size), alpha});
+  const auto position = page.packer.Add(paddedWidth, paddedHeight);
+  if (!position)
+    return {};
+
+  const unsigned int x = position->first + GUTTER;
+  const unsigned int y = position->second + GUTTER;
+  Copy(texture, *page.texture, x, y);
+  return Region{page.texture, x, y};
+}
+
+void CTextureAtlas::FreeUnusedPages()
+{
+  std::erase_if(m_pages, [](const Page& page) { return page.texture.use_count() == 1; });
+}
+
+void CTextureAtlas::Copy(const CTexture& texture, CTexture& page, unsigned int x, unsigned int y)
+{
+  const unsigned int width = texture.GetWidth();
+  const unsigned int height = texture.GetHeight();
+  const unsigned int srcPitch = texture.GetPitch();
+  const unsigned int dstPitch = page.GetPitch();
+  const unsigned int lineSize = width * BYTES_PER_PIXEL;
+  const uint8_t* src = texture.GetPixels();
+  uint8_t* dst = page.GetPixels() + y * dstPitch + x * BYTES_PER_PIXEL;
+
+  for (unsigned int row = 0; row < height; ++row)
+  {
+    uint8_t* line = dst + row * dstPitch;
+    std::memcpy(line, src + row * srcPitch, lineSize);
+    std::memcpy(line - BYTES_PER_PIXEL, line, BYTES_PER_PIXEL);
+    std::memcpy(line + lineSize, line + lineSize - BYTES_PER_PIXEL, BYTES_PER_PIXEL);
+  }
+
+  // rows above and below, including the corners
+  const unsigned int paddedSize = lineSize + 2 * BYTES_PER_PIXEL;
+  std::memcpy(dst - dstPitch - BYTES_PER_PIXEL, dst - BYTES_PER_PIXEL, paddedSize);
+  std::memcpy(dst + height * dstPitch - BYTES_PER_PIXEL,
+              dst + (height - 1) * dstPitch - BYTES_PER_PIXEL, paddedSize);
+}
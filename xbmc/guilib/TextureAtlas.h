@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+class CTexture;
+
+/*!
+ \ingroup textures
+ \brief Places rectangles on a square page, row by row on shelves of similar height
+ */
+class CTextureAtlasPacker
+{
+public:
+  explicit CTextureAtlasPacker(unsigned int size) : m_size(size) {}
+
+  /*!
+   \brief Find room for a rectangle
+   \return top left corner of the room, nothing if the page is too full
+   */
+  std::optional<std::pair<unsigned int, unsigned int>> Add(unsigned int width, unsigned int height);
+
+  unsigned int GetSize() const { return m_size; }
+  unsigned int GetUsedArea() const { return m_usedArea; }
+
+private:
+  struct Shelf
+  {
+    unsigned int y;
+    unsigned int height;
+    unsigned int width; ///< used width
+  };
+
+  unsigned int m_size;
+  unsigned int m_usedArea{0};
+  std::vector<Shelf> m_shelves;
+};
+
+/*!
+ \ingroup textures
+ \brief Copies small textures onto shared pages, so that they are drawn from the same GPU texture
+
+ Controls using textures of the same page can be drawn without binding another texture in
+ between. A page takes textures until it is uploaded to the GPU the first time, later ones
+ go to a new page. A page is freed once none of its textures is in use anymore.
+ */
+class CTextureAtlas
+{
+public:
+  //! textures larger than this in any direction aren't packed
+  static constexpr unsigned int MAX_TEXTURE_SIZE = 256;
+  //! size of the pages, unless the GPU supports less
+  static constexpr unsigned int PAGE_SIZE = 1024;
+
+  struct Region
+  {
+    std::shared_ptr<CTexture> page;
+    unsigned int x; ///< left of the texture on the page
+    unsigned int y; ///< top of the texture on the page
+  };
+
+  /*!
+   \brief Copy a texture onto a page
+   \param texture Texture which hasn't been uploaded to the GPU yet
+   \return where the copy is, nothing if the texture isn't suitable for packing
+   */
+  std::optional<Region> Add(const CTexture& texture);
+
+  /*!
+   \brief Free the pages none of whose textures are in use anymore
+   */
+  void FreeUnusedPages();
+
+  void Clear() { m_pages.clear(); }
+  size_t GetPageCount() const { return m_pages.size(); }
+
+private:
+  struct Page
+  {
+    std::shared_ptr<CTexture> texture;
+    CTextureAtlasPacker packer;
+    bool alpha;
+  };
+
+  static void Copy(const CTexture& texture, CTexture& page, unsigned int x, unsigned int y);
+
+  std::vector<Page> m_pages;
+};
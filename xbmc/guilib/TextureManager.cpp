@@ -16,6 +16,8 @@
 #include "filesystem/File.h"
 #include "guilib/TextureBundle.h"
 #include "guilib/TextureFormats.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -44,6 +46,7 @@
 #include <algorithm>
 #include <cassert>
 #include <exception>
+#include <optional>
 
 /************************************************************************/
 /*                                                                      */
@@ -84,6 +87,9 @@ void CTextureArray::Reset()
   m_texHeight = 0;
   m_texCoordsArePixels = false;
   m_scalingMethod = TEXTURE_SCALING::UNKNOWN;
+  m_atlas = false;
+  m_atlasX = 0;
+  m_atlasY = 0;
 }
 
 void CTextureArray::SetScalingMethod(TEXTURE_SCALING scalingMethod)
@@ -221,6 +227,16 @@ void CTextureMap::Add(std::unique_ptr<CTexture> texture, int delay)
   m_texture.Add(std::move(texture), delay);
 }
 
+void CTextureMap::Add(const CTextureAtlas::Region& region)
+{
+  m_memUsage += sizeof(CTexture) + (m_texture.m_width * m_texture.m_height * 4);
+
+  m_texture.Add(region.page, 100);
+  m_texture.m_atlas = true;
+  m_texture.m_atlasX = static_cast<int>(region.x);
+  m_texture.m_atlasY = static_cast<int>(region.y);
+}
+
 /************************************************************************/
 /*                                                                      */
 /************************************************************************/
@@ -265,8 +281,7 @@ bool CGUITextureManager::HasTexture(const std::string &textureName, std::string
   if (!CanLoad(textureName))
     return false;
 
-  // Check our loaded and bundled textures - we store in bundles using \\.
-  std::string bundledName = CTextureBundle::Normalize(textureName);
+  // Check our loaded textures
   for (int i = 0; i < (int)m_vecTextures.size(); ++i)
   {
     CTextureMap *pMap = m_vecTextures[i];
@@ -277,6 +292,15 @@ bool CGUITextureManager::HasTexture(const std::string &textureName, std::string
     }
   }
 
+  return FindTextureSource(textureName, path, bundle);
+}
+
+bool CGUITextureManager::FindTextureSource(const std::string& textureName,
+                                           std::string* path,
+                                           int* bundle)
+{
+  // Check our bundled textures - we store in bundles using \\.
+  std::string bundledName = CTextureBundle::Normalize(textureName);
   for (int i = 0; i < 2; i++)
   {
     if (m_TexBundle[i].HasFile(bundledName))
@@ -293,32 +317,35 @@ bool CGUITextureManager::HasTexture(const std::string &textureName, std::string
   return !fullPath.empty();
 }
 
-const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName, bool checkBundleOnly /*= false */)
+CTextureMap* CGUITextureManager::FindTexture(const std::string& textureName, bool allowAtlas)
+{
+  for (CTextureMap* pMap : m_vecTextures)
+  {
+    if (pMap->GetName() == textureName && (allowAtlas || !pMap->IsAtlas()))
+      return pMap;
+  }
+  return nullptr;
+}
+
+const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
+                                              bool checkBundleOnly /*= false */,
+                                              bool allowAtlas /*= false */)
 {
   std::string strPath;
   static CTextureArray emptyTexture;
   int bundle = -1;
-  int size = 0;
 
-  if (strTextureName.empty())
+  if (strTextureName.empty() || !CanLoad(strTextureName))
     return emptyTexture;
 
-  if (!HasTexture(strTextureName, &strPath, &bundle, &size))
-    return emptyTexture;
+  // a texture packed onto an atlas page can't be used if the caller doesn't expect one
+  if (CTextureMap* pMap = FindTexture(strTextureName, allowAtlas))
+    return pMap->GetTexture();
 
-  if (size) // we found the texture
   {
-    for (int i = 0; i < (int)m_vecTextures.size(); ++i)
-    {
-      CTextureMap *pMap = m_vecTextures[i];
-      if (pMap->GetName() == strTextureName)
-      {
-        //CLog::Log(LOGDEBUG, "Total memusage {}", GetMemoryUsage());
-        return pMap->GetTexture();
-      }
-    }
-    // Whoops, not there.
-    return emptyTexture;
+    std::unique_lock lock(m_section);
+    if (!FindTextureSource(strTextureName, &strPath, &bundle))
+      return emptyTexture;
   }
 
   for (auto i = m_unusedTextures.begin(); i != m_unusedTextures.end(); ++i)
@@ -328,7 +355,8 @@ const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
     auto timestamp = i->second.time_since_epoch();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(timestamp);
 
-    if (pMap->GetName() == strTextureName && duration.count() > 0)
+    if (pMap->GetName() == strTextureName && duration.count() > 0 &&
+        (allowAtlas || !pMap->IsAtlas()))
     {
       m_vecTextures.push_back(pMap);
       m_unusedTextures.erase(i);
@@ -464,7 +492,19 @@ const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
   if (!pTexture) return emptyTexture;
 
   CTextureMap* pMap = new CTextureMap(strTextureName, width, height, 0);
-  pMap->Add(std::move(pTexture), 100);
+
+  // the texture coordinates of a packed texture are based on its real size
+  std::optional<CTextureAtlas::Region> region;
+  if (allowAtlas &&
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiTextureAtlas &&
+      static_cast<unsigned int>(width) == pTexture->GetWidth() &&
+      static_cast<unsigned int>(height) == pTexture->GetHeight())
+    region = m_atlas.Add(*pTexture);
+
+  if (region)
+    pMap->Add(*region);
+  else
+    pMap->Add(std::move(pTexture), 100);
   m_vecTextures.push_back(pMap);
 
 #ifdef _DEBUG_TEXTURES
@@ -478,7 +518,9 @@ const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
 }
 
 
-void CGUITextureManager::ReleaseTexture(const std::string& strTextureName, bool immediately /*= false */)
+void CGUITextureManager::ReleaseTexture(const std::string& strTextureName,
+                                        bool immediately /*= false */,
+                                        bool atlas /*= false */)
 {
   std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
@@ -487,7 +529,7 @@ void CGUITextureManager::ReleaseTexture(const std::string& strTextureName, bool
   while (i != m_vecTextures.end())
   {
     CTextureMap* pMap = *i;
-    if (pMap->GetName() == strTextureName)
+    if (pMap->GetName() == strTextureName && pMap->IsAtlas() == atlas)
     {
       if (pMap->Release())
       {
@@ -525,6 +567,8 @@ void CGUITextureManager::FreeUnusedTextures(unsigned int timeDelay)
       ++i;
   }
 
+  m_atlas.FreeUnusedPages();
+
 #if defined(HAS_GL) || defined(HAS_GLES)
   for (unsigned int i = 0; i < m_unusedHwTextures.size(); ++i)
   {
@@ -565,11 +609,13 @@ void CGUITextureManager::Cleanup()
   m_TexBundle[0] = CTextureBundle(true);
   m_TexBundle[1] = CTextureBundle();
   FreeUnusedTextures();
+  m_atlas.Clear();
 }
 
 void CGUITextureManager::Dump() const
 {
-  CLog::Log(LOGDEBUG, "{0}: total texturemaps size: {1}", __FUNCTION__, m_vecTextures.size());
+  CLog::Log(LOGDEBUG, "{0}: total texturemaps size: {1}, atlas pages: {2}", __FUNCTION__,
+            m_vecTextures.size(), m_atlas.GetPageCount());
 
   for (int i = 0; i < (int)m_vecTextures.size(); ++i)
   {
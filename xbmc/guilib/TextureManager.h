@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GUIComponent.h"
+#include "TextureAtlas.h"
 #include "TextureBundle.h"
 #include "TextureScaling.h"
 #include "threads/CriticalSection.h"
@@ -54,6 +55,11 @@ public:
   int m_texHeight;
   bool m_texCoordsArePixels;
   TEXTURE_SCALING m_scalingMethod{TEXTURE_SCALING::UNKNOWN};
+
+  // the texture is part of a CTextureAtlas page, at this position in pixels
+  bool m_atlas{false};
+  int m_atlasX{0};
+  int m_atlasY{0};
 };
 
 /*!
@@ -71,6 +77,7 @@ public:
   virtual ~CTextureMap();
 
   void Add(std::unique_ptr<CTexture> texture, int delay);
+  void Add(const CTextureAtlas::Region& region);
   bool Release();
 
   const std::string& GetName() const;
@@ -79,6 +86,7 @@ public:
   uint32_t GetMemoryUsage() const;
   void Flush();
   bool IsEmpty() const;
+  bool IsAtlas() const { return m_texture.m_atlas; }
   void SetHeight(int height);
   void SetWidth(int height);
 protected:
@@ -105,8 +113,22 @@ public:
 
   bool HasTexture(const std::string &textureName, std::string *path = NULL, int *bundle = NULL, int *size = NULL);
   static bool CanLoad(const std::string &texturePath); ///< Returns true if the texture manager can load this texture
-  const CTextureArray& Load(const std::string& strTextureName, bool checkBundleOnly = false);
-  void ReleaseTexture(const std::string& strTextureName, bool immediately = false);
+  /*!
+   \brief Load a texture, or get it if it's loaded already
+   \param allowAtlas Small textures may be packed onto a CTextureAtlas page then. Their texture
+   coordinates have to be offset by the position on the page and they are drawn with linear
+   scaling.
+   */
+  const CTextureArray& Load(const std::string& strTextureName,
+                            bool checkBundleOnly = false,
+                            bool allowAtlas = false);
+  /*!
+   \brief Release a texture got from Load()
+   \param atlas Whether the texture is on an atlas page, see CTextureArray::m_atlas
+   */
+  void ReleaseTexture(const std::string& strTextureName,
+                      bool immediately = false,
+                      bool atlas = false);
   void Cleanup();
   void Dump() const;
   uint32_t GetMemoryUsage() const;
@@ -121,6 +143,10 @@ public:
   void FreeUnusedTextures(unsigned int timeDelay = 0); ///< Free textures (called from app thread only)
   void ReleaseHwTexture(unsigned int texture);
 protected:
+  bool FindTextureSource(const std::string& textureName, std::string* path, int* bundle);
+  CTextureMap* FindTexture(const std::string& textureName, bool allowAtlas);
+
+
   std::vector<CTextureMap*> m_vecTextures;
   std::list<std::pair<CTextureMap*, std::chrono::time_point<std::chrono::steady_clock>>>
       m_unusedTextures;
@@ -128,6 +154,7 @@ protected:
   typedef std::vector<CTextureMap*>::iterator ivecTextures;
   // we have 2 texture bundles (one for the base textures, one for the theme)
   CTextureBundle m_TexBundle[2];
+  CTextureAtlas m_atlas;
 
   std::vector<std::string> m_texturePaths;
   CCriticalSection m_section;
@@ -0,0 +1,46 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/guiinfo/GUIInfoChanges.h"
+
+#include <algorithm>
+
+using namespace KODI::GUILIB::GUIINFO;
+
+void CGUIInfoChanges::Declare(int info)
+{
+  m_changed.try_emplace(info, 0);
+}
+
+bool CGUIInfoChanges::AddDependencies(int info, Dependencies& dependencies) const
+{
+  const auto it = m_changed.find(info);
+  if (it == m_changed.end())
+    return false;
+
+  for (const Stamp* stamp : {&m_allChanged, &it->second})
+  {
+    if (std::ranges::find(dependencies, stamp) == dependencies.end())
+      dependencies.emplace_back(stamp);
+  }
+  return true;
+}
+
+void CGUIInfoChanges::NotifyChanged(int info)
+{
+  const auto it = m_changed.find(info);
+  if (it != m_changed.end())
+    it->second.store(m_counter.fetch_add(1, std::memory_order_acq_rel) + 1,
+                     std::memory_order_release);
+}
+
+void CGUIInfoChanges::NotifyAllChanged()
+{
+  m_allChanged.store(m_counter.fetch_add(1, std::memory_order_acq_rel) + 1,
+                     std::memory_order_release);
+}
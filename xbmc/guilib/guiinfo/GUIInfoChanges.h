@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace KODI::GUILIB::GUIINFO
+{
+
+/*!
+ * @brief Change notifications of the guiinfo providers, per info id.
+ *
+ * A provider declares the infos whose values only change when it says so and calls
+ * NotifyChanged() whenever that happens. Conditions depending on declared infos only are not
+ * re-evaluated on every cache reset of the info manager, but only after one of their infos
+ * changed. Declared infos must neither depend on the context window nor on a list item.
+ *
+ * Every notification takes a new stamp from a global counter. A condition remembers the counter
+ * at its last evaluation and is outdated as soon as one of its infos got a newer stamp.
+ */
+class CGUIInfoChanges
+{
+public:
+  using Stamp = std::atomic<uint64_t>;
+  using Dependencies = std::vector<const Stamp*>;
+
+  CGUIInfoChanges() = default;
+  CGUIInfoChanges(const CGUIInfoChanges&) = delete;
+  CGUIInfoChanges& operator=(const CGUIInfoChanges&) = delete;
+
+  /*!
+   * @brief Declare an info whose changes get notified. Must only be called on construction of
+   * the providers, before any condition is registered.
+   * @param info The info id.
+   */
+  void Declare(int info);
+
+  /*!
+   * @brief Add the stamps a condition on the given info depends on.
+   * @param info The info id.
+   * @param dependencies The stamps to add to.
+   * @return True if the info is declared, false otherwise.
+   */
+  bool AddDependencies(int info, Dependencies& dependencies) const;
+
+  /*!
+   * @brief Get the stamp to remember when evaluating a condition. Must be taken before the
+   * evaluation, so that changes during the evaluation are not lost.
+   */
+  uint64_t GetCurrentStamp() const { return m_counter.load(std::memory_order_acquire); }
+
+  /*!
+   * @brief Check whether any of the given stamps changed after the given one.
+   */
+  static bool HasChanged(const Dependencies& dependencies, uint64_t stamp)
+  {
+    for (const Stamp* dependency : dependencies)
+    {
+      if (dependency->load(std::memory_order_acquire) > stamp)
+        return true;
+    }
+    return false;
+  }
+
+  /*!
+   * @brief Notify a change of the given info. Can be called from any thread.
+   * @param info The info id.
+   */
+  void NotifyChanged(int info);
+
+  /*!
+   * @brief Notify a change of all declared infos, e.g. because the skin or the profile changed.
+   */
+  void NotifyAllChanged();
+
+private:
+  std::atomic<uint64_t> m_counter{1};
+  Stamp m_allChanged{1};
+  std::map<int, Stamp> m_changed;
+};
+
+} // namespace KODI::GUILIB::GUIINFO
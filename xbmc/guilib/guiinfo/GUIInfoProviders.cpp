@@ -15,6 +15,7 @@
 using namespace KODI::GUILIB::GUIINFO;
 
 CGUIInfoProviders::CGUIInfoProviders()
+  : m_libraryGUIInfo(m_changes), m_skinGUIInfo(m_changes), m_systemGUIInfo(m_changes)
 {
   RegisterProvider(&m_guiControlsGUIInfo);
   RegisterProvider(
@@ -10,6 +10,7 @@
 
 #include "guilib/guiinfo/AddonsGUIInfo.h"
 #include "guilib/guiinfo/GUIControlsGUIInfo.h"
+#include "guilib/guiinfo/GUIInfoChanges.h"
 #include "guilib/guiinfo/GamesGUIInfo.h"
 #include "guilib/guiinfo/LibraryGUIInfo.h"
 #include "guilib/guiinfo/MusicGUIInfo.h"
@@ -140,9 +141,24 @@ public:
    */
   CLibraryGUIInfo& GetLibraryInfoProvider() { return m_libraryGUIInfo; }
 
+  /*!
+   * @brief Get the skin guiinfo provider.
+   * @return The skin guiinfo provider.
+   */
+  CSkinGUIInfo& GetSkinInfoProvider() { return m_skinGUIInfo; }
+
+  /*!
+   * @brief Get the change notifications of the guiinfo providers.
+   * @return The change notifications.
+   */
+  CGUIInfoChanges& GetChanges() { return m_changes; }
+  const CGUIInfoChanges& GetChanges() const { return m_changes; }
+
 private:
   std::vector<IGUIInfoProvider*> m_providers;
 
+  CGUIInfoChanges m_changes; // must be constructed before the providers
+
   CAddonsGUIInfo m_addonsGUIInfo;
   CGamesGUIInfo m_gamesGUIInfo;
   CGUIControlsGUIInfo m_guiControlsGUIInfo;
@@ -14,6 +14,7 @@
 #include "URL.h"
 #include "filesystem/Directory.h"
 #include "guilib/guiinfo/GUIInfo.h"
+#include "guilib/guiinfo/GUIInfoChanges.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
 #include "music/MusicDatabase.h"
 #include "music/MusicLibraryQueue.h"
@@ -27,8 +28,21 @@
 
 using namespace KODI::GUILIB::GUIINFO;
 
-CLibraryGUIInfo::CLibraryGUIInfo()
+namespace
 {
+// the infos on the library bools, which only change through SetLibraryBool and ResetLibraryBools
+constexpr int LIBRARY_BOOL_INFOS[] = {
+    LIBRARY_HAS_MUSIC,   LIBRARY_HAS_MOVIES,       LIBRARY_HAS_MOVIE_SETS,
+    LIBRARY_HAS_TVSHOWS, LIBRARY_HAS_MUSICVIDEOS,  LIBRARY_HAS_SINGLES,
+    LIBRARY_HAS_VIDEO,   LIBRARY_HAS_COMPILATIONS, LIBRARY_HAS_BOXSETS,
+    LIBRARY_HAS_ROLE};
+} // unnamed namespace
+
+CLibraryGUIInfo::CLibraryGUIInfo(CGUIInfoChanges& changes) : m_changes(changes)
+{
+  for (int info : LIBRARY_BOOL_INFOS)
+    m_changes.Declare(info);
+
   ResetLibraryBools();
 }
 
@@ -68,8 +82,11 @@ void CLibraryGUIInfo::SetLibraryBool(int condition, bool value)
       m_libraryHasBoxsets = value ? 1 : 0;
       break;
     default:
-      break;
+      return;
   }
+
+  m_changes.NotifyChanged(condition);
+  m_changes.NotifyChanged(LIBRARY_HAS_VIDEO);
 }
 
 void CLibraryGUIInfo::ResetLibraryBools()
@@ -83,6 +100,9 @@ void CLibraryGUIInfo::ResetLibraryBools()
   m_libraryHasCompilations = -1;
   m_libraryHasBoxsets = -1;
   m_libraryRoleCounts.clear();
+
+  for (int info : LIBRARY_BOOL_INFOS)
+    m_changes.NotifyChanged(info);
 }
 
 bool CLibraryGUIInfo::InitCurrentItem(CFileItem* item)
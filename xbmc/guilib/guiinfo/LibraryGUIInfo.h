@@ -18,11 +18,12 @@ namespace KODI::GUILIB::GUIINFO
 {
 
 class CGUIInfo;
+class CGUIInfoChanges;
 
 class CLibraryGUIInfo : public CGUIInfoProvider
 {
 public:
-  CLibraryGUIInfo();
+  explicit CLibraryGUIInfo(CGUIInfoChanges& changes);
   ~CLibraryGUIInfo() override = default;
 
   // KODI::GUILIB::GUIINFO::IGUIInfoProvider implementation
@@ -46,6 +47,8 @@ public:
   void ResetLibraryBools();
 
 private:
+  CGUIInfoChanges& m_changes;
+
   mutable int m_libraryHasMusic;
   mutable int m_libraryHasMovies;
   mutable int m_libraryHasTVShows;
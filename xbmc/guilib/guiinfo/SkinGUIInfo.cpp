@@ -12,6 +12,7 @@
 #include "addons/Skin.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/guiinfo/GUIInfo.h"
+#include "guilib/guiinfo/GUIInfoChanges.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
 #include "resources/LocalizeStrings.h"
 #include "resources/ResourcesComponent.h"
@@ -23,6 +24,24 @@
 
 using namespace KODI::GUILIB::GUIINFO;
 
+namespace
+{
+// the infos on skin settings, which only change through CSkinSettings
+constexpr int SKIN_SETTING_INFOS[] = {SKIN_BOOL, SKIN_STRING, SKIN_STRING_IS_EQUAL};
+} // unnamed namespace
+
+CSkinGUIInfo::CSkinGUIInfo(CGUIInfoChanges& changes) : m_changes(changes)
+{
+  for (int info : SKIN_SETTING_INFOS)
+    m_changes.Declare(info);
+}
+
+void CSkinGUIInfo::OnSettingsChanged()
+{
+  for (int info : SKIN_SETTING_INFOS)
+    m_changes.NotifyChanged(info);
+}
+
 bool CSkinGUIInfo::InitCurrentItem(CFileItem* item)
 {
   return false;
@@ -14,11 +14,12 @@ namespace KODI::GUILIB::GUIINFO
 {
 
 class CGUIInfo;
+class CGUIInfoChanges;
 
 class CSkinGUIInfo : public CGUIInfoProvider
 {
 public:
-  CSkinGUIInfo() = default;
+  explicit CSkinGUIInfo(CGUIInfoChanges& changes);
   ~CSkinGUIInfo() override = default;
 
   // KODI::GUILIB::GUIINFO::IGUIInfoProvider implementation
@@ -36,6 +37,14 @@ public:
                const CGUIListItem* item,
                int contextWindow,
                const CGUIInfo& info) const override;
+
+  /*!
+   * @brief Notify a change of the skin settings, e.g. the current skin or one of its values.
+   */
+  void OnSettingsChanged();
+
+private:
+  CGUIInfoChanges& m_changes;
 };
 
 } // namespace KODI::GUILIB::GUIINFO
@@ -49,10 +49,16 @@
 using namespace KODI::GUILIB;
 using namespace KODI::GUILIB::GUIINFO;
 
-CSystemGUIInfo::CSystemGUIInfo()
+CSystemGUIInfo::CSystemGUIInfo(CGUIInfoChanges& changes)
   : m_gpuInfo(CGPUInfo::GetGPUInfo()),
     m_lastSysHeatInfoTime(-SYSTEM_HEAT_UPDATE_INTERVAL)
 {
+  // constants, never notified
+  for (int info : {SYSTEM_ALWAYS_TRUE, SYSTEM_ALWAYS_FALSE, SYSTEM_PLATFORM_LINUX,
+                   SYSTEM_PLATFORM_WINDOWS, SYSTEM_PLATFORM_UWP, SYSTEM_PLATFORM_DARWIN,
+                   SYSTEM_PLATFORM_DARWIN_OSX, SYSTEM_PLATFORM_DARWIN_IOS,
+                   SYSTEM_PLATFORM_DARWIN_TVOS, SYSTEM_PLATFORM_ANDROID, SYSTEM_PLATFORM_WEBOS})
+    changes.Declare(info);
 }
 
 std::string CSystemGUIInfo::GetSystemHeatInfo(int info) const
@@ -18,11 +18,12 @@ namespace KODI::GUILIB::GUIINFO
 {
 
 class CGUIInfo;
+class CGUIInfoChanges;
 
 class CSystemGUIInfo : public CGUIInfoProvider
 {
 public:
-  CSystemGUIInfo();
+  explicit CSystemGUIInfo(CGUIInfoChanges& changes);
   ~CSystemGUIInfo() override = default;
 
   // KODI::GUILIB::GUIINFO::IGUIInfoProvider implementation
@@ -0,0 +1,177 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "guilib/DDSImage.h"
+#include "test/TestUtils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+void DecodeColor(uint16_t color, int* bgr)
+{
+  bgr[0] = ((color & 0x1f) << 3) | ((color & 0x1f) >> 2);
+  bgr[1] = (((color >> 5) & 0x3f) << 2) | (((color >> 5) & 0x3f) >> 4);
+  bgr[2] = ((color >> 11) << 3) | ((color >> 11) >> 2);
+}
+
+// BGRA of pixel i of a DXT1 or DXT5 block
+void DecodePixel(const unsigned char* block, bool dxt5, unsigned int i, int* bgra)
+{
+  if (dxt5)
+  {
+    const int alpha0 = block[0];
+    const int alpha1 = block[1];
+    uint64_t bits = 0;
+    for (unsigned int b = 0; b < 6; b++)
+      bits |= static_cast<uint64_t>(block[2 + b]) << (8 * b);
+    const unsigned int index = (bits >> (3 * i)) & 7;
+    if (index < 2)
+      bgra[3] = index == 0 ? alpha0 : alpha1;
+    else
+      bgra[3] = ((8 - index) * alpha0 + (index - 1) * alpha1) / 7;
+    block += 8;
+  }
+  else
+    bgra[3] = 255;
+
+  const uint16_t color0 = block[0] | (block[1] << 8);
+  const uint16_t color1 = block[2] | (block[3] << 8);
+  const uint32_t indices = block[4] | (block[5] << 8) | (block[6] << 16) | (block[7] << 24);
+  const unsigned int index = (indices >> (2 * i)) & 3;
+
+  int c0[3];
+  int c1[3];
+  DecodeColor(color0, c0);
+  DecodeColor(color1, c1);
+  ASSERT_TRUE(color0 > color1 || indices == 0); // four colour blocks only
+  for (unsigned int c = 0; c < 3; c++)
+  {
+    const int palette[4] = {c0[c], c1[c], (2 * c0[c] + c1[c]) / 3, (c0[c] + 2 * c1[c]) / 3};
+    bgra[c] = palette[index];
+  }
+}
+
+// largest difference of any channel between the pixels and their compressed version
+int MaxError(const std::vector<unsigned char>& pixels, unsigned int width, unsigned int height,
+             XB_FMT format)
+{
+  CDDSImage image;
+  EXPECT_TRUE(image.Create(width, height, width * 4, pixels.data(), format));
+  EXPECT_EQ(format, image.GetFormat());
+
+  const bool dxt5 = format == XB_FMT_DXT5;
+  const unsigned int blockSize = dxt5 ? 16 : 8;
+  const unsigned int blocksWide = (width + 3) / 4;
+  EXPECT_EQ(blocksWide * ((height + 3) / 4) * blockSize, image.GetSize());
+
+  int maxError = 0;
+  for (unsigned int y = 0; y < height; y++)
+  {
+    for (unsigned int x = 0; x < width; x++)
+    {
+      const unsigned char* block = image.GetData() + ((y / 4) * blocksWide + x / 4) * blockSize;
+      int decoded[4];
+      DecodePixel(block, dxt5, (y % 4) * 4 + x % 4, decoded);
+      for (unsigned int c = 0; c < (dxt5 ? 4u : 3u); c++)
+        maxError = std::max(maxError, std::abs(decoded[c] - pixels[(y * width + x) * 4 + c]));
+    }
+  }
+  return maxError;
+}
+} // namespace
+
+TEST(TestDDSImage, SolidColor)
+{
+  std::vector<unsigned char> pixels(8 * 8 * 4);
+  for (size_t i = 0; i < pixels.size(); i += 4)
+  {
+    pixels[i] = 0x20;
+    pixels[i + 1] = 0x80;
+    pixels[i + 2] = 0xc0;
+    pixels[i + 3] = 0x40;
+  }
+
+  // just the precision of 5:6:5 colour
+  EXPECT_LE(MaxError(pixels, 8, 8, XB_FMT_DXT1), 8);
+  EXPECT_LE(MaxError(pixels, 8, 8, XB_FMT_DXT5), 8);
+}
+
+TEST(TestDDSImage, Gradient)
+{
+  // not a multiple of the block size
+  const unsigned int width = 30;
+  const unsigned int height = 10;
+  std::vector<unsigned char> pixels(width * height * 4);
+  for (unsigned int y = 0; y < height; y++)
+  {
+    for (unsigned int x = 0; x < width; x++)
+    {
+      unsigned char* pixel = &pixels[(y * width + x) * 4];
+      pixel[0] = static_cast<unsigned char>(x * 8);
+      pixel[1] = static_cast<unsigned char>(y * 20);
+      pixel[2] = static_cast<unsigned char>(255 - x * 8);
+      pixel[3] = static_cast<unsigned char>(y * 25);
+    }
+  }
+
+  EXPECT_LE(MaxError(pixels, width, height, XB_FMT_DXT1), 24);
+  EXPECT_LE(MaxError(pixels, width, height, XB_FMT_DXT5), 24);
+}
+
+TEST(TestDDSImage, Raw)
+{
+  const unsigned int width = 3;
+  const unsigned int height = 2;
+  const unsigned int pitch = 16;
+  std::vector<unsigned char> pixels(pitch * height, 0xff);
+  pixels[pitch + 4] = 0x12;
+
+  CDDSImage image;
+  ASSERT_TRUE(image.Create(width, height, pitch, pixels.data(), XB_FMT_A8R8G8B8));
+  EXPECT_EQ(XB_FMT_A8R8G8B8, image.GetFormat());
+  EXPECT_FALSE(image.HasAlpha());
+  EXPECT_EQ(width * height * 4, image.GetSize());
+  EXPECT_EQ(0x12, image.GetData()[width * 4 + 4]);
+
+  pixels[pitch + 7] = 0x80;
+  ASSERT_TRUE(image.Create(width, height, pitch, pixels.data(), XB_FMT_A8R8G8B8));
+  EXPECT_TRUE(image.HasAlpha());
+
+  EXPECT_FALSE(image.Create(width, height, pitch, pixels.data(), XB_FMT_DXT3));
+}
+
+TEST(TestDDSImage, ReadHeader)
+{
+  const unsigned int width = 12;
+  const unsigned int height = 8;
+  std::vector<unsigned char> pixels(width * height * 4, 0x80);
+
+  CDDSImage image;
+  ASSERT_TRUE(image.Create(width, height, width * 4, pixels.data(), XB_FMT_DXT1));
+
+  XFILE::CFile* file = XBMC_CREATETEMPFILE(".dds");
+  const std::string path = XBMC_TEMPFILEPATH(file);
+  file->Close();
+  ASSERT_TRUE(image.WriteFile(path));
+
+  CDDSImage header;
+  EXPECT_TRUE(header.ReadHeader(path));
+  EXPECT_EQ(width, header.GetWidth());
+  EXPECT_EQ(height, header.GetHeight());
+  EXPECT_EQ(XB_FMT_DXT1, header.GetFormat());
+  EXPECT_EQ(nullptr, header.GetData());
+
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+}
@@ -0,0 +1,62 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/guiinfo/GUIInfoChanges.h"
+#include "guilib/guiinfo/GUIInfoLabels.h"
+
+#include <gtest/gtest.h>
+
+using namespace KODI::GUILIB::GUIINFO;
+
+TEST(TestGUIInfoChanges, Dependencies)
+{
+  CGUIInfoChanges changes;
+  changes.Declare(SKIN_BOOL);
+  changes.Declare(SKIN_STRING);
+
+  CGUIInfoChanges::Dependencies dependencies;
+  EXPECT_FALSE(changes.AddDependencies(PLAYER_HAS_MEDIA, dependencies));
+  EXPECT_TRUE(dependencies.empty());
+
+  // the stamp of all infos and the one of the info, without duplicates
+  EXPECT_TRUE(changes.AddDependencies(SKIN_BOOL, dependencies));
+  EXPECT_EQ(2u, dependencies.size());
+  EXPECT_TRUE(changes.AddDependencies(SKIN_BOOL, dependencies));
+  EXPECT_EQ(2u, dependencies.size());
+  EXPECT_TRUE(changes.AddDependencies(SKIN_STRING, dependencies));
+  EXPECT_EQ(3u, dependencies.size());
+}
+
+TEST(TestGUIInfoChanges, Notify)
+{
+  CGUIInfoChanges changes;
+  changes.Declare(SKIN_BOOL);
+  changes.Declare(SKIN_STRING);
+
+  CGUIInfoChanges::Dependencies skinBool;
+  changes.AddDependencies(SKIN_BOOL, skinBool);
+
+  // never evaluated
+  EXPECT_TRUE(CGUIInfoChanges::HasChanged(skinBool, 0));
+
+  uint64_t evaluated = changes.GetCurrentStamp();
+  EXPECT_FALSE(CGUIInfoChanges::HasChanged(skinBool, evaluated));
+
+  changes.NotifyChanged(SKIN_STRING);
+  changes.NotifyChanged(PLAYER_HAS_MEDIA);
+  EXPECT_FALSE(CGUIInfoChanges::HasChanged(skinBool, evaluated));
+
+  changes.NotifyChanged(SKIN_BOOL);
+  EXPECT_TRUE(CGUIInfoChanges::HasChanged(skinBool, evaluated));
+
+  evaluated = changes.GetCurrentStamp();
+  EXPECT_FALSE(CGUIInfoChanges::HasChanged(skinBool, evaluated));
+
+  changes.NotifyAllChanged();
+  EXPECT_TRUE(CGUIInfoChanges::HasChanged(skinBool, evaluated));
+}
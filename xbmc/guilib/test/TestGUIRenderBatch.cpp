@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIRenderBatch.h"
+
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class CTestDrawer : public CGUIRenderBatch::IDrawer
+{
+public:
+  unsigned int DrawQueued(const CGUIRenderBatch::State& state, size_t first, size_t last) override
+  {
+    ranges.emplace_back(first, last);
+    return static_cast<unsigned int>(last - first);
+  }
+  void ClearQueued() override { cleared++; }
+
+  std::vector<std::pair<size_t, size_t>> ranges;
+  int cleared{0};
+};
+
+class TestGUIRenderBatch : public testing::Test
+{
+protected:
+  TestGUIRenderBatch()
+  {
+    CGUIRenderBatch::Register(
+        [this](const CGUIRenderBatch::State& state,
+               const std::vector<CGUIRenderBatch::Vertex>& vertices)
+        { m_submits.emplace_back(state.shader, vertices.size() / 4); });
+  }
+  ~TestGUIRenderBatch() override { CGUIRenderBatch::Register(nullptr); }
+
+  static void AddQuad(CGUIRenderBatch& batch, int shader, float x, float y, float size)
+  {
+    CGUIRenderBatch::State state;
+    state.shader = shader;
+    const CGUIRenderBatch::Vertex vertices[4] = {{x, y, 0, 0, 0, 0, 0},
+                                                 {x + size, y, 0, 1, 0, 0, 0},
+                                                 {x + size, y + size, 0, 1, 1, 0, 0},
+                                                 {x, y + size, 0, 0, 1, 0, 0}};
+    batch.AddQuad(state, vertices);
+  }
+
+  // shader and number of quads of every draw
+  std::vector<std::pair<int, size_t>> m_submits;
+};
+} // namespace
+
+TEST_F(TestGUIRenderBatch, MergeApart)
+{
+  CGUIRenderBatch batch;
+  AddQuad(batch, 1, 0, 0, 10);
+  AddQuad(batch, 2, 20, 0, 10);
+  AddQuad(batch, 1, 40, 0, 10);
+  batch.Flush();
+
+  ASSERT_EQ(2u, m_submits.size());
+  EXPECT_EQ(std::make_pair(1, size_t{2}), m_submits[0]);
+  EXPECT_EQ(std::make_pair(2, size_t{1}), m_submits[1]);
+}
+
+TEST_F(TestGUIRenderBatch, KeepOrderOfOverlaps)
+{
+  CGUIRenderBatch batch;
+  AddQuad(batch, 1, 0, 0, 10);
+  AddQuad(batch, 2, 5, 5, 10);
+  AddQuad(batch, 1, 10, 10, 10);
+  batch.Flush();
+
+  ASSERT_EQ(3u, m_submits.size());
+  EXPECT_EQ(1, m_submits[0].first);
+  EXPECT_EQ(2, m_submits[1].first);
+  EXPECT_EQ(1, m_submits[2].first);
+}
+
+TEST_F(TestGUIRenderBatch, OffScreenPlaneOverlapsEverything)
+{
+  CGUIRenderBatch batch;
+  AddQuad(batch, 1, 0, 0, 10);
+
+  CGUIRenderBatch::State state;
+  state.shader = 2;
+  CGUIRenderBatch::Vertex vertices[4] = {{500, 500, 1, 0, 0, 0, 0},
+                                         {510, 500, 1, 1, 0, 0, 0},
+                                         {510, 510, 1, 1, 1, 0, 0},
+                                         {500, 510, 1, 0, 1, 0, 0}};
+  batch.AddQuad(state, vertices);
+
+  AddQuad(batch, 1, 100, 100, 10);
+  batch.Flush();
+
+  EXPECT_EQ(3u, m_submits.size());
+}
+
+TEST_F(TestGUIRenderBatch, Drawer)
+{
+  CGUIRenderBatch batch;
+  CTestDrawer drawer;
+  CGUIRenderBatch::State state;
+  state.shader = 3;
+
+  batch.AddQueued(state, drawer, 0, 2, CRect(0, 0, 10, 10));
+  AddQuad(batch, 1, 20, 20, 10);
+  batch.AddQueued(state, drawer, 2, 3, CRect(40, 40, 50, 50));
+  batch.Flush();
+
+  ASSERT_EQ(1u, drawer.ranges.size());
+  EXPECT_EQ(std::make_pair(size_t{0}, size_t{3}), drawer.ranges[0]);
+  EXPECT_EQ(1, drawer.cleared);
+  EXPECT_EQ(1u, m_submits.size());
+}
+
+TEST_F(TestGUIRenderBatch, Stats)
+{
+  CGUIRenderBatch batch;
+  AddQuad(batch, 1, 0, 0, 10);
+  AddQuad(batch, 1, 20, 0, 10);
+  AddQuad(batch, 2, 40, 0, 10);
+  batch.Flush();
+  batch.CountUnbatchedDraw();
+  AddQuad(batch, 2, 0, 0, 10);
+  batch.EndFrame();
+
+  const GUIRenderStats& stats = batch.GetFrameStats();
+  EXPECT_EQ(4u, stats.drawCalls);
+  EXPECT_EQ(4u, stats.stateChanges);
+  EXPECT_EQ(4u, stats.quads);
+
+  // frames without draws keep the last counters
+  batch.EndFrame();
+  EXPECT_EQ(4u, batch.GetFrameStats().drawCalls);
+}
@@ -0,0 +1,243 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "guilib/GUIIncludes.h"
+#include "guilib/GUISkinCache.h"
+#include "test/TestUtils.h"
+#include "utils/XBMCTinyXML.h"
+
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr const char* DOCUMENT = "<window id=\"1\" type=\"dialog\">"
+                                 "  <controls>"
+                                 "    <control type=\"label\">"
+                                 "      <label>$INFO[Player.Title]</label>"
+                                 "      <visible>Player.HasMedia</visible>"
+                                 "    </control>"
+                                 "    <control type=\"textbox\"><label><![CDATA[a < b]]></label>"
+                                 "    </control>"
+                                 "  </controls>"
+                                 "</window>";
+
+constexpr const char* INCLUDES =
+    "<includes>"
+    "  <default type=\"label\"><font>font13</font><textcolor>white</textcolor></default>"
+    "  <constant name=\"Left\">20</constant>"
+    "  <expression name=\"HasMedia\">Player.HasMedia</expression>"
+    "  <expression name=\"Playing\">$EXP[HasMedia] + Player.Playing</expression>"
+    "  <variable name=\"Title\">"
+    "    <value condition=\"$EXP[Playing]\">$INFO[Player.Title]</value>"
+    "    <value>none</value>"
+    "  </variable>"
+    "  <include name=\"Button\">"
+    "    <param name=\"label\" default=\"cancel\"/>"
+    "    <param name=\"id\" default=\"10\"/>"
+    "    <definition>"
+    "      <control type=\"button\" id=\"$PARAM[id]\">"
+    "        <label>$PARAM[label]</label>"
+    "        <visible>$EXP[Playing]</visible>"
+    "        <include>Width</include>"
+    "      </control>"
+    "    </definition>"
+    "  </include>"
+    "  <include name=\"Width\"><width>Left</width></include>"
+    "</includes>";
+
+constexpr const char* WINDOW = "<window>"
+                               "  <controls>"
+                               "    <control type=\"label\">"
+                               "      <left>Left</left>"
+                               "      <visible>$EXP[HasMedia]</visible>"
+                               "    </control>"
+                               "    <include content=\"Button\"><param name=\"label\" value=\"ok\"/></include>"
+                               "    <include content=\"Button\"/>"
+                               "  </controls>"
+                               "</window>";
+
+class TestGUISkinCache : public ::testing::Test
+{
+protected:
+  TestGUISkinCache()
+  {
+    m_cache.Open("skin.test", "1.0.0");
+    m_source = XBMC_CREATETEMPFILE(".xml");
+    m_source->Write(DOCUMENT, strlen(DOCUMENT));
+    m_source->Flush();
+    m_document.Parse(std::string(DOCUMENT));
+  }
+
+  ~TestGUISkinCache() override
+  {
+    XBMC_DELETETEMPFILE(m_source);
+    // tests may have closed the cache
+    m_cache.Open("skin.test", "1.0.0");
+    m_cache.Clear();
+  }
+
+  CGUISkinCache m_cache;
+  XFILE::CFile* m_source;
+  CXBMCTinyXML m_document;
+};
+} // unnamed namespace
+
+TEST_F(TestGUISkinCache, RoundTrip)
+{
+  const std::string name = XBMC_TEMPFILEPATH(m_source);
+  const std::string digest = m_cache.Store(name, "key", *m_document.RootElement(), {name},
+                                           {{"Skin.HasSetting(a)", true}});
+  ASSERT_FALSE(digest.empty());
+
+  CGUISkinCache::Entry entry;
+  ASSERT_TRUE(m_cache.Load(name, "key", entry));
+  EXPECT_EQ(digest, entry.digest);
+  ASSERT_EQ(1u, entry.sources.size());
+  EXPECT_EQ(name, entry.sources[0]);
+  ASSERT_EQ(1u, entry.conditions.size());
+  EXPECT_EQ("Skin.HasSetting(a)", entry.conditions[0].first);
+  EXPECT_TRUE(entry.conditions[0].second);
+
+  ASSERT_TRUE(entry.root);
+  TiXmlPrinter expected;
+  m_document.RootElement()->Accept(&expected);
+  TiXmlPrinter actual;
+  entry.root->Accept(&actual);
+  EXPECT_EQ(expected.Str(), actual.Str());
+
+  const TiXmlElement* textbox = entry.root->FirstChildElement("controls")
+                                    ->FirstChildElement("control")
+                                    ->NextSiblingElement("control");
+  ASSERT_TRUE(textbox);
+  const TiXmlText* text = textbox->FirstChildElement("label")->FirstChild()->ToText();
+  ASSERT_TRUE(text);
+  EXPECT_TRUE(text->CDATA());
+  EXPECT_EQ("a < b", text->ValueStr());
+}
+
+TEST_F(TestGUISkinCache, Key)
+{
+  const std::string name = XBMC_TEMPFILEPATH(m_source);
+  ASSERT_FALSE(m_cache.Store(name, "key", *m_document.RootElement(), {name}, {}).empty());
+
+  CGUISkinCache::Entry entry;
+  EXPECT_FALSE(m_cache.Load(name, "other", entry));
+  EXPECT_FALSE(m_cache.Load("other", "key", entry));
+
+  // another version of the skin
+  m_cache.Open("skin.test", "1.0.1");
+  EXPECT_FALSE(m_cache.Load(name, "key", entry));
+  m_cache.Open("skin.test", "1.0.0");
+  EXPECT_TRUE(m_cache.Load(name, "key", entry));
+
+  m_cache.Close();
+  EXPECT_FALSE(m_cache.Load(name, "key", entry));
+}
+
+TEST_F(TestGUISkinCache, ChangedSource)
+{
+  const std::string name = XBMC_TEMPFILEPATH(m_source);
+  ASSERT_FALSE(m_cache.Store(name, "", *m_document.RootElement(), {name}, {}).empty());
+
+  CGUISkinCache::Entry entry;
+  ASSERT_TRUE(m_cache.Load(name, "", entry));
+
+  m_source->Write("<!-- -->", 8);
+  m_source->Flush();
+  EXPECT_FALSE(m_cache.Load(name, "", entry));
+}
+
+class TestGUIIncludesHelper
+{
+public:
+  static std::string Print(const TiXmlNode& node)
+  {
+    TiXmlPrinter printer;
+    node.Accept(&printer);
+    return printer.Str();
+  }
+
+  static std::string ResolveWindow(CGUIIncludes& includes)
+  {
+    CXBMCTinyXML window;
+    window.Parse(std::string(WINDOW));
+    includes.Resolve(window.RootElement());
+    return Print(*window.RootElement());
+  }
+
+  template<typename Map>
+  static void ExpectEqualNodes(const Map& expected, const Map& actual)
+  {
+    EXPECT_EQ(expected.size(), actual.size());
+    for (const auto& [name, node] : expected)
+    {
+      const auto it = actual.find(name);
+      ASSERT_NE(actual.end(), it) << name;
+      EXPECT_EQ(Print(node), Print(it->second)) << name;
+    }
+  }
+
+  static void ExpectEqual(const CGUIIncludes& expected, const CGUIIncludes& actual)
+  {
+    ExpectEqualNodes(expected.m_defaults, actual.m_defaults);
+    ExpectEqualNodes(expected.m_skinvariables, actual.m_skinvariables);
+    EXPECT_EQ(expected.m_constants, actual.m_constants);
+    EXPECT_EQ(expected.m_expressions, actual.m_expressions);
+
+    EXPECT_EQ(expected.m_includes.size(), actual.m_includes.size());
+    for (const auto& [name, include] : expected.m_includes)
+    {
+      const auto it = actual.m_includes.find(name);
+      ASSERT_NE(actual.m_includes.end(), it) << name;
+      EXPECT_EQ(Print(include.first), Print(it->second.first)) << name;
+      EXPECT_EQ(include.second, it->second.second) << name;
+    }
+  }
+
+  static bool IsCached(const CGUIIncludes& includes) { return !includes.m_cacheDigest.empty(); }
+};
+
+TEST(TestGUIIncludesCache, SameAsParsed)
+{
+  XFILE::CFile* source = XBMC_CREATETEMPFILE(".xml");
+  source->Write(INCLUDES, strlen(INCLUDES));
+  source->Flush();
+  const std::string file = XBMC_TEMPFILEPATH(source);
+
+  CGUIIncludes parsed;
+  parsed.EnableCache("skin.test.includes", "1.0.0");
+  parsed.Load(file);
+  ASSERT_TRUE(TestGUIIncludesHelper::IsCached(parsed));
+
+  CGUIIncludes cached;
+  cached.EnableCache("skin.test.includes", "1.0.0");
+  cached.Load(file);
+  ASSERT_TRUE(TestGUIIncludesHelper::IsCached(cached));
+
+  TestGUIIncludesHelper::ExpectEqual(parsed, cached);
+  const std::string window = TestGUIIncludesHelper::ResolveWindow(parsed);
+  EXPECT_EQ(window, TestGUIIncludesHelper::ResolveWindow(cached));
+
+  // make sure the window was resolved at all
+  EXPECT_EQ(std::string::npos, window.find("<include"));
+  EXPECT_EQ(std::string::npos, window.find("$PARAM"));
+  EXPECT_EQ(std::string::npos, window.find("$EXP"));
+  EXPECT_NE(std::string::npos, window.find("<font>font13</font>"));
+  EXPECT_NE(std::string::npos, window.find("<label>ok</label>"));
+  EXPECT_NE(std::string::npos, window.find("<label>cancel</label>"));
+  EXPECT_NE(std::string::npos, window.find("<width>20</width>"));
+
+  CGUISkinCache cache;
+  cache.Open("skin.test.includes", "1.0.0");
+  cache.Clear();
+  XBMC_DELETETEMPFILE(source);
+}
@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/TextureAtlas.h"
+#include "utils/Geometry.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestTextureAtlas, PackerNoOverlap)
+{
+  CTextureAtlasPacker packer(1024);
+  std::vector<CRect> placed;
+
+  // icons, buttons and borders of mixed sizes
+  const unsigned int sizes[][2] = {{64, 64}, {34, 34}, {130, 40}, {16, 48}, {258, 66}, {50, 50}};
+  for (int i = 0; i < 120; ++i)
+  {
+    const unsigned int width = sizes[i % 6][0];
+    const unsigned int height = sizes[i % 6][1];
+    const auto position = packer.Add(width, height);
+    if (!position)
+      break;
+
+    const CRect rect(position->first, position->second, position->first + width,
+                     position->second + height);
+    EXPECT_LE(rect.x2, 1024.0f);
+    EXPECT_LE(rect.y2, 1024.0f);
+    for (const CRect& other : placed)
+      EXPECT_FALSE(rect.Intersects(other));
+    placed.push_back(rect);
+  }
+
+  EXPECT_EQ(120u, placed.size());
+}
+
+TEST(TestTextureAtlas, PackerShelves)
+{
+  CTextureAtlasPacker packer(256);
+
+  // similar heights share a shelf
+  EXPECT_EQ(std::make_pair(0u, 0u), packer.Add(100, 40).value());
+  EXPECT_EQ(std::make_pair(100u, 0u), packer.Add(100, 30).value());
+
+  // much lower ones start a new shelf below
+  EXPECT_EQ(std::make_pair(0u, 40u), packer.Add(100, 10).value());
+
+  // lower ones fill the rest of a higher shelf though, if they use at least half of its height
+  EXPECT_EQ(std::make_pair(200u, 0u), packer.Add(50, 20).value());
+
+  // and go to a new shelf if nothing else fits
+  EXPECT_EQ(std::make_pair(0u, 50u), packer.Add(60, 20).value());
+
+  EXPECT_EQ(100u * 40 + 100 * 30 + 100 * 10 + 50 * 20 + 60 * 20, packer.GetUsedArea());
+}
+
+TEST(TestTextureAtlas, PackerFull)
+{
+  CTextureAtlasPacker packer(256);
+  EXPECT_FALSE(packer.Add(257, 10));
+
+  for (int i = 0; i < 4; ++i)
+    EXPECT_TRUE(packer.Add(256, 64));
+  EXPECT_FALSE(packer.Add(1, 1));
+}
@@ -8,8 +8,11 @@
 
 #include "InfoBool.h"
 
+#include "GUIInfoManager.h"
 #include "utils/StringUtils.h"
 
+#include <algorithm>
+
 namespace INFO
 {
 InfoBool::InfoBool(const std::string& expression, int context, unsigned int& refreshCounter)
@@ -17,4 +20,33 @@ InfoBool::InfoBool(const std::string& expression, int context, unsigned int& ref
 {
   StringUtils::ToLower(m_expression);
 }
+
+void InfoBool::Initialize(CGUIInfoManager* infoMgr)
+{
+  m_infoMgr = infoMgr;
+  m_changes = &infoMgr->GetInfoProviders().GetChanges();
+  m_profile = infoMgr->IsProfilingConditions();
+}
+
+bool InfoBool::AddDependencies(
+    KODI::GUILIB::GUIINFO::CGUIInfoChanges::Dependencies& dependencies) const
+{
+  if (m_dependencies.empty())
+    return false;
+
+  for (const auto* stamp : m_dependencies)
+  {
+    if (std::ranges::find(dependencies, stamp) == dependencies.end())
+      dependencies.emplace_back(stamp);
+  }
+  return true;
+}
+
+void InfoBool::EvaluateProfiled(int contextWindow, const CGUIListItem* item)
+{
+  const auto start = std::chrono::steady_clock::now();
+  Update(contextWindow, item);
+  m_evaluationTime += std::chrono::steady_clock::now() - start;
+  ++m_evaluations;
+}
 }
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include "guilib/guiinfo/GUIInfoChanges.h"
+
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -26,20 +29,30 @@ public:
   InfoBool(const std::string &expression, int context, unsigned int &refreshCounter);
   virtual ~InfoBool() = default;
 
-  virtual void Initialize(CGUIInfoManager* infoMgr) { m_infoMgr = infoMgr; }
+  virtual void Initialize(CGUIInfoManager* infoMgr);
 
   /*! \brief Get the value of this info bool
-   This is called to update (if dirty) and fetch the value of the info bool
+   This is called to update (if dirty) and fetch the value of the info bool. If all infos the bool
+   depends on publish their changes, it is dirty after one of them changed, otherwise after every
+   cache reset of the info manager.
    \param contextWindow the context (window id) where this condition is being evaluated
    \param item the item used to evaluate the bool
    */
   inline bool Get(int contextWindow, const CGUIListItem* item = nullptr)
   {
     if (item && m_listItemDependent)
-      Update(contextWindow, item);
+      Evaluate(contextWindow, item);
+    else if (!m_dependencies.empty())
+    {
+      if (KODI::GUILIB::GUIINFO::CGUIInfoChanges::HasChanged(m_dependencies, m_changeStamp))
+      {
+        m_changeStamp = m_changes->GetCurrentStamp();
+        Evaluate(contextWindow, nullptr);
+      }
+    }
     else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
     {
-      Update(contextWindow, nullptr);
+      Evaluate(contextWindow, nullptr);
       m_refreshCounter = m_parentRefreshCounter;
     }
     return m_value;
@@ -68,16 +81,48 @@ public:
 
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
+
+  /*! \brief Add the change stamps of the infos this bool depends on
+   \param dependencies the stamps to add to
+   \return true if the bool only changes with the infos, false if it must be updated on every
+   cache reset
+   */
+  bool AddDependencies(KODI::GUILIB::GUIINFO::CGUIInfoChanges::Dependencies& dependencies) const;
+  bool IsChangeTracked() const { return !m_dependencies.empty(); }
+
+  /*! \brief Get the number of evaluations and their total time, including the time spent on
+   the bools this one depends on. Only counted if advanced setting gui.profileconditions is enabled.
+   */
+  unsigned int GetEvaluations() const { return m_evaluations; }
+  std::chrono::nanoseconds GetEvaluationTime() const { return m_evaluationTime; }
+
 protected:
   bool m_value = false; ///< current value
   int m_context;               ///< contextual information to go with the condition
   bool m_listItemDependent = false; ///< do not cache if a listitem pointer is given
   std::string  m_expression;   ///< original expression
   CGUIInfoManager* m_infoMgr;
+  KODI::GUILIB::GUIINFO::CGUIInfoChanges::Dependencies
+      m_dependencies; ///< change stamps of the infos, empty if not tracked
 
 private:
+  inline void Evaluate(int contextWindow, const CGUIListItem* item)
+  {
+    if (m_profile)
+      EvaluateProfiled(contextWindow, item);
+    else
+      Update(contextWindow, item);
+  }
+  void EvaluateProfiled(int contextWindow, const CGUIListItem* item);
+
   unsigned int m_refreshCounter = 0;
   unsigned int &m_parentRefreshCounter;
+  const KODI::GUILIB::GUIINFO::CGUIInfoChanges* m_changes = nullptr;
+  uint64_t m_changeStamp = 0;
+
+  bool m_profile = false;
+  unsigned int m_evaluations = 0;
+  std::chrono::nanoseconds m_evaluationTime{0};
 };
 
 typedef std::shared_ptr<InfoBool> InfoPtr;
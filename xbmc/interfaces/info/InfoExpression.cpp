@@ -11,6 +11,8 @@
 #include "GUIInfoManager.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <stack>
@@ -21,6 +23,8 @@ void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
   m_condition = m_infoMgr->TranslateSingleString(m_expression, m_listItemDependent);
+  if (!m_listItemDependent)
+    m_infoMgr->GetDependencies(m_condition, m_dependencies);
 }
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
@@ -34,11 +38,22 @@ void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
 void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
-  if (!Parse(m_expression))
+  InfoSubexpressionPtr tree;
+  if (!Parse(m_expression, tree))
   {
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
-    m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
+    tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
   }
+
+  if (tree->Type() != NODE_LEAF)
+    Share(static_cast<InfoAssociativeGroup&>(*tree));
+  Compile(*tree, END_TRUE, END_FALSE);
+
+  // only tracked if all of its operands are
+  if (m_listItemDependent ||
+      !std::ranges::all_of(m_operands, [this](const auto& operand)
+                           { return operand->AddDependencies(m_dependencies); }))
+    m_dependencies.clear();
 }
 
 void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
@@ -46,30 +61,42 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
   // use propagated context in case this info expression has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
-  m_value = m_expression_tree->Evaluate(context, item);
+
+  uint32_t next = 0;
+  do
+  {
+    const Instruction& instruction = m_program[next];
+    next = instruction.next[instruction.operand->Get(context, item)];
+  } while (next < END_FALSE);
+
+  m_value = next == END_TRUE;
 }
 
 /* Expressions are rewritten at parse time into a form which favours the
- * formation of groups of associative nodes. These groups are then reordered at
- * evaluation time such that nodes whose value renders the evaluation of the
- * remainder of the group unnecessary tend to be evaluated first (these are
- * true nodes for OR subexpressions, or false nodes for AND subexpressions).
- * The end effect is to minimise the number of leaf nodes that need to be
- * evaluated in order to determine the value of the expression. The runtime
- * adaptability has the advantage of not being customised for any particular skin.
- *
- * The modifications to the expression at parse time fall into two groups:
+ * formation of groups of associative nodes:
  * 1) Moving logical NOTs so that they are only applied to leaf nodes.
- *    For example, rewriting ![A+B]|C as !A|!B|C allows reordering such that
- *    any of the three leaves can be evaluated first.
+ *    For example, ![A+B]|C is rewritten as !A|!B|C.
  * 2) Combining adjacent AND or OR operations such that each path from the root
  *    to a leaf encounters a strictly alternating pattern of AND and OR
  *    operations. So [A|B]|[C|D+[[E|F]|G] becomes A|B|C|[D+[E|F|G]].
+ *
+ * Groups below the root which don't depend on list items are then replaced by
+ * a leaf referring to the group registered as an expression of its own, so
+ * [E|F|G] above is evaluated once for all expressions of the skin containing it.
+ *
+ * Finally the tree is compiled into a branching program with one instruction
+ * per leaf. Each instruction knows where to continue if its operand is true or
+ * false: with the next leaf of its group, or if that decides the value of the
+ * group, with whatever follows the group. So the leaves are evaluated in order
+ * and the evaluation stops as soon as the value of the expression is known,
+ * without any recursion or intermediate results.
  */
 
-bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* item)
+std::string InfoExpression::InfoLeaf::ToString() const
 {
-  return m_invert ^ m_info->Get(contextWindow, item);
+  const std::string& expression = m_info->GetExpression();
+  const bool isGroup = expression.find_first_of("|+[]!") != std::string::npos;
+  return (m_invert ? "!" : "") + (isGroup ? "[" + expression + "]" : expression);
 }
 
 InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
@@ -92,27 +119,90 @@ void InfoExpression::InfoAssociativeGroup::Merge(const std::shared_ptr<InfoAssoc
   m_children.splice(m_children.end(), other->m_children);
 }
 
-bool InfoExpression::InfoAssociativeGroup::Evaluate(int contextWindow, const CGUIListItem* item)
+bool InfoExpression::InfoAssociativeGroup::ListItemDependent() const
 {
-  /* Handle either AND or OR by using the relation
-   * A AND B == !(!A OR !B)
-   * to convert ANDs into ORs
+  return std::ranges::any_of(m_children,
+                             [](const auto& child) { return child->ListItemDependent(); });
+}
+
+std::string InfoExpression::InfoAssociativeGroup::ToString() const
+{
+  std::string expression;
+  for (const auto& child : m_children)
+  {
+    if (!expression.empty())
+      expression += m_type == NODE_AND ? '+' : '|';
+    if (child->Type() == NODE_LEAF)
+      expression += child->ToString();
+    else
+      expression += "[" + child->ToString() + "]";
+  }
+  return expression;
+}
+
+unsigned int InfoExpression::InfoAssociativeGroup::Size() const
+{
+  unsigned int size = 0;
+  for (const auto& child : m_children)
+    size += child->Size();
+  return size;
+}
+
+void InfoExpression::Share(InfoAssociativeGroup& group)
+{
+  for (auto& child : group.GetChildren())
+  {
+    if (child->Type() == NODE_LEAF)
+      continue;
+
+    // list item dependent groups are evaluated per item anyway, so keep them inline
+    if (!child->ListItemDependent())
+    {
+      InfoPtr info = m_infoMgr->Register(child->ToString(), m_context);
+      if (info)
+      {
+        child = std::make_shared<InfoLeaf>(info, false);
+        continue;
+      }
+    }
+    Share(static_cast<InfoAssociativeGroup&>(*child));
+  }
+}
+
+void InfoExpression::Compile(const InfoSubexpression& node, uint32_t onTrue, uint32_t onFalse)
+{
+  if (node.Type() == NODE_LEAF)
+  {
+    const auto& leaf = static_cast<const InfoLeaf&>(node);
+    if (std::ranges::find(m_operands, leaf.GetInfo()) == m_operands.end())
+      m_operands.emplace_back(leaf.GetInfo());
+
+    if (leaf.IsInverted())
+      m_program.push_back({leaf.GetInfo().get(), {onTrue, onFalse}});
+    else
+      m_program.push_back({leaf.GetInfo().get(), {onFalse, onTrue}});
+    return;
+  }
+
+  /* Each child but the last one decides the value of an AND group if false and of an OR group if
+   * true, otherwise the evaluation continues with the next child, whose instructions directly
+   * follow the ones of this child.
    */
-  std::list<InfoSubexpressionPtr>::iterator last = m_children.end();
-  std::list<InfoSubexpressionPtr>::iterator it = m_children.begin();
-  bool use_and = (m_type == NODE_AND);
-  bool result = use_and ^ (*it)->Evaluate(contextWindow, item);
-  while (!result && ++it != last)
+  const auto& children = static_cast<const InfoAssociativeGroup&>(node).GetChildren();
+  for (auto it = children.begin(); it != children.end(); ++it)
   {
-    result = use_and ^ (*it)->Evaluate(contextWindow, item);
-    if (result)
+    const InfoSubexpression& child = **it;
+    if (std::next(it) == children.end())
+      Compile(child, onTrue, onFalse);
+    else
     {
-      /* Move this child to the head of the list so we evaluate faster next time */
-      m_children.push_front(*it);
-      m_children.erase(it);
+      const auto next = static_cast<uint32_t>(m_program.size() + child.Size());
+      if (node.Type() == NODE_AND)
+        Compile(child, next, onFalse);
+      else
+        Compile(child, onTrue, next);
     }
   }
-  return use_and ^ result;
 }
 
 /* Expressions are parsed using the shunting-yard algorithm. Binary operators
@@ -203,7 +293,7 @@ void InfoExpression::OperatorPop(std::stack<operator_t> &operator_stack, bool &i
   }
 }
 
-bool InfoExpression::Parse(const std::string &expression)
+bool InfoExpression::Parse(const std::string& expression, InfoSubexpressionPtr& tree)
 {
   const char *s = expression.c_str();
   std::string operand;
@@ -303,6 +393,6 @@ bool InfoExpression::Parse(const std::string &expression)
   while (!operator_stack.empty())
     OperatorPop(operator_stack, invert, nodes);
 
-  m_expression_tree = nodes.top();
+  tree = nodes.top();
   return true;
 }
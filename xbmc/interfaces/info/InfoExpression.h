@@ -10,8 +10,10 @@
 
 #include "InfoBool.h"
 
+#include <cstdint>
 #include <list>
 #include <stack>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -37,6 +39,12 @@ private:
 };
 
 /*! \brief Class to wrap active boolean expressions
+
+ The expression is parsed into a tree and compiled into a flat program, a list of instructions
+ each evaluating one operand and branching to the next instruction or to the result depending on
+ its value. Bracketed subexpressions not depending on list items are registered with the info
+ manager as expressions of their own, so that they are shared by all expressions of the skin using
+ them and evaluated once per cache reset only.
  */
 class InfoExpression : public InfoBool
 {
@@ -69,13 +77,15 @@ private:
     NODE_OR,
   } node_type_t;
 
-  // An abstract base class for nodes in the expression tree
+  // An abstract base class for nodes in the expression tree, which only exists while compiling
   class InfoSubexpression
   {
   public:
     virtual ~InfoSubexpression(void) = default; // so we can destruct derived classes using a pointer to their base class
-    virtual bool Evaluate(int contextWindow, const CGUIListItem* item) = 0;
     virtual node_type_t Type() const=0;
+    virtual bool ListItemDependent() const = 0;
+    virtual std::string ToString() const = 0;
+    virtual unsigned int Size() const = 0; ///< number of instructions compiled from it
   };
 
   typedef std::shared_ptr<InfoSubexpression> InfoSubexpressionPtr;
@@ -85,8 +95,13 @@ private:
   {
   public:
     InfoLeaf(InfoPtr info, bool invert) : m_info(std::move(info)), m_invert(invert) {}
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return NODE_LEAF; }
+    bool ListItemDependent() const override { return m_info->ListItemDependent(); }
+    std::string ToString() const override;
+    unsigned int Size() const override { return 1; }
+
+    const InfoPtr& GetInfo() const { return m_info; }
+    bool IsInverted() const { return m_invert; }
 
   private:
     InfoPtr m_info;
@@ -100,18 +115,37 @@ private:
     InfoAssociativeGroup(node_type_t type, const InfoSubexpressionPtr &left, const InfoSubexpressionPtr &right);
     void AddChild(const InfoSubexpressionPtr &child);
     void Merge(const std::shared_ptr<InfoAssociativeGroup>& other);
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return m_type; }
+    bool ListItemDependent() const override;
+    std::string ToString() const override;
+    unsigned int Size() const override;
+
+    std::list<InfoSubexpressionPtr>& GetChildren() { return m_children; }
+    const std::list<InfoSubexpressionPtr>& GetChildren() const { return m_children; }
 
   private:
     node_type_t m_type;
     std::list<InfoSubexpressionPtr> m_children;
   };
 
+  // An instruction of the compiled expression
+  struct Instruction
+  {
+    InfoBool* operand;
+    uint32_t next[2]; ///< instruction to continue with if the operand is false or true
+  };
+
+  static constexpr uint32_t END_FALSE = UINT32_MAX - 1; ///< the expression is false
+  static constexpr uint32_t END_TRUE = UINT32_MAX; ///< the expression is true
+
   static operator_t GetOperator(char ch);
   static void OperatorPop(std::stack<operator_t> &operator_stack, bool &invert, std::stack<InfoSubexpressionPtr> &nodes);
-  bool Parse(const std::string &expression);
-  InfoSubexpressionPtr m_expression_tree;
+  bool Parse(const std::string& expression, InfoSubexpressionPtr& tree);
+  void Share(InfoAssociativeGroup& group);
+  void Compile(const InfoSubexpression& node, uint32_t onTrue, uint32_t onFalse);
+
+  std::vector<Instruction> m_program;
+  std::vector<InfoPtr> m_operands; ///< the infos the instructions refer to
 };
 
 };
@@ -0,0 +1,334 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIInfoManager.h"
+#include "guilib/GUIListItem.h"
+#include "guilib/guiinfo/GUIInfo.h"
+#include "guilib/guiinfo/GUIInfoLabels.h"
+#include "guilib/guiinfo/GUIInfoProvider.h"
+#include "interfaces/info/InfoBool.h"
+#include "test/TestUtils.h"
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+#include "utils/XBMCTinyXML.h"
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::GUILIB::GUIINFO;
+
+namespace
+{
+// answers System.HasAddon(name) with the configured values, counting the evaluations
+class CTestGUIInfo : public CGUIInfoProvider
+{
+public:
+  bool InitCurrentItem(CFileItem* item) override { return false; }
+  bool GetLabel(std::string& value,
+                const CFileItem* item,
+                int contextWindow,
+                const CGUIInfo& info,
+                std::string* fallback) const override
+  {
+    return false;
+  }
+  bool GetInt(int& value,
+              const CGUIListItem* item,
+              int contextWindow,
+              const CGUIInfo& info) const override
+  {
+    return false;
+  }
+  bool GetBool(bool& value,
+               const CGUIListItem* item,
+               int contextWindow,
+               const CGUIInfo& info) const override
+  {
+    if (info.GetInfo() != SYSTEM_HAS_ADDON)
+      return false;
+
+    ++m_evaluations[info.GetData3()];
+    const auto it = m_values.find(info.GetData3());
+    value = it != m_values.end() && it->second;
+    return true;
+  }
+
+  std::map<std::string, bool> m_values;
+  mutable std::map<std::string, unsigned int> m_evaluations;
+};
+
+class TestInfoExpression : public ::testing::Test
+{
+protected:
+  TestInfoExpression()
+  {
+    m_provider.m_values = {{"a", true}, {"b", false}, {"c", true}, {"d", false}};
+    m_infoMgr.GetInfoProviders().RegisterProvider(&m_provider, false);
+    m_infoMgr.ResetCache(); // the bools are not cached before the first reset
+  }
+
+  ~TestInfoExpression() override { m_infoMgr.GetInfoProviders().UnregisterProvider(&m_provider); }
+
+  // expands the single letter operands a to d to System.HasAddon(a) to System.HasAddon(d)
+  INFO::InfoPtr Register(const std::string& expression)
+  {
+    std::string condition;
+    for (char c : expression)
+    {
+      if (c >= 'a' && c <= 'd')
+        condition += std::string("system.hasaddon(") + c + ")";
+      else
+        condition += c;
+    }
+    return m_infoMgr.Register(condition, 0);
+  }
+
+  CGUIInfoManager m_infoMgr;
+  CTestGUIInfo m_provider;
+};
+
+struct ExpressionTest
+{
+  std::string expression;
+  bool value;
+};
+
+const auto ExpressionTests = std::array{
+    ExpressionTest{"a+b", false},
+    ExpressionTest{"a|b", true},
+    ExpressionTest{"!a|b", false},
+    ExpressionTest{"![a+b]", true},
+    ExpressionTest{"[a|b]+[c|d]", true},
+    ExpressionTest{"[a+b]|[c+d]", false},
+    ExpressionTest{"!b+[d|!c|a]", true},
+    ExpressionTest{"a+![b|d]+c", true},
+    ExpressionTest{"[[a|b]+!c]|d", false},
+    ExpressionTest{"!![a + c] + ![b | !d]", false},
+    ExpressionTest{"a+", false},
+    ExpressionTest{"[a|b", false},
+};
+} // unnamed namespace
+
+TEST_F(TestInfoExpression, Evaluate)
+{
+  for (const auto& test : ExpressionTests)
+  {
+    const INFO::InfoPtr info = Register(test.expression);
+    ASSERT_TRUE(info);
+    EXPECT_EQ(test.value, info->Get(0)) << test.expression;
+  }
+}
+
+TEST_F(TestInfoExpression, ShortCircuit)
+{
+  EXPECT_FALSE(Register("b+[c|d]")->Get(0));
+  EXPECT_TRUE(Register("d|a|b")->Get(0));
+  EXPECT_EQ(1u, m_provider.m_evaluations["b"]);
+  EXPECT_EQ(1u, m_provider.m_evaluations["d"]);
+  EXPECT_EQ(0u, m_provider.m_evaluations["c"]);
+
+  // cached until the next cache reset
+  m_provider.m_values["a"] = false;
+  EXPECT_TRUE(Register("d|a|b")->Get(0));
+  m_infoMgr.ResetCache();
+  EXPECT_FALSE(Register("d|a|b")->Get(0));
+}
+
+TEST_F(TestInfoExpression, ListItem)
+{
+  CGUIListItem on;
+  on.SetProperty("on", true);
+  CGUIListItem off;
+
+  const INFO::InfoPtr info = Register("listitem.property(on)+[a|listitem.property(other)]");
+  EXPECT_TRUE(info->ListItemDependent());
+  EXPECT_TRUE(info->Get(0, &on));
+  EXPECT_FALSE(info->Get(0, &off));
+
+  // the item dependent group is evaluated per item
+  off.SetProperty("on", true);
+  m_provider.m_values["a"] = false;
+  m_infoMgr.ResetCache();
+  EXPECT_FALSE(info->Get(0, &off));
+  off.SetProperty("other", true);
+  EXPECT_TRUE(info->Get(0, &off));
+}
+
+TEST_F(TestInfoExpression, SharedSubexpressions)
+{
+  // a group is registered once for all expressions containing it, whatever its brackets or the
+  // expressions around it
+  const INFO::InfoPtr first = Register("a+[b|c]");
+  const INFO::InfoPtr second = Register("!d+[[b]|c]");
+  const INFO::InfoPtr shared = Register("b|c");
+  EXPECT_EQ(4, shared.use_count()); // the info manager, both expressions and this one
+
+  EXPECT_TRUE(first->Get(0));
+  EXPECT_TRUE(second->Get(0));
+
+  // but not if depending on list items, only the info manager and this one refer to it then
+  const INFO::InfoPtr item = Register("a+[b|listitem.property(other)]");
+  EXPECT_EQ(2, Register("b|listitem.property(other)").use_count());
+}
+
+// benchmark over the conditions of the default skin, run with --gtest_also_run_disabled_tests
+TEST_F(TestInfoExpression, DISABLED_DefaultSkin)
+{
+  std::map<std::string, std::string> expressions;
+  std::vector<std::string> conditions;
+
+  const auto collect = [&](const auto& self, const TiXmlElement* element) -> void
+  {
+    for (; element; element = element->NextSiblingElement())
+    {
+      const std::string tag = element->ValueStr();
+      const char* condition = element->Attribute("condition");
+      if (condition)
+        conditions.emplace_back(condition);
+      if (element->GetText())
+      {
+        if (tag == "expression" && element->Attribute("name"))
+          expressions[element->Attribute("name")] = element->GetText();
+        else if (tag == "visible" || tag == "enable" || tag == "selected" ||
+                 tag == "usealttexture")
+          conditions.emplace_back(element->GetText());
+      }
+      self(self, element->FirstChildElement());
+    }
+  };
+
+  const std::string skin = XBMC_REF_FILE_PATH("addons/skin.estuary/xml/");
+  for (const auto& entry : std::filesystem::directory_iterator(skin))
+  {
+    CXBMCTinyXML document;
+    if (entry.path().extension() == ".xml" && document.LoadFile(entry.path().string()))
+      collect(collect, document.RootElement());
+  }
+  ASSERT_FALSE(conditions.empty());
+
+  // resolve $EXP[] and replace the operands by provider infos, keeping the structure of the
+  // conditions and which of them depend on list items
+  std::map<std::string, std::string> operands;
+  const auto translate = [&](const auto& self, const std::string& condition,
+                             int depth) -> std::string
+  {
+    std::string result;
+    std::string operand;
+    const auto flush = [&]
+    {
+      StringUtils::Trim(operand);
+      StringUtils::ToLower(operand);
+      if (!operand.empty())
+      {
+        auto [it, inserted] = operands.try_emplace(operand);
+        if (inserted)
+          it->second = (operand.find("listitem") != std::string::npos ? "listitem.property("
+                                                                       : "system.hasaddon(") +
+                       std::to_string(operands.size()) + ")";
+        result += it->second;
+      }
+      operand.clear();
+    };
+
+    for (size_t i = 0; i < condition.size(); ++i)
+    {
+      if (condition[i] == '$')
+      {
+        // skip to the matching bracket
+        const size_t start = condition.find('[', i);
+        size_t end = start;
+        for (int brackets = 0; end < condition.size(); ++end)
+        {
+          if (condition[end] == '[')
+            ++brackets;
+          else if (condition[end] == ']' && --brackets == 0)
+            break;
+        }
+        if (start == std::string::npos || end == condition.size())
+          break;
+
+        const std::string name = condition.substr(i + 1, start - i - 1);
+        const std::string value = condition.substr(start + 1, end - start - 1);
+        if (StringUtils::EqualsNoCase(name, "exp") && depth < 10)
+          result += "[" + self(self, expressions.contains(value) ? expressions[value] : "false",
+                               depth + 1) + "]";
+        else
+          operand += name + value;
+        i = end;
+      }
+      else if (std::string("[]!+|").find(condition[i]) != std::string::npos)
+      {
+        flush();
+        result += condition[i];
+      }
+      else
+        operand += condition[i];
+    }
+    flush();
+    return result;
+  };
+
+  std::vector<INFO::InfoPtr> roots;
+  std::vector<INFO::InfoPtr> itemRoots;
+  for (const auto& condition : conditions)
+  {
+    INFO::InfoPtr info = m_infoMgr.Register(translate(translate, condition, 0), 0);
+    if (info)
+      (info->ListItemDependent() ? itemRoots : roots).emplace_back(std::move(info));
+  }
+
+  for (size_t i = 1; i <= operands.size(); ++i)
+    m_provider.m_values[std::to_string(i)] = i % 4 != 0;
+
+  // the items of a large panel container
+  std::vector<CGUIListItem> items(60);
+  for (size_t i = 0; i < items.size(); ++i)
+  {
+    for (size_t j = 1; j <= operands.size(); ++j)
+    {
+      if ((i + j) % 3 != 0)
+        items[i].SetProperty(std::to_string(j), true);
+    }
+  }
+
+  constexpr int FRAMES = 2000;
+  size_t values = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < FRAMES; ++frame)
+  {
+    m_infoMgr.ResetCache();
+    for (const auto& info : roots)
+      values += info->Get(0);
+  }
+  const auto middle = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < FRAMES; ++frame)
+  {
+    m_infoMgr.ResetCache();
+    for (const auto& item : items)
+    {
+      for (const auto& info : itemRoots)
+        values += info->Get(0, &item);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  const std::chrono::duration<double, std::micro> frameTime = middle - start;
+  const std::chrono::duration<double, std::micro> itemsTime = end - middle;
+  std::cout << conditions.size() << " conditions, " << roots.size() << " + " << itemRoots.size()
+            << " item dependent: " << frameTime.count() / FRAMES << " us per frame, "
+            << itemsTime.count() / FRAMES << " us per " << items.size() << " items (" << values
+            << ")\n";
+}
@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "JSONRPCResponseStream.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "filesystem/Directory.h"
@@ -265,54 +266,52 @@ JSONRPC_STATUS CAudioLibrary::GetAlbums(const std::string &method, ITransportLay
   if (!musicdatabase.GetAlbumsByWhereJSON(fields, musicUrl.ToString(), result, total, sorting))
     return InternalError;
 
-  if (!result.isNull())
+  std::set<std::string> artfields;
+  for (const char* field : {"art", "fanart", "thumbnail"})
   {
-    bool bFetchArt = fields.contains("art");
-    bool bFetchFanart = fields.contains("fanart");
-    if (bFetchArt || bFetchFanart)
-    {
-      CThumbLoader* thumbLoader = new CMusicThumbLoader();
-      thumbLoader->OnLoaderStart();
-
-      std::set<std::string> artfields;
-      if (bFetchArt)
-        artfields.insert("art");
-      if (bFetchFanart)
-        artfields.insert("fanart");
-
-      for (unsigned int index = 0; index < result["albums"].size(); index++)
-      {
-        CFileItem item;
-        item.GetMusicInfoTag()->SetDatabaseId(result["albums"][index]["albumid"].asInteger32(), MediaTypeAlbum);
-
-        // Could use FillDetails, but it does unnecessary serialization of empty MusiInfoTag
-        // CFileItemPtr itemptr(new CFileItem(item));
-        // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, result["albums"][index], thumbLoader);
-
-        thumbLoader->FillLibraryArt(item);
+    if (fields.contains(field))
+      artfields.insert(field);
+  }
 
-        if (bFetchFanart)
-        {
-          if (item.HasArt("fanart"))
-            result["albums"][index]["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
-          else
-            result["albums"][index]["fanart"] = "";
-        }
-        if (bFetchArt)
+  // the songs have been read already, but their art is only looked up while they're sent
+  if (result.isMember("songs") && CJSONRPCResponseStream::CanStreamArray())
+  {
+    struct StreamedSongs
+    {
+      CVariant songs;
+      unsigned int next = 0;
+      std::unique_ptr<CThumbLoader> thumbLoader;
+    };
+    auto streamed = std::make_shared<StreamedSongs>();
+    streamed->songs.swap(result["songs"]);
+    result.erase("songs");
+
+    CJSONRPCResponseStream::StreamArray(
+        "songs",
+        [streamed, artfields](CVariant& element)
         {
-          const KODI::ART::Artwork& artMap = item.GetArt();
-          CVariant artObj(CVariant::VariantTypeObject);
-          for (const auto& artIt : artMap)
+          if (streamed->next >= streamed->songs.size())
+            return false;
+
+          element.swap(streamed->songs[streamed->next++]);
+          if (!artfields.empty())
           {
-            if (!artIt.second.empty())
-              artObj[artIt.first] = IMAGE_FILES::URLFromFile(artIt.second);
+            if (!streamed->thumbLoader)
+            {
+              streamed->thumbLoader = std::make_unique<CMusicThumbLoader>();
+              streamed->thumbLoader->OnLoaderStart();
+            }
+            FillSongArt(*streamed->thumbLoader, artfields, element);
           }
-          result["albums"][index]["art"] = artObj;
-        }
-      }
-
-      delete thumbLoader;
-    }
+          return true;
+        });
+  }
+  else if (!result.isNull() && !artfields.empty())
+  {
+    CMusicThumbLoader thumbLoader;
+    thumbLoader.OnLoaderStart();
+    for (unsigned int index = 0; index < result["songs"].size(); index++)
+      FillSongArt(thumbLoader, artfields, result["songs"][index]);
   }
 
   int start, end;
@@ -321,170 +320,50 @@ JSONRPC_STATUS CAudioLibrary::GetAlbums(const std::string &method, ITransportLay
   return OK;
 }
 
-JSONRPC_STATUS CAudioLibrary::GetAlbumDetails(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
+void CAudioLibrary::FillSongArt(CThumbLoader& thumbLoader,
+                                const std::set<std::string>& artfields,
+                                CVariant& song)
 {
-  int albumID = (int)parameterObject["albumid"].asInteger();
-
-  CMusicDatabase musicdatabase;
-  if (!musicdatabase.Open())
-    return InternalError;
-
-  CAlbum album;
-  if (!musicdatabase.GetAlbum(albumID, album, false))
-    return InvalidParams;
-
-  std::string path = StringUtils::Format("musicdb://albums/{}/", albumID);
-
-  CFileItemPtr albumItem;
-  FillAlbumItem(album, path, albumItem);
-
-  CFileItemList items;
-  items.Add(albumItem);
-  JSONRPC_STATUS ret = GetAdditionalAlbumDetails(parameterObject, items, musicdatabase);
-  if (ret != OK)
-    return ret;
-
-  HandleFileItem("albumid", false, "albumdetails", items[0], parameterObject, parameterObject["properties"], result, false);
-
-  return OK;
-}
-
-JSONRPC_STATUS CAudioLibrary::GetSongs(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
-{
-  CMusicDatabase musicdatabase;
-  if (!musicdatabase.Open())
-    return InternalError;
-
-  CMusicDbUrl musicUrl;
-  if (!musicUrl.FromString("musicdb://songs/"))
-    return InternalError;
-
-  if (parameterObject["singlesonly"].asBoolean())
-    musicUrl.AddOption("singles", true);
-  else if (!parameterObject["includesingles"].asBoolean())
-    musicUrl.AddOption("singles", false);
+  CFileItem item;
+  // Only needs song and album id (if we have it) set to get art
+  // Getting art is quicker if "albumid" has been fetched
+  item.GetMusicInfoTag()->SetDatabaseId(song["songid"].asInteger32(), MediaTypeSong);
+  if (song.isMember("albumid"))
+    item.GetMusicInfoTag()->SetAlbumId(song["albumid"].asInteger32());
+  else
+    item.GetMusicInfoTag()->SetAlbumId(-1);
 
-  bool allroles = false;
-  if (parameterObject["allroles"].isBoolean())
-    allroles = parameterObject["allroles"].asBoolean();
+  // Could use FillDetails, but it does unnecessary serialization of empty MusiInfoTag
+  // CFileItemPtr itemptr(new CFileItem(item));
+  // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, song, thumbLoader);
 
-  const CVariant &filter = parameterObject["filter"];
+  thumbLoader.FillLibraryArt(item);
 
-  if (allroles)
-    musicUrl.AddOption("roleid", -1000); //All roles, override implicit roleid=1 filter required for backward compatibility
-  else if (filter.isMember("roleid"))
-    musicUrl.AddOption("roleid", static_cast<int>(filter["roleid"].asInteger()));
-  else if (filter.isMember("role"))
-    musicUrl.AddOption("role", filter["role"].asString());
-  // Only one of genreid/genre, artistid/artist, albumid/album or rules type filter is allowed by filter syntax
-  if (filter.isMember("artistid"))
-    musicUrl.AddOption("artistid", static_cast<int>(filter["artistid"].asInteger()));
-  else if (filter.isMember("artist"))
-    musicUrl.AddOption("artist", filter["artist"].asString());
-  else if (filter.isMember("genreid"))
-    musicUrl.AddOption("genreid", static_cast<int>(filter["genreid"].asInteger()));
-  else if (filter.isMember("genre"))
-    musicUrl.AddOption("genre", filter["genre"].asString());
-  else if (filter.isMember("albumid"))
-    musicUrl.AddOption("albumid", static_cast<int>(filter["albumid"].asInteger()));
-  else if (filter.isMember("album"))
-    musicUrl.AddOption("album", filter["album"].asString());
-  else if (filter.isObject())
+  if (artfields.contains("thumbnail"))
   {
-    std::string xsp;
-    if (!GetXspFiltering("songs", filter, xsp))
-      return InvalidParams;
-
-    musicUrl.AddOption("xsp", xsp);
+    if (item.HasArt("thumb"))
+      song["thumbnail"] = IMAGE_FILES::URLFromFile(item.GetArt("thumb"));
+    else
+      song["thumbnail"] = "";
   }
-
-  SortDescription sorting;
-  ParseLimits(parameterObject, sorting.limitStart, sorting.limitEnd);
-  if (!ParseSorting(parameterObject, sorting.sortBy, sorting.sortOrder, sorting.sortAttributes))
-    return InvalidParams;
-
-  int total;
-  std::set<std::string, std::less<>> fields;
-  if (parameterObject.isMember("properties") && parameterObject["properties"].isArray())
+  if (artfields.contains("fanart"))
   {
-    for (CVariant::const_iterator_array field = parameterObject["properties"].begin_array();
-         field != parameterObject["properties"].end_array(); ++field)
-      fields.insert(field->asString());
+    if (item.HasArt("fanart"))
+      song["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
+    else
+      song["fanart"] = "";
   }
-
-  if (!musicdatabase.GetSongsByWhereJSON(fields, musicUrl.ToString(), result, total, sorting))
-    return InternalError;
-
-  if (!result.isNull())
+  if (artfields.contains("art"))
   {
-    bool bFetchArt = fields.contains("art");
-    bool bFetchFanart = fields.contains("fanart");
-    bool bFetchThumb = fields.contains("thumbnail");
-    if (bFetchArt || bFetchFanart || bFetchThumb)
+    const KODI::ART::Artwork& artMap = item.GetArt();
+    CVariant artObj(CVariant::VariantTypeObject);
+    for (const auto& artIt : artMap)
     {
-      CThumbLoader* thumbLoader = new CMusicThumbLoader();
-      thumbLoader->OnLoaderStart();
-
-      std::set<std::string> artfields;
-      if (bFetchArt)
-        artfields.insert("art");
-      if (bFetchFanart)
-        artfields.insert("fanart");
-      if (bFetchThumb)
-        artfields.insert("thumbnail");
-
-      for (unsigned int index = 0; index < result["songs"].size(); index++)
-      {
-        CFileItem item;
-        // Only needs song and album id (if we have it) set to get art
-        // Getting art is quicker if "albumid" has been fetched
-        item.GetMusicInfoTag()->SetDatabaseId(result["songs"][index]["songid"].asInteger32(), MediaTypeSong);
-        if (result["songs"][index].isMember("albumid"))
-          item.GetMusicInfoTag()->SetAlbumId(result["songs"][index]["albumid"].asInteger32());
-        else
-          item.GetMusicInfoTag()->SetAlbumId(-1);
-
-        // Could use FillDetails, but it does unnecessary serialization of empty MusiInfoTag
-        // CFileItemPtr itemptr(new CFileItem(item));
-        // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, result["songs"][index], thumbLoader);
-
-        thumbLoader->FillLibraryArt(item);
-
-        if (bFetchThumb)
-        {
-          if (item.HasArt("thumb"))
-            result["songs"][index]["thumbnail"] = IMAGE_FILES::URLFromFile(item.GetArt("thumb"));
-          else
-            result["songs"][index]["thumbnail"] = "";
-        }
-        if (bFetchFanart)
-        {
-          if (item.HasArt("fanart"))
-            result["songs"][index]["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
-          else
-            result["songs"][index]["fanart"] = "";
-        }
-        if (bFetchArt)
-        {
-          const KODI::ART::Artwork& artMap = item.GetArt();
-          CVariant artObj(CVariant::VariantTypeObject);
-          for (const auto& artIt : artMap)
-          {
-            if (!artIt.second.empty())
-              artObj[artIt.first] = IMAGE_FILES::URLFromFile(artIt.second);
-          }
-          result["songs"][index]["art"] = artObj;
-        }
-      }
-
-      delete thumbLoader;
+      if (!artIt.second.empty())
+        artObj[artIt.first] = IMAGE_FILES::URLFromFile(artIt.second);
     }
+    song["art"] = artObj;
   }
-
-  int start, end;
-  HandleLimits(parameterObject, result, total, start, end);
-
-  return OK;
 }
 
 JSONRPC_STATUS CAudioLibrary::GetSongDetails(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -536,7 +415,7 @@ JSONRPC_STATUS CAudioLibrary::GetRecentlyAddedAlbums(const std::string &method,
   if (ret != OK)
     return ret;
 
-  HandleFileItemList("albumid", false, "albums", items, parameterObject, result);
+  StreamFileItemList("albumid", false, "albums", items, parameterObject, result);
   return OK;
 }
 
@@ -558,7 +437,7 @@ JSONRPC_STATUS CAudioLibrary::GetRecentlyAddedSongs(const std::string &method, I
   if (ret != OK)
     return ret;
 
-  HandleFileItemList("songid", true, "songs", items, parameterObject, result);
+  StreamFileItemList("songid", true, "songs", items, parameterObject, result);
   return OK;
 }
 
@@ -586,7 +465,7 @@ JSONRPC_STATUS CAudioLibrary::GetRecentlyPlayedAlbums(const std::string &method,
   if (ret != OK)
     return ret;
 
-  HandleFileItemList("albumid", false, "albums", items, parameterObject, result);
+  StreamFileItemList("albumid", false, "albums", items, parameterObject, result);
   return OK;
 }
 
@@ -604,7 +483,7 @@ JSONRPC_STATUS CAudioLibrary::GetRecentlyPlayedSongs(const std::string &method,
   if (ret != OK)
     return ret;
 
-  HandleFileItemList("songid", true, "songs", items, parameterObject, result);
+  StreamFileItemList("songid", true, "songs", items, parameterObject, result);
   return OK;
 }
 
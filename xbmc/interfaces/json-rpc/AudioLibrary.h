@@ -20,6 +20,7 @@ class CAlbum;
 class CFileitem;
 class CFileitemList;
 class CMusicDatabase;
+class CThumbLoader;
 class CVariant;
 
 namespace JSONRPC
@@ -86,6 +87,9 @@ namespace JSONRPC
                               std::shared_ptr<CFileItem>& item);
     static void FillItemArtistIDs(const std::vector<int>& artistids,
                                   std::shared_ptr<CFileItem>& item);
+    static void FillSongArt(CThumbLoader& thumbLoader,
+                            const std::set<std::string>& artfields,
+                            CVariant& song);
 
     static bool CheckForAdditionalProperties(const CVariant &properties, const std::set<std::string> &checkProperties, std::set<std::string> &foundProperties);
   };
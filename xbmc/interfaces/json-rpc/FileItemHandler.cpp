@@ -11,6 +11,7 @@
 #include "AudioLibrary.h"
 #include "FileItemList.h"
 #include "FileOperations.h"
+#include "JSONRPCResponseStream.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "VideoLibrary.h"
@@ -334,6 +335,95 @@ void CFileItemHandler::HandleFileItemList(const char *ID, bool allowFile, const
   delete thumbLoader;
 }
 
+void CFileItemHandler::StreamFileItemList(const char* ID,
+                                          bool allowFile,
+                                          const char* resultname,
+                                          CFileItemList& items,
+                                          const CVariant& parameterObject,
+                                          CVariant& result,
+                                          bool sortLimit /* = true */)
+{
+  StreamFileItemList(ID, allowFile, resultname, items, parameterObject, result, items.Size(),
+                     sortLimit);
+}
+
+void CFileItemHandler::StreamFileItemList(const char* ID,
+                                          bool allowFile,
+                                          const char* resultname,
+                                          CFileItemList& items,
+                                          const CVariant& parameterObject,
+                                          CVariant& result,
+                                          int size,
+                                          bool sortLimit /* = true */)
+{
+  if (!CJSONRPCResponseStream::CanStreamArray())
+  {
+    HandleFileItemList(ID, allowFile, resultname, items, parameterObject, result, size, sortLimit);
+    return;
+  }
+
+  int start, end;
+  HandleLimits(parameterObject, result, size, start, end);
+
+  if (sortLimit)
+    Sort(items, parameterObject);
+  else
+  {
+    start = 0;
+    end = items.Size();
+  }
+
+  std::set<std::string> fields;
+  if (parameterObject.isMember("properties") && parameterObject["properties"].isArray())
+  {
+    for (CVariant::const_iterator_array field = parameterObject["properties"].begin_array();
+         field != parameterObject["properties"].end_array(); ++field)
+      fields.insert(field->asString());
+  }
+
+  // the items are only serialised while the response is sent, so the generator keeps
+  // its own references to them and releases each one as soon as it has been written
+  struct StreamedItems
+  {
+    std::vector<std::shared_ptr<CFileItem>> items;
+    size_t next = 0;
+    std::unique_ptr<CThumbLoader> thumbLoader;
+  };
+  auto streamed = std::make_shared<StreamedItems>();
+  streamed->items.reserve(static_cast<size_t>(end - start));
+  for (int i = start; i < end; i++)
+    streamed->items.emplace_back(items.Get(i));
+
+  const bool hasID = ID != nullptr;
+  const std::string id = hasID ? ID : "";
+  const std::string name = resultname;
+  CJSONRPCResponseStream::StreamArray(
+      name,
+      [=](CVariant& element)
+      {
+        if (streamed->next >= streamed->items.size())
+          return false;
+
+        std::shared_ptr<CFileItem> item = std::move(streamed->items[streamed->next++]);
+        if (!streamed->thumbLoader)
+        {
+          if (item->HasVideoInfoTag())
+            streamed->thumbLoader = std::make_unique<CVideoThumbLoader>();
+          else if (item->HasMusicInfoTag())
+            streamed->thumbLoader = std::make_unique<CMusicThumbLoader>();
+
+          if (streamed->thumbLoader)
+            streamed->thumbLoader->OnLoaderStart();
+        }
+
+        CVariant object;
+        HandleFileItem(hasID ? id.c_str() : nullptr, allowFile, name.c_str(), item,
+                       parameterObject, fields, object, false, streamed->thumbLoader.get());
+        element = std::move(object[name]);
+        return true;
+      });
+}
+
 void CFileItemHandler::HandleFileItem(const char* ID,
                                       bool allowFile,
                                       const char* resultname,
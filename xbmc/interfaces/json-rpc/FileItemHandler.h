@@ -32,6 +32,26 @@ namespace JSONRPC
                             CThumbLoader* thumbLoader = nullptr);
     static void HandleFileItemList(const char *ID, bool allowFile, const char *resultname, CFileItemList &items, const CVariant &parameterObject, CVariant &result, bool sortLimit = true);
     static void HandleFileItemList(const char *ID, bool allowFile, const char *resultname, CFileItemList &items, const CVariant &parameterObject, CVariant &result, int size, bool sortLimit = true);
+    /*!
+     \brief Same as HandleFileItemList() but the items are serialised while the response is sent
+     if the transport supports it. \p result has to be the result of the called method and must
+     not get another member named \p resultname.
+     */
+    static void StreamFileItemList(const char* ID,
+                                   bool allowFile,
+                                   const char* resultname,
+                                   CFileItemList& items,
+                                   const CVariant& parameterObject,
+                                   CVariant& result,
+                                   bool sortLimit = true);
+    static void StreamFileItemList(const char* ID,
+                                   bool allowFile,
+                                   const char* resultname,
+                                   CFileItemList& items,
+                                   const CVariant& parameterObject,
+                                   CVariant& result,
+                                   int size,
+                                   bool sortLimit = true);
     static void HandleFileItem(const char* ID,
                                bool allowFile,
                                const char* resultname,
@@ -241,7 +241,42 @@ JSONRPC_STATUS CJSONRPC::NotifyAll(const std::string &method, ITransportLayer *t
 
 std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client)
 {
-  CVariant inputroot, outputroot, result;
+  CVariant outputroot;
+  CJSONRPCResponseStream::CCallScope noStreaming(false);
+  std::string str;
+  if (HandleRequest(inputString, outputroot, transport, client))
+    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+
+  return str;
+}
+
+std::unique_ptr<CJSONRPCResponseStream> CJSONRPC::MethodCallStreamed(
+    const std::string& inputString, ITransportLayer* transport, IClient* client)
+{
+  CVariant outputroot;
+  CJSONRPCResponseStream::CCallScope streamScope(true);
+  const bool compact =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact;
+
+  if (!HandleRequest(inputString, outputroot, transport, client))
+    return std::make_unique<CJSONRPCResponseStream>(std::string());
+
+  // the generator is dropped if the method failed after handing it over
+  if (streamScope.m_generator && outputroot.isMember("result") && outputroot["result"].isObject())
+    return std::make_unique<CJSONRPCResponseStream>(outputroot, streamScope.m_arrayName,
+                                                    std::move(streamScope.m_generator), compact);
+
+  std::string str;
+  CJSONVariantWriter::Write(outputroot, str, compact);
+  return std::make_unique<CJSONRPCResponseStream>(std::move(str));
+}
+
+bool CJSONRPC::HandleRequest(const std::string& inputString,
+                             CVariant& outputroot,
+                             ITransportLayer* transport,
+                             IClient* client)
+{
+  CVariant inputroot;
   bool hasResponse = false;
 
   CLog::Log(LOGDEBUG, LOGJSONRPC, "JSONRPC: Incoming request: {}", inputString);
@@ -258,6 +293,8 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
       }
       else
       {
+        // the responses of a batch call are collected, nothing is streamed
+        CJSONRPCResponseStream::CCallScope batchScope(false);
         for (CVariant::const_iterator_array itr = inputroot.begin_array();
              itr != inputroot.end_array(); ++itr)
         {
@@ -280,11 +317,7 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
     hasResponse = true;
   }
 
-  std::string str;
-  if (hasResponse)
-    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
-
-  return str;
+  return hasResponse;
 }
 
 bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client)
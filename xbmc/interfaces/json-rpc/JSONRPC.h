@@ -8,11 +8,13 @@
 
 #pragma once
 
+#include "JSONRPCResponseStream.h"
 #include "JSONRPCUtils.h"
 #include "JSONServiceDescription.h"
 
 #include <iostream>
 #include <map>
+#include <memory>
 #include <stdio.h>
 #include <string>
 
@@ -53,6 +55,20 @@ namespace JSONRPC
      */
     static std::string MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client);
 
+    /*
+     \brief Handles an incoming JSON-RPC request with a response that is serialised while it is read
+     \param inputString received JSON-RPC request
+     \param transport Transport protocol on which the request arrived
+     \param client Client which sent the request
+     \return JSON-RPC response to be sent back to the client chunk by chunk
+
+     Same as MethodCall() but lists returned by a single (non-batch) call are
+     only created and serialised while the response is read from the stream.
+     */
+    static std::unique_ptr<CJSONRPCResponseStream> MethodCallStreamed(const std::string& inputString,
+                                                                      ITransportLayer* transport,
+                                                                      IClient* client);
+
     static JSONRPC_STATUS Introspect(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Version(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Permission(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
@@ -62,6 +78,10 @@ namespace JSONRPC
     static JSONRPC_STATUS NotifyAll(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
 
   private:
+    static bool HandleRequest(const std::string& inputString,
+                              CVariant& outputroot,
+                              ITransportLayer* transport,
+                              IClient* client);
     static bool HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client);
     static inline bool IsProperJSONRPC(const CVariant& inputroot);
 
@@ -0,0 +1,150 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "JSONRPCResponseStream.h"
+
+#include "utils/JSONVariantWriter.h"
+
+#include <utility>
+
+using namespace JSONRPC;
+
+namespace
+{
+// elements are serialised until a chunk has at least this size
+constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+thread_local CJSONRPCResponseStream::CCallScope* currentCall = nullptr;
+
+std::string Serialize(const CVariant& value, int depth, bool compact)
+{
+  std::string str;
+  CJSONVariantWriter::Write(value, str, compact);
+  if (compact || depth == 0)
+    return str;
+
+  // the writer indents with one tab per level, starting at the outermost value
+  const std::string indent = "\n" + std::string(depth, '\t');
+  std::string indented;
+  indented.reserve(str.size());
+  for (char c : str)
+  {
+    if (c == '\n')
+      indented += indent;
+    else
+      indented += c;
+  }
+  return indented;
+}
+
+void AppendKey(std::string& out, const std::string& key, int depth, bool compact)
+{
+  if (!compact)
+    out += "\n" + std::string(depth, '\t');
+  out += Serialize(CVariant(key), 0, true);
+  out += compact ? ":" : ": ";
+}
+} // namespace
+
+CJSONRPCResponseStream::CCallScope::CCallScope(bool allowStreaming)
+  : m_allowStreaming(allowStreaming), m_previous(currentCall)
+{
+  currentCall = this;
+}
+
+CJSONRPCResponseStream::CCallScope::~CCallScope()
+{
+  currentCall = m_previous;
+}
+
+CJSONRPCResponseStream::CJSONRPCResponseStream(std::string response)
+  : m_buffer(std::move(response))
+{
+}
+
+CJSONRPCResponseStream::CJSONRPCResponseStream(const CVariant& response,
+                                               std::string arrayName,
+                                               StreamedArrayGenerator generator,
+                                               bool compact)
+  : m_generator(std::move(generator)), m_compact(compact)
+{
+  // everything but the streamed array is written up front, the result object goes last
+  // so that the array can be closed by a constant tail
+  m_buffer = "{";
+  for (auto it = response.begin_map(); it != response.end_map(); ++it)
+  {
+    if (it->first == "result")
+      continue;
+    AppendKey(m_buffer, it->first, 1, compact);
+    m_buffer += Serialize(it->second, 1, compact);
+    m_buffer += ",";
+  }
+
+  AppendKey(m_buffer, "result", 1, compact);
+  m_buffer += "{";
+  const CVariant& result = response["result"];
+  for (auto it = result.begin_map(); it != result.end_map(); ++it)
+  {
+    AppendKey(m_buffer, it->first, 2, compact);
+    m_buffer += Serialize(it->second, 2, compact);
+    m_buffer += ",";
+  }
+  AppendKey(m_buffer, arrayName, 2, compact);
+  m_buffer += "[";
+
+  m_tail = compact ? "}}" : "\n\t}\n}";
+}
+
+bool CJSONRPCResponseStream::ReadChunk(std::string& chunk)
+{
+  while (m_generator && m_buffer.size() < CHUNK_SIZE)
+  {
+    CVariant element;
+    if (m_generator(element))
+      WriteElement(element);
+    else
+    {
+      m_generator = nullptr;
+      m_buffer += (m_compact || m_empty) ? "]" : "\n\t\t]";
+      m_buffer += m_tail;
+    }
+  }
+
+  chunk.clear();
+  if (m_buffer.empty())
+    return false;
+
+  chunk.swap(m_buffer);
+  return true;
+}
+
+void CJSONRPCResponseStream::WriteElement(const CVariant& element)
+{
+  if (!m_empty)
+    m_buffer += ",";
+  if (!m_compact)
+    m_buffer += "\n\t\t\t";
+  m_buffer += Serialize(element, 3, m_compact);
+  m_empty = false;
+}
+
+bool CJSONRPCResponseStream::CanStreamArray()
+{
+  return currentCall != nullptr && currentCall->m_allowStreaming && !currentCall->m_generator;
+}
+
+bool CJSONRPCResponseStream::StreamArray(const std::string& name,
+                                         StreamedArrayGenerator generator)
+{
+  if (!CanStreamArray())
+    return false;
+
+  currentCall->m_arrayName = name;
+  currentCall->m_generator = std::move(generator);
+  return true;
+}
@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/Variant.h"
+
+#include <functional>
+#include <string>
+
+namespace JSONRPC
+{
+/*!
+ \brief Produces the elements of a streamed result array one after the other
+ \param element Set to the next element
+ \return false once there are no more elements
+ */
+using StreamedArrayGenerator = std::function<bool(CVariant& element)>;
+
+/*!
+ \ingroup jsonrpc
+ \brief JSON-RPC response which is serialised piece by piece while it is sent
+
+ A method may hand over one array member of its result as a generator instead of
+ filling it, see StreamArray(). The rest of the result is serialised as usual and
+ the elements of the array are only created and serialised while the transport
+ reads the response, so a long list never exists as a whole, neither as CVariant
+ nor as string.
+ */
+class CJSONRPCResponseStream
+{
+public:
+  /*!
+   \brief Response which has already been serialised as a whole
+   \param response Serialised response, empty if there is nothing to send
+   */
+  explicit CJSONRPCResponseStream(std::string response);
+
+  /*!
+   \brief Response whose result member \p arrayName is produced by \p generator
+   \param response Response without the streamed array member
+   */
+  CJSONRPCResponseStream(const CVariant& response,
+                         std::string arrayName,
+                         StreamedArrayGenerator generator,
+                         bool compact);
+
+  /*!
+   \brief Get the next part of the serialised response
+   \param chunk Set to the next part, never empty if true is returned
+   \return false once the whole response has been read
+   */
+  bool ReadChunk(std::string& chunk);
+
+  /*!
+   \brief Whether the method executed on this thread may stream an array of its result
+   */
+  static bool CanStreamArray();
+
+  /*!
+   \brief Stream the member \p name of the result of the method executed on this thread
+
+   The generator is called after the method has returned, possibly on another thread,
+   so it has to own everything it needs. The member must not be set in the result.
+   \return false if streaming isn't possible, the array has to be filled then
+   */
+  static bool StreamArray(const std::string& name, StreamedArrayGenerator generator);
+
+  /*!
+   \brief Decides whether the methods called on this thread during its lifetime may stream an array
+   */
+  class CCallScope
+  {
+  public:
+    explicit CCallScope(bool allowStreaming);
+    ~CCallScope();
+    CCallScope(const CCallScope&) = delete;
+    CCallScope& operator=(const CCallScope&) = delete;
+
+    std::string m_arrayName;
+    StreamedArrayGenerator m_generator;
+
+  private:
+    friend class CJSONRPCResponseStream;
+    bool m_allowStreaming;
+    CCallScope* m_previous;
+  };
+
+private:
+  void WriteElement(const CVariant& element);
+
+  std::string m_buffer;
+  std::string m_tail;
+  StreamedArrayGenerator m_generator;
+  bool m_compact = true;
+  bool m_empty = true;
+};
+} // namespace JSONRPC
@@ -239,7 +239,7 @@ JSONRPC_STATUS CPVROperations::GetBroadcasts(const std::string& method,
     programFull.Add(std::make_shared<CFileItem>(tag));
   }
 
-  HandleFileItemList("broadcastid", false, "broadcasts", programFull, parameterObject, result,
+  StreamFileItemList("broadcastid", false, "broadcasts", programFull, parameterObject, result,
                      programFull.Size(), true);
 
   return OK;
@@ -592,7 +592,7 @@ JSONRPC_STATUS CPVROperations::GetRecordings(const std::string& method,
     recordingsList.Add(std::make_shared<CFileItem>(recording));
   }
 
-  HandleFileItemList("recordingid", true, "recordings", recordingsList, parameterObject, result,
+  StreamFileItemList("recordingid", true, "recordings", recordingsList, parameterObject, result,
                      true);
 
   return OK;
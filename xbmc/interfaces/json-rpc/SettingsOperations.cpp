@@ -8,10 +8,12 @@
 
 #include "SettingsOperations.h"
 
+#include "GUIInfoManager.h"
 #include "ServiceBroker.h"
 #include "addons/Addon.h"
 #include "addons/Skin.h"
 #include "addons/addoninfo/AddonInfo.h"
+#include "guilib/GUIComponent.h"
 #include "resources/LocalizeStrings.h"
 #include "resources/ResourcesComponent.h"
 #include "settings/SettingAddon.h"
@@ -919,5 +921,10 @@ JSONRPC_STATUS CSettingsOperations::SetSkinSettingValue(const std::string& metho
     return InvalidParams;
   }
 
+  CServiceBroker::GetGUI()
+      ->GetInfoManager()
+      .GetInfoProviders()
+      .GetSkinInfoProvider()
+      .OnSettingsChanged();
   return OK;
 }
@@ -78,7 +78,7 @@ JSONRPC_STATUS CVideoLibrary::GetMovies(const std::string &method, ITransportLay
     setID = 0;
 
   CFileItemList items;
-  if (!videodatabase.GetMoviesNav(videoUrl.ToString(), items, genreID, year, -1, -1, -1, -1, setID, -1, sorting, RequiresAdditionalDetails(MediaTypeMovie, parameterObject)))
+  if (!videodatabase.GetMoviesNav(videoUrl.ToString(), items, genreID, year, -1, -1, -1, -1, setID, -1, sorting, RequiresListDetails(MediaTypeMovie, parameterObject)))
     return InvalidParams;
 
   return HandleItems("movieid", "movies", items, parameterObject, result, false);
@@ -135,9 +135,11 @@ JSONRPC_STATUS CVideoLibrary::GetMovieSetDetails(const std::string &method, ITra
 
   // Get movies from the set
   CFileItemList items;
-  if (!videodatabase.GetMoviesNav("videodb://movies/titles/", items, -1, -1, -1, -1, -1, -1, id, -1, SortDescription(), RequiresAdditionalDetails(MediaTypeMovie, parameterObject["movies"])))
+  if (!videodatabase.GetMoviesNav("videodb://movies/titles/", items, -1, -1, -1, -1, -1, -1, id, -1, SortDescription(), RequiresListDetails(MediaTypeMovie, parameterObject["movies"])))
     return InternalError;
 
+  // the movies are nested in the set details and can't be streamed
+  CJSONRPCResponseStream::CCallScope noStreaming(false);
   return HandleItems("movieid", "movies", items, parameterObject["movies"], result["setdetails"], true);
 }
 
@@ -290,7 +292,7 @@ JSONRPC_STATUS CVideoLibrary::GetEpisodes(const std::string &method, ITransportL
   }
 
   CFileItemList items;
-  if (!videodatabase.GetEpisodesByWhere(videoUrl.ToString(), CDatabase::Filter(), items, false, sorting, RequiresAdditionalDetails(MediaTypeEpisode, parameterObject)))
+  if (!videodatabase.GetEpisodesByWhere(videoUrl.ToString(), CDatabase::Filter(), items, false, sorting, RequiresListDetails(MediaTypeEpisode, parameterObject)))
     return InvalidParams;
 
   return HandleItems("episodeid", "episodes", items, parameterObject, result, false);
@@ -393,7 +395,7 @@ JSONRPC_STATUS CVideoLibrary::GetRecentlyAddedMovies(const std::string &method,
     return InternalError;
 
   CFileItemList items;
-  if (!videodatabase.GetRecentlyAddedMoviesNav("videodb://recentlyaddedmovies/", items, 0, RequiresAdditionalDetails(MediaTypeMovie, parameterObject)))
+  if (!videodatabase.GetRecentlyAddedMoviesNav("videodb://recentlyaddedmovies/", items, 0, RequiresListDetails(MediaTypeMovie, parameterObject)))
     return InternalError;
 
   return HandleItems("movieid", "movies", items, parameterObject, result, true);
@@ -406,7 +408,7 @@ JSONRPC_STATUS CVideoLibrary::GetRecentlyAddedEpisodes(const std::string &method
     return InternalError;
 
   CFileItemList items;
-  if (!videodatabase.GetRecentlyAddedEpisodesNav("videodb://recentlyaddedepisodes/", items, 0, RequiresAdditionalDetails(MediaTypeEpisode, parameterObject)))
+  if (!videodatabase.GetRecentlyAddedEpisodesNav("videodb://recentlyaddedepisodes/", items, 0, RequiresListDetails(MediaTypeEpisode, parameterObject)))
     return InternalError;
 
   return HandleItems("episodeid", "episodes", items, parameterObject, result, true);
@@ -1123,6 +1125,30 @@ int CVideoLibrary::RequiresAdditionalDetails(const MediaType& mediaType, const C
   return GetDetailsFromJsonParameters(parameterObject);
 }
 
+int CVideoLibrary::RequiresListDetails(const MediaType& mediaType, const CVariant& parameterObject)
+{
+  int details = RequiresAdditionalDetails(mediaType, parameterObject);
+  if (mediaType != MediaTypeMovie && mediaType != MediaTypeEpisode)
+    return details;
+
+  // leave out the long columns of the rows unless they are asked for. Art is read from the art
+  // table, the scraped art urls are never returned.
+  details |= VideoDbSkipColumns;
+  const CVariant& properties = parameterObject["properties"];
+  for (CVariant::const_iterator_array itr = properties.begin_array(); itr != properties.end_array();
+       ++itr)
+  {
+    const std::string propertyValue = itr->asString();
+    if (propertyValue == "plot" || propertyValue == "plotoutline" || propertyValue == "tagline")
+      details &= ~VideoDbSkipPlot;
+    else if (propertyValue == "writer" || propertyValue == "director")
+      details &= ~VideoDbSkipCredits;
+    else if (propertyValue == "trailer")
+      details &= ~VideoDbSkipTrailer;
+  }
+  return details;
+}
+
 int CVideoLibrary::GetDetailsFromJsonParameters(const CVariant& parameterObject)
 {
   const CVariant& properties = parameterObject["properties"];
@@ -1152,7 +1178,7 @@ JSONRPC_STATUS CVideoLibrary::HandleItems(const char *idProperty, const char *re
   int size = items.Size();
   if (!limit && items.HasProperty("total") && items.GetProperty("total").asInteger() > size)
     size = (int)items.GetProperty("total").asInteger();
-  HandleFileItemList(idProperty, true, resultName, items, parameterObject, result, size, limit);
+  StreamFileItemList(idProperty, true, resultName, items, parameterObject, result, size, limit);
 
   return OK;
 }
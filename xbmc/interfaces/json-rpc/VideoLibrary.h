@@ -88,6 +88,10 @@ namespace JSONRPC
 
   private:
     static int RequiresAdditionalDetails(const MediaType& mediaType, const CVariant &parameterObject);
+    /*! \brief As RequiresAdditionalDetails(), for lists that may leave out columns which none of
+     the requested properties need, see VideoDbSkipColumns.
+     */
+    static int RequiresListDetails(const MediaType& mediaType, const CVariant& parameterObject);
     static JSONRPC_STATUS HandleItems(const char *idProperty, const char *resultName, CFileItemList &items, const CVariant &parameterObject, CVariant &result, bool limit = true);
     static JSONRPC_STATUS RemoveVideo(const CVariant &parameterObject);
     static void UpdateVideoTag(const CVariant& parameterObject,
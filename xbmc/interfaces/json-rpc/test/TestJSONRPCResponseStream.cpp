@@ -0,0 +1,120 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "interfaces/json-rpc/JSONRPCResponseStream.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <gtest/gtest.h>
+
+using namespace JSONRPC;
+
+namespace
+{
+CVariant Movie(int id)
+{
+  CVariant movie;
+  movie["movieid"] = id;
+  movie["label"] = "Movie \"" + std::to_string(id) + "\"";
+  movie["genre"].push_back("Drama");
+  movie["genre"].push_back("Crime");
+  return movie;
+}
+
+CVariant Response(int count)
+{
+  CVariant response;
+  response["id"] = 1;
+  response["jsonrpc"] = "2.0";
+  response["result"]["limits"]["start"] = 0;
+  response["result"]["limits"]["end"] = count;
+  response["result"]["limits"]["total"] = count;
+  return response;
+}
+
+std::string ReadAll(CJSONRPCResponseStream& stream, int& chunks)
+{
+  std::string output, chunk;
+  chunks = 0;
+  while (stream.ReadChunk(chunk))
+  {
+    EXPECT_FALSE(chunk.empty());
+    output += chunk;
+    chunks++;
+  }
+  return output;
+}
+} // namespace
+
+TEST(TestJSONRPCResponseStream, WholeResponse)
+{
+  int chunks;
+  CJSONRPCResponseStream response("{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":\"OK\"}");
+  EXPECT_EQ("{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":\"OK\"}", ReadAll(response, chunks));
+  EXPECT_EQ(1, chunks);
+
+  CJSONRPCResponseStream notification{std::string()};
+  EXPECT_EQ("", ReadAll(notification, chunks));
+  EXPECT_EQ(0, chunks);
+}
+
+TEST(TestJSONRPCResponseStream, SameAsWholeResponse)
+{
+  for (bool compact : {true, false})
+  {
+    for (int count : {0, 1, 5000})
+    {
+      CVariant expected = Response(count);
+      expected["result"]["movies"] = CVariant(CVariant::VariantTypeArray);
+      for (int i = 0; i < count; i++)
+        expected["result"]["movies"].push_back(Movie(i));
+      std::string expectedString;
+      ASSERT_TRUE(CJSONVariantWriter::Write(expected, expectedString, compact));
+
+      int next = 0;
+      CJSONRPCResponseStream stream(Response(count), "movies",
+                                    [&next, count](CVariant& element)
+                                    {
+                                      if (next == count)
+                                        return false;
+                                      element = Movie(next++);
+                                      return true;
+                                    },
+                                    compact);
+
+      int chunks;
+      EXPECT_EQ(expectedString, ReadAll(stream, chunks)) << compact << " " << count;
+      if (count > 1000)
+      {
+        EXPECT_LT(1, chunks);
+      }
+    }
+  }
+}
+
+TEST(TestJSONRPCResponseStream, CallScope)
+{
+  const auto generator = [](CVariant&) { return false; };
+  EXPECT_FALSE(CJSONRPCResponseStream::CanStreamArray());
+  EXPECT_FALSE(CJSONRPCResponseStream::StreamArray("items", generator));
+
+  CJSONRPCResponseStream::CCallScope scope(true);
+  {
+    // e.g. a batch call or a nested list
+    CJSONRPCResponseStream::CCallScope noStreaming(false);
+    EXPECT_FALSE(CJSONRPCResponseStream::StreamArray("items", generator));
+  }
+
+  EXPECT_TRUE(CJSONRPCResponseStream::StreamArray("items", generator));
+  EXPECT_EQ("items", scope.m_arrayName);
+  EXPECT_TRUE(scope.m_generator);
+
+  // only one array per call
+  EXPECT_FALSE(CJSONRPCResponseStream::CanStreamArray());
+  EXPECT_FALSE(CJSONRPCResponseStream::StreamArray("more", generator));
+}
@@ -39,7 +39,8 @@ size_t CJob::GetPendingCallbackCount() const
 class CJobManager::CJobWorker : private CThread
 {
 public:
-  explicit CJobWorker(CJobManager& manager) : CThread("JobWorker"), m_jobManager(manager)
+  CJobWorker(CJobManager& manager, size_t queue)
+    : CThread("JobWorker"), m_jobManager(manager), m_queue(queue)
   {
     Create(true); // start work immediately, and kill ourselves when we're done
   }
@@ -57,7 +58,7 @@ public:
     while (true)
     {
       // request an item from our manager (this call is blocking)
-      CJob* job{m_jobManager.GetNextJob()};
+      CJob* job{m_jobManager.GetNextJob(m_queue)};
       if (!job)
         break;
 
@@ -76,6 +77,7 @@ public:
 
 private:
   CJobManager& m_jobManager;
+  const size_t m_queue; //!< work queue this worker takes jobs from first
 };
 
 struct CJobManager::JobFinder
@@ -86,6 +88,15 @@ struct CJobManager::JobFinder
   const CJob* m_job{nullptr};
 };
 
+CJobManager::CJobManager()
+{
+  // one work queue per worker slot of regular priority jobs
+  const unsigned int queues = GetMaxWorkers(CJob::PRIORITY_HIGH);
+  m_queues.reserve(queues);
+  for (unsigned int i = 0; i < queues; ++i)
+    m_queues.emplace_back(std::make_unique<CWorkQueue>());
+}
+
 bool CJobManager::IsRunning() const
 {
   std::unique_lock lock(m_section);
@@ -104,31 +115,41 @@ void CJobManager::Restart()
 void CJobManager::CancelJobs()
 {
   std::unique_lock lock(m_section);
-  m_running = false;
+  {
+    // no job can be added after this
+    std::unique_lock addLock(m_addSection);
+    m_running = false;
+  }
 
   // clear any pending jobs
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
-       ++priority)
+  for (const auto& queue : m_queues)
+  {
+    std::unique_lock queueLock(queue->m_section);
+    for (auto& jobs : queue->m_jobs)
+    {
+      std::ranges::for_each(jobs,
+                            [](CWorkItem& wi)
+                            {
+                              for (auto* callback : wi.GetCallbacks())
+                                callback->OnJobAbort(wi.GetId(), wi.GetJob());
+                              wi.FreeJob();
+                            });
+      jobs.clear();
+    }
+  }
+
+  // cancel any callbacks on jobs still processing
   {
-    std::ranges::for_each(m_jobQueue[priority],
+    std::unique_lock processingLock(m_processingSection);
+    std::ranges::for_each(m_processing,
                           [](CWorkItem& wi)
                           {
                             for (auto* callback : wi.GetCallbacks())
                               callback->OnJobAbort(wi.GetId(), wi.GetJob());
-                            wi.FreeJob();
+                            wi.Cancel();
                           });
-    m_jobQueue[priority].clear();
   }
 
-  // cancel any callbacks on jobs still processing
-  std::ranges::for_each(m_processing,
-                        [](CWorkItem& wi)
-                        {
-                          for (auto* callback : wi.GetCallbacks())
-                            callback->OnJobAbort(wi.GetId(), wi.GetJob());
-                          wi.Cancel();
-                        });
-
   // tell our workers to finish
   while (!m_workers.empty())
   {
@@ -137,73 +158,96 @@ void CJobManager::CancelJobs()
     std::this_thread::yield(); // yield after setting the event to give the workers some time to die
     lock.lock();
   }
+
+  const Statistics stats = GetStatistics();
+  CLog::Log(LOGDEBUG,
+            "CJobManager::{} - {} jobs started, {} stolen, average queue wait {} us, max {} us",
+            __FUNCTION__, stats.jobsStarted, stats.jobsStolen,
+            stats.jobsStarted ? stats.totalWaitTime.count() / stats.jobsStarted : 0,
+            stats.maxWaitTime.count());
 }
 
 unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORITY priority)
 {
-  std::unique_lock lock(m_section);
-
-  if (!m_running)
+  unsigned int id;
   {
-    delete job;
-    return 0;
-  }
+    // only serialises adding jobs, workers keep taking jobs off the work queues meanwhile
+    std::unique_lock lock(m_addSection);
 
-  // Check if we have this job already in the queue - if so, add callback to existing job
-  auto it = std::ranges::find_if(m_jobQueue[priority],
-                                 [job](const CWorkItem& wi) { return wi.GetJob()->Equals(job); });
-  if (it != m_jobQueue[priority].end())
-  {
-    it->AddCallback(callback);
-    delete job;
-    return it->GetId();
-  }
+    if (!m_running)
+    {
+      delete job;
+      return 0;
+    }
 
-  // Check if an equal job is already processing - if so, add callback to it.
-  // Note: Jobs that have moved to completion phase (removed from m_processing)
-  // won't be found here, causing a new job to be created. This is intentional -
-  // the completing job's results are about to be delivered to existing callbacks.
-  auto procIt = std::ranges::find_if(m_processing, [job](const CWorkItem& wi)
-                                     { return wi.GetJob()->Equals(job); });
-  if (procIt != m_processing.end())
-  {
-    procIt->AddCallback(callback);
-    delete job;
-    return procIt->GetId();
-  }
+    // Check if we have this job already in the queue - if so, add callback to existing job
+    for (const auto& queue : m_queues)
+    {
+      std::unique_lock queueLock(queue->m_section);
+      auto& jobs = queue->m_jobs[priority];
+      auto it = std::ranges::find_if(jobs,
+                                     [job](const CWorkItem& wi) { return wi.GetJob()->Equals(job); });
+      if (it != jobs.end())
+      {
+        it->AddCallback(callback);
+        delete job;
+        return it->GetId();
+      }
+    }
 
-  // increment the job counter, ensuring 0 (invalid job) is never hit
-  m_jobCounter++;
-  if (m_jobCounter == 0)
-    m_jobCounter++;
+    // Check if an equal job is already processing - if so, add callback to it.
+    // Note: Jobs that have moved to completion phase (removed from m_processing)
+    // won't be found here, causing a new job to be created. This is intentional -
+    // the completing job's results are about to be delivered to existing callbacks.
+    {
+      std::unique_lock processingLock(m_processingSection);
+      auto procIt = std::ranges::find_if(m_processing, [job](const CWorkItem& wi)
+                                         { return wi.GetJob()->Equals(job); });
+      if (procIt != m_processing.end())
+      {
+        procIt->AddCallback(callback);
+        delete job;
+        return procIt->GetId();
+      }
+    }
 
-  // create a work item for this job
-  CWorkItem work(job, m_jobCounter, priority, callback);
-  m_jobQueue[priority].emplace_back(work);
+    // increment the job counter, ensuring 0 (invalid job) is never hit
+    id = ++m_jobCounter;
+    if (id == 0)
+      id = ++m_jobCounter;
+
+    // create a work item for this job, queues are filled round robin
+    CWorkQueue& queue = *m_queues[m_nextQueue++ % m_queues.size()];
+    std::unique_lock queueLock(queue.m_section);
+    queue.m_jobs[priority].emplace_back(job, id, priority, callback);
+  }
 
   StartWorkers(priority);
-  return work.GetId();
+  return id;
 }
 
 void CJobManager::CancelJob(unsigned int jobID)
 {
-  std::unique_lock lock(m_section);
-
   // check whether we have this job in the queue
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
-       ++priority)
+  for (const auto& queue : m_queues)
   {
-    const auto i = std::ranges::find_if(m_jobQueue[priority],
-                                        [jobID](const auto& wi) { return wi.GetId() == jobID; });
-    if (i != m_jobQueue[priority].cend())
+    std::unique_lock queueLock(queue->m_section);
+    for (auto& jobs : queue->m_jobs)
     {
-      CWorkItem item(std::move(*i));
-      m_jobQueue[priority].erase(i);
-      item.FreeJob();
-      return;
+      const auto i =
+          std::ranges::find_if(jobs, [jobID](const auto& wi) { return wi.GetId() == jobID; });
+      if (i != jobs.cend())
+      {
+        CWorkItem item(std::move(*i));
+        jobs.erase(i);
+        item.FreeJob();
+        return;
+      }
     }
   }
+
   // or if we're processing it
+  std::unique_lock processingLock(m_processingSection);
   const auto it =
       std::ranges::find_if(m_processing, [jobID](const auto& wi) { return wi.GetId() == jobID; });
   if (it != m_processing.cend())
@@ -212,48 +256,102 @@ void CJobManager::CancelJob(unsigned int jobID)
 
 void CJobManager::StartWorkers(CJob::PRIORITY priority)
 {
-  std::unique_lock lock(m_section);
-
   // check how many free threads we have
-  if (m_processing.size() >= GetMaxWorkers(priority))
+  if (m_processingCount >= GetMaxWorkers(priority))
     return;
 
   // do we have any sleeping threads?
-  if (m_processing.size() < m_workers.size())
+  if (m_processingCount < m_workerCount)
   {
     m_jobEvent.Set();
     return;
   }
 
   // everyone is busy - we need more workers
-  m_workers.emplace_back(new CJobWorker(*this));
+  std::unique_lock lock(m_section);
+  if (m_processingCount < m_workers.size())
+  {
+    m_jobEvent.Set();
+    return;
+  }
+  m_workers.emplace_back(new CJobWorker(*this, m_workerCounter++ % m_queues.size()));
+  m_workerCount = m_workers.size();
 }
 
-CJob* CJobManager::PopJob()
+CJob* CJobManager::PopJob(size_t queueIndex)
 {
-  std::unique_lock lock(m_section);
   for (int priority = CJob::PRIORITY_DEDICATED; priority >= CJob::PRIORITY_LOW_PAUSABLE; --priority)
   {
     // Check whether we're pausing pausable jobs
     if (priority == CJob::PRIORITY_LOW_PAUSABLE && m_pauseJobs)
       continue;
 
-    if (!m_jobQueue[priority].empty() &&
-        m_processing.size() < GetMaxWorkers(CJob::PRIORITY(priority)))
+    // own queue first, then steal from the others
+    for (size_t i = 0; i < m_queues.size(); ++i)
     {
-      // pop the job off the queue
-      const CWorkItem job{m_jobQueue[priority].front()};
-      m_jobQueue[priority].pop_front();
-
-      // add to the processing vector
-      m_processing.emplace_back(job);
-      job.GetJob()->SetProgressCallback(this);
-      return job.GetJob();
+      CWorkQueue& queue = *m_queues[(queueIndex + i) % m_queues.size()];
+      std::unique_lock queueLock(queue.m_section);
+
+      auto& jobs = queue.m_jobs[priority];
+      if (jobs.empty())
+        continue;
+
+      // lower priorities are limited to even less workers
+      if (!ReserveWorker(CJob::PRIORITY(priority)))
+        return nullptr;
+
+      // pop the job off the queue and add it to the processing ones, without a window in which
+      // AddJob() could miss it
+      std::unique_lock processingLock(m_processingSection);
+      const CWorkItem& item = m_processing.emplace_back(std::move(jobs.front()));
+      jobs.pop_front();
+      UpdateStatistics(item, i != 0);
+      item.GetJob()->SetProgressCallback(this);
+      return item.GetJob();
     }
   }
   return nullptr;
 }
 
+bool CJobManager::ReserveWorker(CJob::PRIORITY priority)
+{
+  const unsigned int maxWorkers = GetMaxWorkers(priority);
+  unsigned int count = m_processingCount;
+  do
+  {
+    if (count >= maxWorkers)
+      return false;
+  } while (!m_processingCount.compare_exchange_weak(count, count + 1));
+
+  return true;
+}
+
+void CJobManager::UpdateStatistics(const CWorkItem& item, bool stolen)
+{
+  const int64_t wait = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - item.GetQueueTime())
+                           .count();
+
+  m_jobsStarted++;
+  if (stolen)
+    m_jobsStolen++;
+  m_totalWaitUs += wait;
+
+  int64_t maxWait = m_maxWaitUs;
+  while (wait > maxWait && !m_maxWaitUs.compare_exchange_weak(maxWait, wait))
+    ;
+}
+
+CJobManager::Statistics CJobManager::GetStatistics() const
+{
+  Statistics stats;
+  stats.jobsStarted = m_jobsStarted;
+  stats.jobsStolen = m_jobsStolen;
+  stats.totalWaitTime = std::chrono::microseconds(m_totalWaitUs);
+  stats.maxWaitTime = std::chrono::microseconds(m_maxWaitUs);
+  return stats;
+}
+
 void CJobManager::PauseJobs()
 {
   std::unique_lock lock(m_section);
@@ -268,64 +366,58 @@ void CJobManager::UnPauseJobs()
 
 bool CJobManager::IsProcessing(const CJob::PRIORITY& priority) const
 {
-  std::unique_lock lock(m_section);
-
   if (m_pauseJobs && priority == CJob::PRIORITY::PRIORITY_LOW_PAUSABLE)
     return false;
 
-  return std::ranges::any_of(m_processing,
-                             [priority](const auto& wi) { return wi.GetPriority() == priority; });
+  std::unique_lock lock(m_processingSection);
+  return std::ranges::any_of(m_processing, [priority](const CWorkItem& wi)
+                             { return priority == wi.GetPriority(); });
 }
 
 int CJobManager::IsProcessing(const std::string& type) const
 {
-  std::unique_lock lock(m_section);
-
+  std::unique_lock lock(m_processingSection);
   return static_cast<int>(std::ranges::count_if(
       m_processing,
-      [this, &type](const auto& wi)
+      [this, &type](const CWorkItem& wi)
       {
-        return (!m_pauseJobs || wi.GetPriority() != CJob::PRIORITY::PRIORITY_LOW_PAUSABLE) &&
-               (std::string(wi.GetJob()->GetType()) == type);
+        if (m_pauseJobs && wi.GetPriority() == CJob::PRIORITY::PRIORITY_LOW_PAUSABLE)
+          return false;
+        return std::string(wi.GetJob()->GetType()) == type;
       }));
 }
 
-CJob* CJobManager::GetNextJob()
+CJob* CJobManager::GetNextJob(size_t queue)
 {
-  std::unique_lock lock(m_section);
   while (m_running)
   {
-    // grab a job off the queue if we have one
-    CJob* job = PopJob();
+    // grab a job off the queues if we have one
+    CJob* job = PopJob(queue);
     if (job)
       return job;
     // no jobs are left - sleep for 30 seconds to allow new jobs to come in
-    lock.unlock();
-    bool newJob = m_jobEvent.Wait(30000ms);
-    lock.lock();
-    if (!newJob)
+    if (!m_jobEvent.Wait(30000ms))
       break;
   }
-  // ensure no jobs have come in during the period after
-  // timeout and before we held the lock
-  return PopJob();
+  // ensure no jobs have come in during the period after the timeout
+  return PopJob(queue);
 }
 
 bool CJobManager::OnJobProgress(unsigned int progress, unsigned int total, const CJob* job) const
 {
-  std::unique_lock lock(m_section);
+  std::unique_lock lock(m_processingSection);
   // find the job in the processing queue, and check whether it's cancelled (no callbacks)
   const auto i = std::ranges::find_if(m_processing, JobFinder(job));
   if (i != m_processing.cend())
   {
     CWorkItem item(*i);
     lock.unlock(); // leave section prior to call
-    if (!item.GetCallbacks().empty())
-    {
-      for (auto* callback : item.GetCallbacks())
-        callback->OnJobProgress(item.GetId(), progress, total, job);
-      return false;
-    }
+    if (item.GetCallbacks().empty())
+      return true;
+
+    for (auto* callback : item.GetCallbacks())
+      callback->OnJobProgress(item.GetId(), progress, total, job);
+    return false;
   }
   return true; // couldn't find the job, or it's been cancelled
 }
@@ -334,8 +426,8 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
 {
   std::optional<CWorkItem> item = [&, this]
   {
-    std::unique_lock lock(m_section);
     std::optional<CWorkItem> item;
+    std::unique_lock lock(m_processingSection);
     auto i = std::ranges::find_if(m_processing, JobFinder(job));
     if (i != m_processing.end())
     {
@@ -343,6 +435,7 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
       // when another thread modifies m_processing during callback execution
       item.emplace(std::move(*i));
       m_processing.erase(i);
+      m_processingCount--;
     }
     return item;
   }();
@@ -402,6 +495,7 @@ void CJobManager::RemoveWorker(const CJobWorker* worker)
   const auto i = std::ranges::find(m_workers, worker);
   if (i != m_workers.cend())
     m_workers.erase(i); // workers auto-delete
+  m_workerCount = m_workers.size();
 }
 
 unsigned int CJobManager::GetMaxWorkers(CJob::PRIORITY priority)
@@ -16,6 +16,8 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <memory>
 #include <queue>
 #include <string>
 #include <unordered_map>
@@ -32,12 +34,29 @@ class IJobCallback;
  on priority levels.  Lower priority jobs are executed only if there are sufficient
  spare worker threads free to allow for higher priority jobs that may arise.
 
+ Queued jobs are distributed round robin over a set of work queues, one per regular worker slot,
+ each with its own lock and priority bands. A worker takes jobs from its own queue and steals
+ from the other queues when its own queue has no job of the highest available priority, so
+ workers only contend on a queue when they run out of their own work. Within a work queue, jobs
+ of a priority are started in the order they were added.
+
  \sa CJob and IJobCallback
  */
 class CJobManager final
 {
 public:
-  CJobManager() = default;
+  CJobManager();
+
+  /*!
+   \brief Scheduler counters, accumulated since construction.
+   */
+  struct Statistics
+  {
+    uint64_t jobsStarted{0}; //!< jobs taken off the work queues by workers
+    uint64_t jobsStolen{0}; //!< jobs taken from a work queue other than the worker's own one
+    std::chrono::microseconds totalWaitTime{0}; //!< summed time jobs spent queued
+    std::chrono::microseconds maxWaitTime{0}; //!< longest time a job spent queued
+  };
 
   /*!
    \brief Returns whether the job manager is currently running.
@@ -158,9 +177,10 @@ public:
 
   /*!
    \brief Get a new job to process. Blocks until a new job is available, or a timeout has occurred.
+   \param queue the work queue to take jobs from first, before stealing from the other queues.
    \sa CJob
    */
-  CJob* GetNextJob();
+  CJob* GetNextJob(size_t queue);
 
   /*!
    \brief Get the number of pending callbacks for a job during completion.
@@ -170,6 +190,12 @@ public:
    */
   size_t GetPendingCallbackCount(const CJob* job) const;
 
+  /*!
+   \brief Get the scheduler counters, e.g. to judge queue wait times and how often workers steal jobs.
+   \return the counters accumulated since construction.
+   */
+  Statistics GetStatistics() const;
+
 private:
   CJobManager(const CJobManager&) = delete;
   CJobManager const& operator=(CJobManager const&) = delete;
@@ -183,7 +209,8 @@ private:
     CWorkItem(CJob* job, unsigned int id, CJob::PRIORITY priority, IJobCallback* callback)
       : m_job(job),
         m_id(id),
-        m_priority(priority)
+        m_priority(priority),
+        m_queued(std::chrono::steady_clock::now())
     {
       if (callback)
         m_callbacks.push_back(callback);
@@ -213,37 +240,63 @@ private:
       return callback;
     }
     CJob::PRIORITY GetPriority() const { return m_priority; }
+    std::chrono::steady_clock::time_point GetQueueTime() const { return m_queued; }
 
   private:
     CJob* m_job{nullptr};
     unsigned int m_id{0};
     std::vector<IJobCallback*> m_callbacks;
     CJob::PRIORITY m_priority{CJob::PRIORITY::PRIORITY_LOW};
+    std::chrono::steady_clock::time_point m_queued;
   };
 
-  /*! \brief Pop a job off the job queue and add to the processing queue ready to process
+  using Processing = std::vector<CWorkItem>;
+  using Workers = std::vector<CJobWorker*>;
+
+  /*!
+   \brief Work queue of a worker slot, guarded by its own lock.
+   Lock order is m_addSection, then CWorkQueue::m_section, then m_processingSection. No more than
+   one CWorkQueue::m_section is held at a time.
+   */
+  struct CWorkQueue
+  {
+    CCriticalSection m_section;
+    std::array<std::deque<CWorkItem>, CJob::PRIORITY_DEDICATED + 1> m_jobs;
+  };
+
+  /*! \brief Pop a job off the work queues and add to the processing queue ready to process
+   \param queue the work queue to take jobs from first
    \return the job to process, nullptr if no jobs are available
    */
-  CJob* PopJob();
+  CJob* PopJob(size_t queue);
 
+  bool ReserveWorker(CJob::PRIORITY priority);
+  void UpdateStatistics(const CWorkItem& item, bool stolen);
   void StartWorkers(CJob::PRIORITY priority);
   void RemoveWorker(const CJobWorker* worker);
   static unsigned int GetMaxWorkers(CJob::PRIORITY priority);
 
-  unsigned int m_jobCounter{0};
+  std::atomic<unsigned int> m_jobCounter{0};
 
-  using JobQueue = std::deque<CWorkItem>;
-  using Processing = std::vector<CWorkItem>;
-  using Workers = std::vector<CJobWorker*>;
-
-  std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1> m_jobQueue;
-  bool m_pauseJobs{false};
+  std::vector<std::unique_ptr<CWorkQueue>> m_queues;
+  std::atomic<size_t> m_nextQueue{0};
+  size_t m_workerCounter{0};
+  std::atomic<bool> m_pauseJobs{false};
+  std::atomic<unsigned int> m_processingCount{0}; //!< processing jobs of all priorities
   Processing m_processing;
   Workers m_workers;
+  std::atomic<size_t> m_workerCount{0}; //!< size of m_workers, to read it without m_section
 
   mutable CCriticalSection m_section;
+  CCriticalSection m_addSection; //!< makes the duplicate check and queueing of a job atomic
+  mutable CCriticalSection m_processingSection; //!< guards m_processing
   CEvent m_jobEvent;
-  bool m_running{true};
+  std::atomic<bool> m_running{true};
+
+  std::atomic<uint64_t> m_jobsStarted{0};
+  std::atomic<uint64_t> m_jobsStolen{0};
+  std::atomic<int64_t> m_totalWaitUs{0};
+  std::atomic<int64_t> m_maxWaitUs{0};
 
   // Tracks pending callback count for jobs in completion phase, used by CJob::IsShared()
   std::unordered_map<const CJob*, std::atomic<size_t>> m_pendingCallbacks;
@@ -70,12 +70,9 @@ void CJobQueue::CancelJob(const CJob* job)
 
 bool CJobQueue::AddJob(CJob* job)
 {
-  const auto jobMatcher = [job](const CJobPointer& jobPtr) { return jobPtr.GetJob()->Equals(job); };
-
   std::unique_lock lock(m_section);
   // check if we have this job already.  If so, we're done.
-  if (std::ranges::find_if(m_jobQueue, jobMatcher) != m_jobQueue.cend() ||
-      std::ranges::find_if(m_processing, jobMatcher) != m_processing.cend())
+  if (HasJob(job))
   {
     delete job;
     return false;
@@ -104,6 +101,15 @@ void CJobQueue::OnJobNotify(const CJob* job)
   QueueNextJob();
 }
 
+bool CJobQueue::HasJob(const CJob* job) const
+{
+  const auto jobMatcher = [job](const CJobPointer& jobPtr) { return jobPtr.GetJob()->Equals(job); };
+
+  std::unique_lock lock(m_section);
+  return std::ranges::find_if(m_jobQueue, jobMatcher) != m_jobQueue.cend() ||
+         std::ranges::find_if(m_processing, jobMatcher) != m_processing.cend();
+}
+
 void CJobQueue::QueueNextJob()
 {
   std::unique_lock lock(m_section);
@@ -92,6 +92,12 @@ public:
    */
   bool IsProcessing() const;
 
+  /*!
+   \brief Check whether an equal job is queued or being processed
+   \param job the job to compare with, see CJob::Equals
+   */
+  bool HasJob(const CJob* job) const;
+
   /*!
    \brief The callback used when a job completes.
 
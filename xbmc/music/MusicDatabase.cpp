@@ -722,7 +722,10 @@ void CMusicDatabase::SplitPath(const std::string& strFileNameAndPath,
 
 bool CMusicDatabase::AddAlbum(CAlbum& album, int idSource)
 {
-  BeginTransaction();
+  // the scanner adds albums in batches within its own transaction
+  const bool ownTransaction = !InTransaction();
+  if (ownTransaction)
+    BeginTransaction();
   SetLibraryLastUpdated();
 
   album.idAlbum = AddAlbum(album.strAlbum, //
@@ -902,7 +905,8 @@ bool CMusicDatabase::AddAlbum(CAlbum& album, int idSource)
                       albumdateadded.c_str(), strIDs.c_str(), albumdateadded.c_str());
   m_pDS->exec(strSQL);
 
-  CommitTransaction();
+  if (ownTransaction)
+    CommitTransaction();
   return true;
 }
 
@@ -5675,8 +5679,7 @@ bool CMusicDatabase::GetArtistsByWhere(const std::string& strBaseDir,
       total = iRowsFound;
     items.SetProperty("total", total);
 
-    DatabaseResults results;
-    results.reserve(iRowsFound);
+    CDatabaseResultColumns results;
     // Populate results field vector from dataset
     FieldList fields;
     if (!DatabaseUtils::GetDatabaseResults(MediaTypeArtist, fields, *m_pDS, results))
@@ -5686,12 +5689,12 @@ bool CMusicDatabase::GetArtistsByWhere(const std::string& strBaseDir,
     items.SetSortOrder(sortDescription.sortOrder);
 
     // Get Artists from returned rows
-    items.Reserve(results.size());
-    const dbiplus::query_data& data = m_pDS->get_result_set().records;
-    for (const auto& i : results)
+    items.Reserve(results.Size());
+    for (const unsigned int targetRow : results.GetRows())
     {
-      const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_sql_record(targetRow);
+      if (!record)
+        continue;
 
       try
       {
@@ -5908,8 +5911,7 @@ bool CMusicDatabase::GetAlbumsByWhere(const std::string& baseDir,
       total = iRowsFound;
     items.SetProperty("total", total);
 
-    DatabaseResults results;
-    results.reserve(iRowsFound);
+    CDatabaseResultColumns results;
     // Populate results field vector from dataset
     FieldList fields;
     if (!DatabaseUtils::GetDatabaseResults(MediaTypeAlbum, fields, *m_pDS, results))
@@ -5919,12 +5921,12 @@ bool CMusicDatabase::GetAlbumsByWhere(const std::string& baseDir,
     items.SetSortOrder(sorting.sortOrder);
 
     // Get albums from returned rows
-    items.Reserve(results.size());
-    const dbiplus::query_data& data = m_pDS->get_result_set().records;
-    for (const auto& i : results)
+    items.Reserve(results.Size());
+    for (const unsigned int targetRow : results.GetRows())
     {
-      const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_sql_record(targetRow);
+      if (!record)
+        continue;
 
       try
       {
@@ -6085,8 +6087,7 @@ bool CMusicDatabase::GetDiscsByWhere(CMusicDbUrl& musicUrl,
       total = iRowsFound;
     items.SetProperty("total", total);
 
-    DatabaseResults results;
-    results.reserve(iRowsFound);
+    CDatabaseResultColumns results;
 
     // Avoid sorting with limits, just fetch results from dataset
     // Limit when SortBy::NONE already applied in SQL,
@@ -6102,11 +6103,11 @@ bool CMusicDatabase::GetDiscsByWhere(CMusicDbUrl& musicUrl,
     CAlbum album;
     bool useTitle = true; // Assume we want to match by disc title later unless we have no titles
     std::string oldDiscTitle;
-    const dbiplus::query_data& data = m_pDS->get_result_set().records;
-    for (const auto& i : results)
+    for (const unsigned int targetRow : results.GetRows())
     {
-      const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_sql_record(targetRow);
+      if (!record)
+        continue;
       try
       {
         if (album.idAlbum != record->at(albumOffset + album_idAlbum).get_asInt())
@@ -6341,8 +6342,7 @@ bool CMusicDatabase::GetSongsFullByWhere(const std::string& baseDir,
     // Store the total number of songs as a property
     items.SetProperty("total", total);
 
-    DatabaseResults results;
-    results.reserve(iRowsFound);
+    CDatabaseResultColumns results;
     // Populate results field vector from dataset
     FieldList fields;
     if (!DatabaseUtils::GetDatabaseResults(MediaTypeSong, fields, *m_pDS, results))
@@ -6356,12 +6356,12 @@ bool CMusicDatabase::GetSongsFullByWhere(const std::string& baseDir,
     int songArtistOffset = song_enumCount;
     int songId = -1;
     std::vector<CArtistCredit> artistCredits;
-    const dbiplus::query_data& data = m_pDS->get_result_set().records;
     int count = 0;
-    for (const auto& i : results)
+    for (const unsigned int targetRow : results.GetRows())
     {
-      const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_sql_record(targetRow);
+      if (!record)
+        continue;
 
       try
       {
@@ -8051,7 +8051,8 @@ bool CMusicDatabase::GetSongsByWhereJSON(
     // Run query
     auto start = std::chrono::steady_clock::now();
 
-    if (!m_pDS->query(strSQL))
+    // The rows are read once in order, so use a cursor rather than copy them all into m_pDS
+    if (!m_pDS->query_cursor(strSQL, {}))
       return false;
 
     auto end = std::chrono::steady_clock::now();
@@ -8059,8 +8060,8 @@ bool CMusicDatabase::GetSongsByWhereJSON(
 
     CLog::LogF(LOGDEBUG, "query took {} ms", duration.count());
 
-    int iRowsFound = m_pDS->num_rows();
-    if (iRowsFound <= 0)
+    bool bHaveRow = m_pDS->step();
+    if (!bHaveRow)
     {
       m_pDS->close();
       return true;
@@ -8076,11 +8077,9 @@ bool CMusicDatabase::GetSongsByWhereJSON(
     bool bHaveSong(false);
     CVariant songObj;
     result["songs"].reserve(resultcount);
-    while (!m_pDS->eof() || bHaveSong)
+    while (bHaveRow || bHaveSong)
     {
-      const dbiplus::sql_record* const record = m_pDS->get_sql_record();
-
-      if (m_pDS->eof() || songId != record->at(0).get_asInt())
+      if (!bHaveRow || songId != m_pDS->column_int(0))
       {
         // Store previous or last song
         if (bHaveSong)
@@ -8131,34 +8130,34 @@ bool CMusicDatabase::GetSongsByWhereJSON(
           bSongGenreDone = false;
           bSongArtistDone = false;
         }
-        if (m_pDS->eof())
+        if (!bHaveRow)
           continue; // Having saved the last song stop
 
         // New song
-        songId = record->at(0).get_asInt();
+        songId = m_pDS->column_int(0);
         bHaveSong = true;
         songObj["songid"] = songId;
-        songObj["label"] = record->at(1).get_asString();
+        songObj["label"] = std::string(m_pDS->column_text(1));
         for (size_t i = 0; i < dbfieldindex.size(); i++)
           if (dbfieldindex[i] > -1)
           {
             if (JSONtoDBSong[dbfieldindex[i]].formatJSON == "integer")
-              songObj[JSONtoDBSong[dbfieldindex[i]].fieldJSON] = record->at(1 + i).get_asInt();
+              songObj[JSONtoDBSong[dbfieldindex[i]].fieldJSON] = m_pDS->column_int(1 + i);
             else if (JSONtoDBSong[dbfieldindex[i]].formatJSON == "unsigned")
               songObj[JSONtoDBSong[dbfieldindex[i]].fieldJSON] =
-                  std::max(record->at(1 + i).get_asInt(), 0);
+                  std::max(m_pDS->column_int(1 + i), 0);
             else if (JSONtoDBSong[dbfieldindex[i]].formatJSON == "float")
               songObj[JSONtoDBSong[dbfieldindex[i]].fieldJSON] =
-                  std::max(record->at(1 + i).get_asFloat(), 0.f);
+                  std::max(static_cast<float>(m_pDS->column_double(1 + i)), 0.f);
             else if (JSONtoDBSong[dbfieldindex[i]].formatJSON == "array")
               songObj[JSONtoDBSong[dbfieldindex[i]].fieldJSON] = StringUtils::Split(
-                  record->at(1 + i).get_asString(), CServiceBroker::GetSettingsComponent()
-                                                        ->GetAdvancedSettings()
-                                                        ->m_musicItemSeparator);
+                  std::string(m_pDS->column_text(1 + i)),
+                  CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_musicItemSeparator);
             else if (JSONtoDBSong[dbfieldindex[i]].formatJSON == "boolean")
-              songObj[JSONtoDBSong[dbfieldindex[i]].fieldJSON] = record->at(1 + i).get_asBool();
+              songObj[JSONtoDBSong[dbfieldindex[i]].fieldJSON] = m_pDS->column_bool(1 + i);
             else
-              songObj[JSONtoDBSong[dbfieldindex[i]].fieldJSON] = record->at(1 + i).get_asString();
+              songObj[JSONtoDBSong[dbfieldindex[i]].fieldJSON] =
+                  std::string(m_pDS->column_text(1 + i));
           }
 
         // Split sources string into int array
@@ -8174,13 +8173,13 @@ bool CMusicDatabase::GetSongsByWhereJSON(
 
       if (bJoinAlbumArtist)
       {
-        if (albumartistId != record->at(joinLayout.GetRecNo(joinToSongs_idAlbumArtist)).get_asInt())
+        if (albumartistId != m_pDS->column_int(joinLayout.GetRecNo(joinToSongs_idAlbumArtist)))
         {
           bSongGenreDone =
               bSongGenreDone || (albumartistId > 0); // Not first album artist, skip genre
           bSongArtistDone =
               bSongArtistDone || (albumartistId > 0); // Not first album artist, skip song artists
-          albumartistId = record->at(joinLayout.GetRecNo(joinToSongs_idAlbumArtist)).get_asInt();
+          albumartistId = m_pDS->column_int(joinLayout.GetRecNo(joinToSongs_idAlbumArtist));
           if (joinLayout.GetOutput(joinToSongs_idAlbumArtist))
             songObj["albumartistid"].append(albumartistId);
           if (albumartistId == BLANKARTIST_ID)
@@ -8196,22 +8195,23 @@ bool CMusicDatabase::GetSongsByWhereJSON(
               songObj["albumartistid"].append(albumartistId);
             if (joinLayout.GetOutput(joinToSongs_strAlbumArtist))
               songObj["albumartist"].append(
-                  record->at(joinLayout.GetRecNo(joinToSongs_strAlbumArtist)).get_asString());
+                  std::string(m_pDS->column_text(joinLayout.GetRecNo(joinToSongs_strAlbumArtist))));
             if (joinLayout.GetOutput(joinToSongs_strAlbumArtistMBID))
               songObj["musicbrainzalbumartistid"].append(
-                  record->at(joinLayout.GetRecNo(joinToSongs_strAlbumArtistMBID)).get_asString());
+                  std::string(m_pDS->column_text(
+                      joinLayout.GetRecNo(joinToSongs_strAlbumArtistMBID))));
           }
         }
       }
       if (bJoinSongArtist && !bSongArtistDone)
       {
-        if (artistId != record->at(joinLayout.GetRecNo(joinToSongs_idArtist)).get_asInt())
+        if (artistId != m_pDS->column_int(joinLayout.GetRecNo(joinToSongs_idArtist)))
         {
           bSongGenreDone = bSongGenreDone || (artistId > 0); // Not first artist, skip genre
           roleId = -1; // Allow for many artists same role
-          artistId = record->at(joinLayout.GetRecNo(joinToSongs_idArtist)).get_asInt();
+          artistId = m_pDS->column_int(joinLayout.GetRecNo(joinToSongs_idArtist));
           if (joinLayout.GetRecNo(joinToSongs_idRole) < 0 ||
-              record->at(joinLayout.GetRecNo(joinToSongs_idRole)).get_asInt() == 1)
+              m_pDS->column_int(joinLayout.GetRecNo(joinToSongs_idRole)) == 1)
           {
             if (joinLayout.GetOutput(joinToSongs_idArtist))
               songObj["artistid"].append(artistId);
@@ -8226,30 +8226,31 @@ bool CMusicDatabase::GetSongsByWhereJSON(
             {
               if (joinLayout.GetOutput(joinToSongs_strArtist))
                 songObj["artist"].append(
-                    record->at(joinLayout.GetRecNo(joinToSongs_strArtist)).get_asString());
+                    std::string(m_pDS->column_text(joinLayout.GetRecNo(joinToSongs_strArtist))));
               if (joinLayout.GetOutput(joinToSongs_strArtistMBID))
                 songObj["musicbrainzartistid"].append(
-                    record->at(joinLayout.GetRecNo(joinToSongs_strArtistMBID)).get_asString());
+                    std::string(m_pDS->column_text(
+                        joinLayout.GetRecNo(joinToSongs_strArtistMBID))));
             }
           }
         }
         if (joinLayout.GetRecNo(joinToSongs_idRole) > 0 &&
-            roleId != record->at(joinLayout.GetRecNo(joinToSongs_idRole)).get_asInt())
+            roleId != m_pDS->column_int(joinLayout.GetRecNo(joinToSongs_idRole)))
         {
           bSongGenreDone = bSongGenreDone || (roleId > 0); // Not first role, skip genre
-          roleId = record->at(joinLayout.GetRecNo(joinToSongs_idRole)).get_asInt();
+          roleId = m_pDS->column_int(joinLayout.GetRecNo(joinToSongs_idRole));
           if (roleId > 1)
           {
             if (bJoinRole)
             { //Contributors
               CVariant contributor;
               contributor["name"] =
-                  record->at(joinLayout.GetRecNo(joinToSongs_strArtist)).get_asString();
+                  std::string(m_pDS->column_text(joinLayout.GetRecNo(joinToSongs_strArtist)));
               contributor["role"] =
-                  record->at(joinLayout.GetRecNo(joinToSongs_strRole)).get_asString();
+                  std::string(m_pDS->column_text(joinLayout.GetRecNo(joinToSongs_strRole)));
               contributor["roleid"] = roleId;
               contributor["artistid"] =
-                  record->at(joinLayout.GetRecNo(joinToSongs_idArtist)).get_asInt();
+                  m_pDS->column_int(joinLayout.GetRecNo(joinToSongs_idArtist));
               songObj["contributors"].append(contributor);
             }
             // "displaycomposer", "displayconductor" etc.
@@ -8258,7 +8259,7 @@ bool CMusicDatabase::GetSongsByWhereJSON(
               if (roleidlist[i] == roleId)
               {
                 songObj[rolefieldlist[i]].append(
-                    record->at(joinLayout.GetRecNo(joinToSongs_strArtist)).get_asString());
+                    std::string(m_pDS->column_text(joinLayout.GetRecNo(joinToSongs_strArtist))));
                 continue;
               }
             }
@@ -8266,11 +8267,11 @@ bool CMusicDatabase::GetSongsByWhereJSON(
         }
       }
       if (!bSongGenreDone && joinLayout.GetRecNo(joinToSongs_idGenre) > -1 &&
-          !record->at(joinLayout.GetRecNo(joinToSongs_idGenre)).get_isNull())
+          !m_pDS->column_is_null(joinLayout.GetRecNo(joinToSongs_idGenre)))
       {
-        songObj["genreid"].append(record->at(joinLayout.GetRecNo(joinToSongs_idGenre)).get_asInt());
+        songObj["genreid"].append(m_pDS->column_int(joinLayout.GetRecNo(joinToSongs_idGenre)));
       }
-      m_pDS->next();
+      bHaveRow = m_pDS->step();
     }
     m_pDS->close(); // cleanup recordset data
 
@@ -259,6 +259,7 @@ public:
   // Album
   /////////////////////////////////////////////////
   /*! \brief Add an album and all its songs to the database
+  The album is added in its own transaction unless a transaction is already in progress.
   \param album the album to add
   \param idSource the music source id
   \return the id of the album
@@ -38,6 +38,7 @@
 #include "guilib/GUIWindowManager.h"
 #include "imagefiles/ImageFileURL.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobManager.h"
 #include "music/MusicFileItemClassify.h"
 #include "music/MusicLibraryQueue.h"
 #include "music/MusicThumbLoader.h"
@@ -50,6 +51,7 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/Event.h"
 #include "utils/Digest.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/FileUtils.h"
@@ -59,6 +61,8 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <string_view>
 #include <utility>
 
@@ -70,6 +74,15 @@ using namespace MUSIC_GRABBER;
 using namespace ADDON;
 using KODI::UTILITY::CDigest;
 
+using namespace std::chrono_literals;
+
+namespace
+{
+// limits of a batch of albums added in one transaction
+constexpr int ALBUM_BATCH_SIZE = 500;
+constexpr auto ALBUM_BATCH_DURATION = 5s;
+} // namespace
+
 CMusicInfoScanner::CMusicInfoScanner()
 : m_fileCountReader(this, "MusicFileCounter")
 {
@@ -151,6 +164,7 @@ void CMusicInfoScanner::Process()
         // Clear list of albums added by this scan
         m_albumsAdded.clear();
         bool scancomplete = DoScan(it);
+        CommitAlbumBatch();
         if (scancomplete)
         {
           if (!m_albumsAdded.empty())
@@ -280,6 +294,9 @@ void CMusicInfoScanner::Process()
   catch (...)
   {
     CLog::Log(LOGERROR, "MusicInfoScanner: Exception while scanning.");
+    // path hashes are part of the batch, so the rolled back folders are scanned again next time
+    if (m_musicDatabase.InTransaction())
+      m_musicDatabase.RollbackTransaction();
   }
   m_musicDatabase.Close();
   CLog::Log(LOGDEBUG, "{} - Finished scan", __FUNCTION__);
@@ -503,6 +520,8 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
   if (HasNoMedia(strDirectory))
     return true;
 
+  CheckAlbumBatch();
+
   // load subfolder
   CFileItemList items;
   CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetMusicExtensions() + "|.jpg|.tbn|.lrc|.cdg", DIR_FLAG_DEFAULTS);
@@ -542,6 +561,7 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
 
     // save information about this folder
     m_musicDatabase.SetPathHash(strDirectory, hash);
+    CheckAlbumBatch();
   }
   else
   { // path is the same - no need to rescan
@@ -583,11 +603,9 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
 {
   std::vector<std::string> regexps = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
 
+  std::vector<CFileItemPtr> files;
   for (int i = 0; i < items.Size(); ++i)
   {
-    if (m_bStop)
-      return InfoRet::CANCELLED;
-
     CFileItemPtr pItem = items[i];
 
     if (CUtil::ExcludeFileOrFolder(pItem->GetPath(), regexps))
@@ -597,15 +615,20 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
         MUSIC::IsLyrics(*pItem))
       continue;
 
+    files.emplace_back(pItem);
+  }
+
+  if (!LoadTags(files))
+    return InfoRet::CANCELLED;
+
+  for (const auto& pItem : files)
+  {
+    if (m_bStop)
+      return InfoRet::CANCELLED;
+
     m_currentItem++;
 
     CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
-    if (!tag.Loaded())
-    {
-      std::unique_ptr<IMusicInfoTagLoader> pLoader (CMusicInfoTagLoaderFactory::CreateLoader(*pItem));
-      if (nullptr != pLoader)
-        pLoader->Load(pItem->GetPath(), tag);
-    }
 
     if (m_handle && m_itemCount>0)
       m_handle->SetPercentage(static_cast<float>(m_currentItem * 100) / static_cast<float>(m_itemCount));
@@ -629,6 +652,116 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
   return InfoRet::ADDED;
 }
 
+bool CMusicInfoScanner::LoadTags(const std::vector<CFileItemPtr>& items)
+{
+  if (items.empty())
+    return !m_bStop;
+
+  // shared with the helper jobs, which may start after all tags have been loaded
+  struct LoadState
+  {
+    explicit LoadState(const std::vector<CFileItemPtr>& files) : items(files) {}
+
+    std::vector<CFileItemPtr> items;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    std::atomic<bool> stop{false};
+    CEvent finished;
+  };
+  const auto state = std::make_shared<LoadState>(items);
+
+  const auto loadTags = [](LoadState& state, const std::function<void()>& afterItem)
+  {
+    for (size_t i = state.next++; i < state.items.size(); i = state.next++)
+    {
+      if (!state.stop)
+      {
+        CFileItem& item = *state.items[i];
+        CMusicInfoTag& tag = *item.GetMusicInfoTag();
+        if (!tag.Loaded())
+        {
+          std::unique_ptr<IMusicInfoTagLoader> pLoader(
+              CMusicInfoTagLoaderFactory::CreateLoader(item));
+          if (nullptr != pLoader)
+            pLoader->Load(item.GetPath(), tag);
+        }
+      }
+
+      if (++state.done == state.items.size())
+        state.finished.Set();
+      if (afterItem)
+        afterItem();
+    }
+  };
+
+  const int threads =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_musicLibraryTagReaderThreads;
+  const size_t helpers = std::min(static_cast<size_t>(std::max(threads - 1, 0)), items.size() - 1);
+  for (size_t i = 0; i < helpers; ++i)
+    CServiceBroker::GetJobManager()->Submit([state, loadTags]() { loadTags(*state, nullptr); },
+                                            CJob::PRIORITY_DEDICATED);
+
+  // a batch left open by the previous folders must not stay open while reading, and a stop
+  // request must also stop the helpers while this thread is still reading
+  loadTags(*state,
+           [this, &state]
+           {
+             if (m_bStop)
+               state->stop = true;
+             CheckAlbumBatch();
+           });
+
+  // wait for the files still being read by the helpers
+  while (state->done < state->items.size())
+  {
+    if (m_bStop)
+      state->stop = true;
+    state->finished.Wait(100ms);
+    CheckAlbumBatch();
+  }
+
+  return !m_bStop;
+}
+
+void CMusicInfoScanner::BeginAlbumBatch()
+{
+  if (m_musicDatabase.InTransaction())
+    return;
+
+  m_musicDatabase.BeginTransaction();
+  m_albumsInBatch = 0;
+  m_batchStart = std::chrono::steady_clock::now();
+}
+
+void CMusicInfoScanner::CommitAlbumBatch()
+{
+  if (!m_musicDatabase.InTransaction())
+    return;
+
+  if (!m_musicDatabase.CommitTransaction())
+    CLog::Log(LOGERROR, "{} - failed to commit {} albums", __FUNCTION__, m_albumsInBatch);
+  else if (m_albumsInBatch > 0)
+    CLog::Log(LOGDEBUG, "{} - committed {} albums in {} ms", __FUNCTION__, m_albumsInBatch,
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - m_batchStart)
+                  .count());
+  m_albumsInBatch = 0;
+}
+
+void CMusicInfoScanner::CheckAlbumBatch()
+{
+  if (m_musicDatabase.InTransaction() &&
+      (m_albumsInBatch >= ALBUM_BATCH_SIZE ||
+       std::chrono::steady_clock::now() - m_batchStart >= ALBUM_BATCH_DURATION))
+    CommitAlbumBatch();
+}
+
+void CMusicInfoScanner::AlbumAddedToBatch()
+{
+  ++m_albumsInBatch;
+  CheckAlbumBatch();
+}
+
 static bool SortSongsByTrack(const CSong& song, const CSong& song2)
 {
   return song.iTrack < song2.iTrack;
@@ -985,8 +1118,10 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
       album.releaseType = ReleaseType::Single;
 
     album.strPath = strDirectory;
+    BeginAlbumBatch();
     m_musicDatabase.AddAlbum(album, m_idSourcePath);
     m_albumsAdded.insert(album.idAlbum);
+    AlbumAddedToBatch();
 
     numAdded += static_cast<int>(album.songs.size());
   }
@@ -2050,7 +2185,7 @@ bool CMusicInfoScanner::AddArtistArtwork(CArtist& artist, const std::string& art
     // (other art types will be cached when first displayed)
     if (iArtLevel != CSettings::MUSICLIBRARY_ARTWORK_LEVEL_ALL || it.first == "thumb" ||
         it.first == "fanart")
-      CServiceBroker::GetTextureCache()->BackgroundCacheImage(it.second);
+      CServiceBroker::GetTextureCache()->BackgroundCacheImage(it.second, true);
     auto ret = artist.art.insert(it);
     if (ret.second)
       m_musicDatabase.SetArtForItem(artist.idArtist, MediaTypeArtist, it.first, it.second);
@@ -2172,7 +2307,7 @@ bool CMusicInfoScanner::AddAlbumArtwork(CAlbum& album)
     // (other art types will be cached when first displayed)
     if (iArtLevel != CSettings::MUSICLIBRARY_ARTWORK_LEVEL_ALL || it.first == "thumb" ||
         it.first == "fanart")
-      CServiceBroker::GetTextureCache()->BackgroundCacheImage(it.second);
+      CServiceBroker::GetTextureCache()->BackgroundCacheImage(it.second, true);
 
     auto ret = album.art.insert(it);
     if (ret.second)
@@ -13,10 +13,14 @@
 #include "threads/IRunnable.h"
 #include "threads/Thread.h"
 
+#include <chrono>
+#include <memory>
 #include <string>
+#include <vector>
 
 class CAlbum;
 class CArtist;
+class CFileItem;
 class CFileItemList;
 class CGUIDialogProgressBarHandle;
 class CScraperUrl;
@@ -259,6 +263,27 @@ protected:
    \param scannedItems [in] list to populate with the scannedItems
    */
   InfoRet ScanTags(const CFileItemList& items, CFileItemList& scannedItems);
+
+  /*! \brief Load the tags of the given files concurrently
+   Tag loaders are independent per file, so the scanner thread is helped by up to
+   tagreaderthreads - 1 jobs reading the tags of the other files. Tags that are already
+   loaded are kept.
+   \param items [in/out] files to load the tags for
+   \return false if the scan was stopped before all tags were loaded
+   */
+  bool LoadTags(const std::vector<std::shared_ptr<CFileItem>>& items);
+
+  /*! \brief Add albums in large transactions
+   Committing each album separately makes the initial import of a big collection bound by the
+   database sync latency. Albums and path hashes are instead committed in batches. A batch is
+   only opened to add an album. CheckAlbumBatch() commits it once it is large or has been open
+   for a while, and is called after every write, between folders and while tags are being read,
+   so other database users aren't blocked for long.
+   */
+  void BeginAlbumBatch();
+  void CommitAlbumBatch();
+  void CheckAlbumBatch();
+  void AlbumAddedToBatch();
   int GetPathHash(const CFileItemList &items, std::string &hash);
 
   void Run() override;
@@ -285,6 +310,8 @@ protected:
   CMusicDatabase m_musicDatabase;
 
   std::set<int> m_albumsAdded;
+  int m_albumsInBatch = 0;
+  std::chrono::steady_clock::time_point m_batchStart;
 
   std::set<std::string> m_seenPaths;
   int m_flags;
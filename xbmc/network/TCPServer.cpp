@@ -550,6 +550,15 @@ void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
   } while (sent < size);
 }
 
+void CTCPServer::CTCPClient::Send(CJSONRPCResponseStream& response)
+{
+  // keep announcements from being written into the middle of the response
+  std::unique_lock lock(m_critSection);
+  std::string chunk;
+  while (response.ReadChunk(chunk))
+    Send(chunk.c_str(), chunk.size());
+}
+
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   m_new = false;
@@ -613,8 +622,7 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
       }
       if (m_beginBrackets > 0 && m_endBrackets > 0 && m_beginBrackets == m_endBrackets)
       {
-        std::string line = CJSONRPC::MethodCall(m_buffer, host, this);
-        Send(line.c_str(), line.size());
+        Send(*CJSONRPC::MethodCallStreamed(m_buffer, host, this));
         m_beginChar = m_beginBrackets = m_endBrackets = 0;
         m_buffer.clear();
       }
@@ -685,6 +693,7 @@ CTCPServer::CWebSocketClient& CTCPServer::CWebSocketClient::operator=(const CWeb
 
 void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
 {
+  std::unique_lock lock(m_critSection);
   const CWebSocketMessage *msg = m_websocket->Send(WebSocketTextFrame, data, size);
   if (msg == NULL || !msg->IsComplete())
     return;
@@ -694,6 +703,33 @@ void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
     CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
 }
 
+void CTCPServer::CWebSocketClient::Send(CJSONRPCResponseStream& response)
+{
+  // every chunk is sent as a fragment of a single text message, which needs to know
+  // whether another chunk follows. No other message may be sent in between.
+  std::unique_lock lock(m_critSection);
+  std::string chunk, nextChunk;
+  response.ReadChunk(chunk);
+
+  WebSocketFrameOpcode opcode = WebSocketTextFrame;
+  bool last = false;
+  while (!last)
+  {
+    last = !response.ReadChunk(nextChunk);
+
+    const CWebSocketFrame* frame =
+        m_websocket->SendFragment(opcode, chunk.c_str(), chunk.size(), last);
+    if (frame == NULL)
+      return;
+
+    CTCPClient::Send(frame->GetFrameData(), (unsigned int)frame->GetFrameLength());
+    delete frame;
+
+    chunk.swap(nextChunk);
+    opcode = WebSocketContinuationFrame;
+  }
+}
+
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   bool send;
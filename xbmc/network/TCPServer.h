@@ -11,6 +11,7 @@
 #include "interfaces/json-rpc/IClient.h"
 #include "interfaces/json-rpc/IJSONRPCAnnouncer.h"
 #include "interfaces/json-rpc/ITransportLayer.h"
+#include "interfaces/json-rpc/JSONRPCResponseStream.h"
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
 #include "websocket/WebSocket.h"
@@ -65,6 +66,7 @@ namespace JSONRPC
       bool SetAnnouncementFlags(int flags) override;
 
       virtual void Send(const char *data, unsigned int size);
+      virtual void Send(CJSONRPCResponseStream& response);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
       virtual void Disconnect();
 
@@ -96,6 +98,7 @@ namespace JSONRPC
       ~CWebSocketClient() override;
 
       void Send(const char *data, unsigned int size) override;
+      void Send(CJSONRPCResponseStream& response) override;
       void PushBuffer(CTCPServer *host, const char *buffer, int length) override;
       void Disconnect() override;
 
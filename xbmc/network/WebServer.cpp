@@ -349,6 +349,10 @@ MHD_RESULT CWebServer::HandleRequest(const std::shared_ptr<IHTTPRequestHandler>&
       ret = CreateFileDownloadResponse(handler, response);
       break;
 
+    case HTTPStreamDownload:
+      ret = CreateStreamDownloadResponse(handler, response);
+      break;
+
     case HTTPMemoryDownloadNoFreeNoCopy:
     case HTTPMemoryDownloadNoFreeCopy:
     case HTTPMemoryDownloadFreeNoCopy:
@@ -913,6 +917,31 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   return MHD_YES;
 }
 
+MHD_RESULT CWebServer::CreateStreamDownloadResponse(
+    const std::shared_ptr<IHTTPRequestHandler>& handler, struct MHD_Response*& response) const
+{
+  if (handler == nullptr)
+    return MHD_NO;
+
+  // the handler has to stay around until the whole response has been read from it
+  auto context = std::make_unique<std::shared_ptr<IHTTPRequestHandler>>(handler);
+
+  // without a known size mhd sends the response chunked
+  response = MHD_create_response_from_callback(MHD_SIZE_UNKNOWN, 16 * 1024,
+                                               &CWebServer::StreamReaderCallback, context.get(),
+                                               &CWebServer::StreamReaderFreeCallback);
+  if (response == nullptr)
+  {
+    m_logger->error("failed to create a streamed HTTP response for {}",
+                    handler->GetRequest().pathUrl);
+    return MHD_NO;
+  }
+
+  context.release(); // ownership was passed to mhd
+
+  return MHD_YES;
+}
+
 MHD_RESULT CWebServer::CreateErrorResponse(struct MHD_Connection* connection,
                                            int responseType,
                                            HTTPMethod method,
@@ -1114,6 +1143,30 @@ void CWebServer::ContentReaderFreeCallback(void* cls)
     GetLogger()->debug("[OUT] done");
 }
 
+ssize_t CWebServer::StreamReaderCallback(void* cls, uint64_t pos, char* buf, size_t max)
+{
+  auto handler = static_cast<std::shared_ptr<IHTTPRequestHandler>*>(cls);
+  if (handler == nullptr || *handler == nullptr)
+    return MHD_CONTENT_READER_END_WITH_ERROR;
+
+  const size_t written = (*handler)->ReadResponseStream(buf, max);
+  if (written == 0)
+    return MHD_CONTENT_READER_END_OF_STREAM;
+
+  if (CServiceBroker::GetLogging().CanLogComponent(LOGWEBSERVER))
+    GetLogger()->debug("[OUT] streamed {} bytes at {}", written, pos);
+
+  return static_cast<ssize_t>(written);
+}
+
+void CWebServer::StreamReaderFreeCallback(void* cls)
+{
+  delete static_cast<std::shared_ptr<IHTTPRequestHandler>*>(cls);
+
+  if (CServiceBroker::GetLogging().CanLogComponent(LOGWEBSERVER))
+    GetLogger()->debug("[OUT] done");
+}
+
 static Logger GetMhdLogger()
 {
   return CServiceBroker::GetLogging().GetLogger("libmicrohttpd");
@@ -18,8 +18,13 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <string.h>
+
 #define MAX_HTTP_POST_SIZE 65536
 
+CHTTPJsonRpcHandler::~CHTTPJsonRpcHandler() = default;
+
 bool CHTTPJsonRpcHandler::CanHandleRequest(const HTTPRequest &request) const
 {
   return (request.pathUrl.compare("/jsonrpc") == 0);
@@ -70,12 +75,29 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
       jsonpCallback = argument->second;
   }
 
-  if (isRequest)
+  if (isRequest && jsonpCallback.empty())
   {
-    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
+    m_responseStream =
+        JSONRPC::CJSONRPC::MethodCallStreamed(m_requestData, &m_transportLayer, &client);
+    m_requestData.clear();
 
-    if (!jsonpCallback.empty())
-      m_responseData = jsonpCallback + "(" + m_responseData + ");";
+    // a response which fits into a single chunk is sent as a whole with its length
+    if (m_responseStream->ReadChunk(m_responseData) && m_responseStream->ReadChunk(m_nextChunk))
+    {
+      m_response.type = HTTPStreamDownload;
+      m_response.status = MHD_HTTP_OK;
+      m_response.contentType = "application/json";
+      m_response.totalLength = 0;
+
+      return MHD_YES;
+    }
+
+    m_responseStream.reset();
+  }
+  else if (isRequest)
+  {
+    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
+    m_responseData = jsonpCallback + "(" + m_responseData + ");";
   }
   else if (jsonpCallback.empty())
   {
@@ -118,6 +140,33 @@ HttpResponseRanges CHTTPJsonRpcHandler::GetResponseData() const
   return ranges;
 }
 
+size_t CHTTPJsonRpcHandler::ReadResponseStream(char* buffer, size_t size)
+{
+  if (!m_responseStream)
+    return 0;
+
+  size_t written = 0;
+  while (written < size)
+  {
+    if (m_responsePosition == m_responseData.size())
+    {
+      m_responsePosition = 0;
+      m_responseData.clear();
+      if (!m_nextChunk.empty())
+        m_responseData.swap(m_nextChunk);
+      else if (!m_responseStream->ReadChunk(m_responseData))
+        break;
+    }
+
+    const size_t length = std::min(size - written, m_responseData.size() - m_responsePosition);
+    memcpy(buffer + written, m_responseData.data() + m_responsePosition, length);
+    m_responsePosition += length;
+    written += length;
+  }
+
+  return written;
+}
+
 bool CHTTPJsonRpcHandler::appendPostData(const char *data, size_t size)
 {
   if (m_requestData.size() + size > MAX_HTTP_POST_SIZE)
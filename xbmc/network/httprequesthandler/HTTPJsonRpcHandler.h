@@ -12,13 +12,19 @@
 #include "interfaces/json-rpc/ITransportLayer.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
 
+#include <memory>
 #include <string>
 
+namespace JSONRPC
+{
+class CJSONRPCResponseStream;
+}
+
 class CHTTPJsonRpcHandler : public IHTTPRequestHandler
 {
 public:
   CHTTPJsonRpcHandler() = default;
-  ~CHTTPJsonRpcHandler() override = default;
+  ~CHTTPJsonRpcHandler() override;
 
   // implementations of IHTTPRequestHandler
   IHTTPRequestHandler* Create(const HTTPRequest &request) const override { return new CHTTPJsonRpcHandler(request); }
@@ -27,6 +33,7 @@ public:
   MHD_RESULT HandleRequest() override;
 
   HttpResponseRanges GetResponseData() const override;
+  size_t ReadResponseStream(char* buffer, size_t size) override;
 
   int GetPriority() const override { return 5; }
 
@@ -42,6 +49,11 @@ private:
   std::string m_responseData;
   CHttpResponseRange m_responseRange;
 
+  // set while a response too big for a single chunk is sent
+  std::unique_ptr<JSONRPC::CJSONRPCResponseStream> m_responseStream;
+  std::string m_nextChunk;
+  size_t m_responsePosition = 0;
+
   class CHTTPTransportLayer : public JSONRPC::ITransportLayer
   {
   public:
@@ -60,7 +60,10 @@ typedef enum HTTPResponseType
   HTTPMemoryDownloadFreeNoCopy,
   // creates a HTTP response from a buffer by copying followed by freeing the buffer
   // the buffer must have been malloc'ed and not new'ed
-  HTTPMemoryDownloadFreeCopy
+  HTTPMemoryDownloadFreeCopy,
+  // creates a chunked HTTP response of unknown length which is read from the request handler
+  // while it is sent
+  HTTPStreamDownload
 } HTTPResponseType;
 
 typedef struct HTTPRequest
@@ -153,6 +156,18 @@ public:
    */
   virtual HttpResponseRanges GetResponseData() const { return HttpResponseRanges(); }
 
+  /*!
+   * \brief Reads the next part of the response data.
+   *
+   * \details This is only used if the response type is HTTPStreamDownload. It is called
+   * after HandleRequest() has returned, possibly from another thread, until it returns 0.
+   *
+   * \param buffer Buffer to be filled with response data
+   * \param size Size of the buffer
+   * \return Number of bytes written to the buffer, 0 at the end of the response.
+   */
+  virtual size_t ReadResponseStream(char* buffer, size_t size) { return 0; }
+
   /*!
   * \brief Returns the URL to which the request should be redirected.
   *
@@ -120,6 +120,13 @@ public:
   virtual bool Handshake(const char* data, size_t length, std::string &response) = 0;
   virtual const CWebSocketMessage* Handle(const char* &buffer, size_t &length, bool &send);
   virtual const CWebSocketMessage* Send(WebSocketFrameOpcode opcode, const char* data = NULL, uint32_t length = 0);
+  /*!
+   \brief Get a single frame of a message which is sent in fragments
+   \param opcode Opcode of the message for the first fragment, WebSocketContinuationFrame afterwards
+   \param final Whether this is the last fragment of the message
+   \return Frame to be sent and deleted by the caller or NULL
+   */
+  virtual const CWebSocketFrame* SendFragment(WebSocketFrameOpcode opcode, const char* data, uint32_t length, bool final);
   virtual const CWebSocketFrame* Ping(const char* data = NULL) const = 0;
   virtual const CWebSocketFrame* Pong(const char* data, uint32_t length) const = 0;
   virtual const CWebSocketFrame* Close(WebSocketCloseReason reason = WebSocketCloseNormal, const std::string &message = "") = 0;
@@ -57,6 +57,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 extern "C"
 {
@@ -934,18 +935,32 @@ PVR_ERROR CPVRClient::RenameChannel(const std::shared_ptr<const CPVRChannel>& ch
       m_clientCapabilities.SupportsChannelSettings());
 }
 
+namespace
+{
+struct EpgTransfer
+{
+  CPVREpg* epg{nullptr};
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+};
+} // unnamed namespace
+
 PVR_ERROR CPVRClient::GetEPGForChannel(int iChannelUid,
                                        CPVREpg* epg,
                                        time_t start,
                                        time_t end) const
 {
-  return DoAddonCall(
+  // collect the transferred tags and apply them to the EPG at once
+  EpgTransfer transfer{epg, {}};
+
+  const auto transferStart = std::chrono::steady_clock::now();
+
+  const PVR_ERROR error = DoAddonCall(
       std::source_location::current().function_name(),
-      [this, iChannelUid, epg, start, end](const AddonInstance* addon)
+      [this, iChannelUid, &transfer, start, end](const AddonInstance* addon)
       {
         PVR_HANDLE_STRUCT handle = {};
         handle.callerAddress = this;
-        handle.dataAddress = epg;
+        handle.dataAddress = &transfer;
 
         int iPVRTimeCorrection =
             CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_iPVRTimeCorrection;
@@ -955,6 +970,26 @@ PVR_ERROR CPVRClient::GetEPGForChannel(int iChannelUid,
                                                 end ? end - iPVRTimeCorrection : 0);
       },
       m_clientCapabilities.SupportsEPG());
+
+  if (error != PVR_ERROR_NO_ERROR)
+    return error;
+
+  const auto transferEnd = std::chrono::steady_clock::now();
+  const size_t iEvents = transfer.tags.size();
+
+  epg->UpdateEntries(std::move(transfer.tags));
+
+  const auto updateEnd = std::chrono::steady_clock::now();
+  const auto transferDuration =
+      std::chrono::duration_cast<std::chrono::milliseconds>(transferEnd - transferStart);
+  CLog::LogFC(LOGDEBUG, LOGEPG,
+              "Transferred {} events for channel {} in {} ms ({} events/s), updated EPG in {} ms",
+              iEvents, iChannelUid, transferDuration.count(),
+              transferDuration.count() > 0 ? iEvents * 1000 / transferDuration.count() : iEvents,
+              std::chrono::duration_cast<std::chrono::milliseconds>(updateEnd - transferEnd)
+                  .count());
+
+  return error;
 }
 
 PVR_ERROR CPVRClient::SetEPGMaxPastDays(int iPastDays)
@@ -2276,9 +2311,10 @@ void CPVRClient::cb_transfer_epg_entry(void* kodiInstance,
                           return;
                         }
 
-                        // transfer this entry to the epg
-                        auto* epg{static_cast<CPVREpg*>(handle->dataAddress)};
-                        epg->UpdateEntry(epgentry, client->GetID());
+                        // add this entry to the transfer, applied to the epg once complete
+                        auto* transfer{static_cast<EpgTransfer*>(handle->dataAddress)};
+                        transfer->tags.emplace_back(
+                            transfer->epg->CreateEntry(*epgentry, client->GetID()));
                       });
 }
 
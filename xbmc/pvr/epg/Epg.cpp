@@ -171,6 +171,12 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpg::GetTimeline(
   return m_tags.GetTimeline(timelineStart, timelineEnd, minEventEnd, maxEventStart);
 }
 
+uint64_t CPVREpg::GetTagsRevision() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_tags.GetRevision();
+}
+
 bool CPVREpg::UpdateEntries(const CPVREpg& epg)
 {
   std::unique_lock lock(m_critSection);
@@ -189,26 +195,34 @@ bool CPVREpg::UpdateEntries(const CPVREpg& epg)
 namespace
 {
 
-bool IsTagExpired(const std::shared_ptr<const CPVREpgInfoTag>& tag)
+CDateTime GetCleanupTime()
 {
   // Respect epg linger time.
   const int iPastDays = CServiceBroker::GetSettingsComponent()->GetSettings()->GetInt(
       CSettings::SETTING_EPG_PAST_DAYSTODISPLAY);
-  const CDateTime cleanupTime(CDateTime::GetUTCDateTime() - CDateTimeSpan(iPastDays, 0, 0, 0));
+  return CDateTime::GetUTCDateTime() - CDateTimeSpan(iPastDays, 0, 0, 0);
+}
 
-  return tag->EndAsUTC() < cleanupTime;
+bool IsTagExpired(const std::shared_ptr<const CPVREpgInfoTag>& tag)
+{
+  return tag->EndAsUTC() < GetCleanupTime();
 }
 
 } // unnamed namespace
 
-bool CPVREpg::UpdateEntry(const EPG_TAG* data, int iClientId)
+std::shared_ptr<CPVREpgInfoTag> CPVREpg::CreateEntry(const EPG_TAG& data, int iClientId) const
 {
-  if (!data)
-    return false;
+  std::unique_lock lock(m_critSection);
+  return std::make_shared<CPVREpgInfoTag>(data, iClientId, m_channelData, m_iEpgID);
+}
 
-  const auto tag{std::make_shared<CPVREpgInfoTag>(*data, iClientId, m_channelData, m_iEpgID)};
+bool CPVREpg::UpdateEntries(std::vector<std::shared_ptr<CPVREpgInfoTag>> tags)
+{
+  const CDateTime cleanupTime = GetCleanupTime();
+  std::erase_if(tags, [&cleanupTime](const auto& tag) { return tag->EndAsUTC() < cleanupTime; });
 
-  return !IsTagExpired(tag) && m_tags.UpdateEntry(tag);
+  std::unique_lock lock(m_critSection);
+  return m_tags.UpdateEntries(std::move(tags));
 }
 
 bool CPVREpg::UpdateEntry(const std::shared_ptr<CPVREpgInfoTag>& tag, EPG_EVENT_STATE newState)
@@ -539,6 +553,12 @@ bool CPVREpg::NeedsSave() const
   return m_bChanged || m_bUpdateLastScanTime || m_tags.NeedsSave();
 }
 
+size_t CPVREpg::GetChangedTagsCount() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_tags.GetChangedTagsCount();
+}
+
 bool CPVREpg::IsValid() const
 {
   std::unique_lock lock(m_critSection);
@@ -15,6 +15,7 @@
 #include "utils/EventStream.h"
 
 #include <atomic>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -173,12 +174,19 @@ public:
   std::shared_ptr<CPVREpgInfoTag> GetTagByStartDateTime(const CDateTime& start) const;
 
   /*!
-   * @brief Update an entry in this EPG.
-   * @param data The tag to update.
+   * @brief Create a tag for this EPG, to be passed to UpdateEntries.
+   * @param data The tag data.
    * @param iClientId The id of the pvr client this event belongs to.
+   * @return The tag.
+   */
+  std::shared_ptr<CPVREpgInfoTag> CreateEntry(const EPG_TAG& data, int iClientId) const;
+
+  /*!
+   * @brief Update this EPG with a batch of tags, e.g. all tags transferred by a client at once.
+   * @param tags The new or updated tags, in any order. Expired tags are ignored.
    * @return True if it was updated successfully, false otherwise.
    */
-  bool UpdateEntry(const EPG_TAG* data, int iClientId);
+  bool UpdateEntries(std::vector<std::shared_ptr<CPVREpgInfoTag>> tags);
 
   /*!
    * @brief Update an entry in this EPG.
@@ -224,6 +232,12 @@ public:
                                                            const CDateTime& minEventEnd,
                                                            const CDateTime& maxEventStart) const;
 
+  /*!
+   * @brief Get the revision of the tags of this EPG.
+   * @return The revision. Changes whenever tags are added, updated or removed.
+   */
+  uint64_t GetTagsRevision() const;
+
   /*!
    * @brief Write the query to persist data into given database's queue
    * @param database The database.
@@ -264,6 +278,12 @@ public:
    */
   bool NeedsSave() const;
 
+  /*!
+   * @brief Get the number of new or changed tags not yet persisted.
+   * @return The number of tags.
+   */
+  size_t GetChangedTagsCount() const;
+
   /*!
    * @brief Check whether this EPG is valid.
    * @return True if this EPG is valid and can be updated, false otherwise.
@@ -28,6 +28,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -272,6 +273,10 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
     // Note: We must lock the db the whole time, otherwise races may occur.
     database->Lock();
 
+    const auto persistStart = std::chrono::steady_clock::now();
+    size_t iPersistedTags = 0;
+    size_t iUncommittedTags = 0;
+
     XbmcThreads::EndTime<> processTimeslice{std::chrono::milliseconds(iMaxTimeslice)};
     for (const auto& epg : changedEpgs)
     {
@@ -280,15 +285,21 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
         CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: Persisting events for channel '{}'...",
                     epg->GetChannelData()->ChannelName());
 
+        const size_t iTags = epg->GetChangedTagsCount();
         bReturn &= epg->QueuePersistQuery(database);
+        iPersistedTags += iTags;
+        iUncommittedTags += iTags;
 
+        // insert queries contain many tags each, so limit the tags too
         size_t queryCount = database->GetInsertQueriesCount() + database->GetDeleteQueriesCount();
-        if (queryCount > EPG_COMMIT_QUERY_COUNT_LIMIT)
+        if (queryCount > EPG_COMMIT_QUERY_COUNT_LIMIT ||
+            iUncommittedTags > EPG_COMMIT_QUERY_COUNT_LIMIT)
         {
           CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: committing {} queries in loop.",
                       queryCount);
           database->CommitDeleteQueries();
           database->CommitInsertQueries();
+          iUncommittedTags = 0;
           CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: committed {} queries in loop.", queryCount);
         }
       }
@@ -302,6 +313,15 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
       database->CommitInsertQueries();
     }
 
+    if (iPersistedTags > 0)
+    {
+      const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - persistStart);
+      CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: persisted {} events in {} ms ({} events/s)",
+                  iPersistedTags, duration.count(),
+                  duration.count() > 0 ? iPersistedTags * 1000 / duration.count() : iPersistedTags);
+    }
+
     database->Unlock();
   }
 
@@ -1278,14 +1278,8 @@ bool CPVREpgDatabase::QueueDeleteEpgTags(int iEpgId)
   return QueueDeleteQuery(strQuery);
 }
 
-bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
+std::string CPVREpgDatabase::GetPersistValues(const CPVREpgInfoTag& tag) const
 {
-  if (tag.EpgID() <= 0)
-  {
-    CLog::LogF(LOGERROR, "Tag '{}' does not have a valid table", tag.Title());
-    return false;
-  }
-
   time_t iStartTime{0};
   tag.StartAsUTC().GetAsTime(iStartTime);
 
@@ -1296,62 +1290,106 @@ bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
   if (tag.FirstAired().IsValid())
     sFirstAired = tag.FirstAired().GetAsW3CDate();
 
-  int iBroadcastId = tag.DatabaseID();
-  std::string strQuery;
+  std::string strValues = PrepareSQL(
+      "(%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, '%s', '%s', "
+      "%i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, '%s', '%s', '%s'",
+      tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
+      tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
+      tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
+      CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
+      CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
+      tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
+      tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
+      tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
+      tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
+      tag.UniqueBroadcastID(), tag.ClientParentalRatingIconPath().c_str(),
+      tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
+
+  // existing tags keep their id
+  if (tag.DatabaseID() >= 0)
+    strValues += PrepareSQL(", %i", tag.DatabaseID());
+
+  strValues += ")";
+  return strValues;
+}
 
-  std::unique_lock lock(m_critSection);
+std::string CPVREpgDatabase::GetPersistQuery(bool bWithDatabaseID, const std::string& strValues)
+{
+  return StringUtils::Format(
+      "REPLACE INTO epgtags (idEpg, iStartTime, iEndTime, sTitle, sPlotOutline, sPlot, "
+      "sOriginalTitle, sCast, sDirector, sWriter, iYear, sIMDBNumber, sIconPath, iGenreType, "
+      "iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, iSeriesId, iEpisodeId, "
+      "iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, iBroadcastUid, "
+      "sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo{}) VALUES {};",
+      bWithDatabaseID ? ", idBroadcast" : "", strValues);
+}
 
-  if (iBroadcastId < 0)
+bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
+{
+  if (tag.EpgID() <= 0)
   {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, '%s', '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
-        tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), tag.ClientParentalRatingIconPath().c_str(),
-        tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
+    CLog::LogF(LOGERROR, "Tag '{}' does not have a valid table", tag.Title());
+    return false;
   }
-  else
+
+  std::unique_lock lock(m_critSection);
+
+  QueueInsertQuery(GetPersistQuery(tag.DatabaseID() >= 0, GetPersistValues(tag)));
+  return true;
+}
+
+bool CPVREpgDatabase::QueuePersistQuery(const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags)
+{
+  bool bReturn = true;
+
+  std::unique_lock lock(m_critSection);
+
+  // new and existing tags differ in the columns to insert, so each get their own queries
+  struct Rows
   {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, idBroadcast, sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, %i, '%s', '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
-        tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), iBroadcastId, tag.ClientParentalRatingIconPath().c_str(),
-        tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
+    std::string values;
+    unsigned int count{0};
+  };
+  Rows newTags;
+  Rows existingTags;
+
+  const auto queueRows = [this](Rows& rows, bool bWithDatabaseID)
+  {
+    if (rows.count > 0)
+      QueueInsertQuery(GetPersistQuery(bWithDatabaseID, rows.values));
+
+    rows.values.clear();
+    rows.count = 0;
+  };
+
+  for (const auto& tag : tags)
+  {
+    if (tag->EpgID() <= 0)
+    {
+      CLog::LogF(LOGERROR, "Tag '{}' does not have a valid table", tag->Title());
+      bReturn = false;
+      continue;
+    }
+
+    const bool bWithDatabaseID = tag->DatabaseID() >= 0;
+    Rows& rows = bWithDatabaseID ? existingTags : newTags;
+
+    if (rows.count > 0)
+      rows.values += ", ";
+
+    rows.values += GetPersistValues(*tag);
+    rows.count++;
+
+    // keep the statements well below the size limits of the database backends
+    if (rows.count == EPG_PERSIST_TAGS_PER_QUERY ||
+        rows.values.size() > EPG_PERSIST_QUERY_SIZE_LIMIT)
+      queueRows(rows, bWithDatabaseID);
   }
 
-  QueueInsertQuery(strQuery);
-  return true;
+  queueRows(newTags, false);
+  queueRows(existingTags, true);
+
+  return bReturn;
 }
 
 int CPVREpgDatabase::GetLastEPGId() const
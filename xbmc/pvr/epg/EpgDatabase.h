@@ -12,6 +12,7 @@
 #include "threads/CriticalSection.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 class CDateTime;
@@ -27,6 +28,8 @@ struct PVREpgSearchData;
 /** The EPG database */
 
 static constexpr int EPG_COMMIT_QUERY_COUNT_LIMIT = 10000;
+static constexpr unsigned int EPG_PERSIST_TAGS_PER_QUERY = 100;
+static constexpr size_t EPG_PERSIST_QUERY_SIZE_LIMIT = 256 * 1024;
 
 class CPVREpgDatabase : public CDatabase, public std::enable_shared_from_this<CPVREpgDatabase>
 {
@@ -305,6 +308,14 @@ public:
    */
   bool QueuePersistQuery(const CPVREpgInfoTag& tag);
 
+  /*!
+   * @brief Write the queries to persist the given EPG tags to db query queue, inserting many
+   * tags with each query.
+   * @param tags The tags to persist.
+   * @return True on success, false otherwise.
+   */
+  bool QueuePersistQuery(const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags);
+
   /*!
    * @return Last EPG id in the database
    */
@@ -380,6 +391,9 @@ private:
 
   std::shared_ptr<CPVREpgInfoTag> CreateEpgTag(dbiplus::Dataset& ds) const;
 
+  std::string GetPersistValues(const CPVREpgInfoTag& tag) const;
+  static std::string GetPersistQuery(bool bWithDatabaseID, const std::string& strValues);
+
   std::shared_ptr<CPVREpgSearchFilter> CreateEpgSearchFilter(bool bRadio,
                                                              dbiplus::Dataset& ds) const;
 
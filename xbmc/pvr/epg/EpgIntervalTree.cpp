@@ -0,0 +1,194 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EpgIntervalTree.h"
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <limits>
+
+using namespace PVR;
+
+void CPVREpgIntervalTree::Build(std::vector<Interval> intervals)
+{
+  m_intervals = std::move(intervals);
+
+  m_sortedEnds.clear();
+  m_sortedEnds.reserve(m_intervals.size());
+  for (const auto& interval : m_intervals)
+    m_sortedEnds.emplace_back(interval.end);
+  std::ranges::sort(m_sortedEnds);
+
+  // unused leaves never match
+  m_leaves = std::bit_ceil(std::max<size_t>(m_intervals.size(), 1));
+  m_minEnd.assign(2 * m_leaves, std::numeric_limits<time_t>::max());
+  m_maxEnd.assign(2 * m_leaves, std::numeric_limits<time_t>::min());
+
+  for (size_t i = 0; i < m_intervals.size(); ++i)
+  {
+    m_minEnd[m_leaves + i] = m_intervals[i].end;
+    m_maxEnd[m_leaves + i] = m_intervals[i].end;
+  }
+
+  for (size_t node = m_leaves - 1; node > 0; --node)
+  {
+    m_minEnd[node] = std::min(m_minEnd[2 * node], m_minEnd[2 * node + 1]);
+    m_maxEnd[node] = std::max(m_maxEnd[2 * node], m_maxEnd[2 * node + 1]);
+  }
+}
+
+void CPVREpgIntervalTree::Clear()
+{
+  m_intervals.clear();
+  m_sortedEnds.clear();
+  m_leaves = 0;
+  m_minEnd.clear();
+  m_maxEnd.clear();
+}
+
+size_t CPVREpgIntervalTree::LowerBound(time_t start) const
+{
+  return std::ranges::lower_bound(m_intervals, start, {}, &Interval::start) - m_intervals.begin();
+}
+
+size_t CPVREpgIntervalTree::UpperBound(time_t start) const
+{
+  return std::ranges::upper_bound(m_intervals, start, {}, &Interval::start) - m_intervals.begin();
+}
+
+std::optional<size_t> CPVREpgIntervalTree::Find(time_t start) const
+{
+  const size_t index = LowerBound(start);
+  if (index < m_intervals.size() && m_intervals[index].start == start)
+    return index;
+
+  return {};
+}
+
+std::vector<size_t> CPVREpgIntervalTree::GetOverlapping(time_t minEnd, time_t maxStart) const
+{
+  std::vector<size_t> result;
+  if (!m_intervals.empty())
+    CollectEndingFrom(1, 0, m_leaves, UpperBound(maxStart), minEnd, result);
+
+  return result;
+}
+
+std::vector<size_t> CPVREpgIntervalTree::GetContained(time_t minStart, time_t maxEnd) const
+{
+  // an interval ending before maxEnd can't start after it
+  std::vector<size_t> result;
+  if (!m_intervals.empty())
+    CollectEndingUntil(1, 0, m_leaves, LowerBound(minStart), UpperBound(maxEnd), maxEnd, result);
+
+  return result;
+}
+
+std::optional<size_t> CPVREpgIntervalTree::GetFirstStartingFrom(time_t minStart) const
+{
+  const size_t index = LowerBound(minStart);
+  if (index < m_intervals.size())
+    return index;
+
+  return {};
+}
+
+std::optional<size_t> CPVREpgIntervalTree::GetLastEndingUntil(time_t maxEnd) const
+{
+  if (m_intervals.empty())
+    return {};
+
+  return FindLastEndingUntil(1, 0, m_leaves, UpperBound(maxEnd), maxEnd);
+}
+
+std::optional<time_t> CPVREpgIntervalTree::GetMaxEnd() const
+{
+  if (m_sortedEnds.empty())
+    return {};
+
+  return m_sortedEnds.back();
+}
+
+std::optional<time_t> CPVREpgIntervalTree::GetMaxEndUntil(time_t maxEnd) const
+{
+  const auto it = std::ranges::upper_bound(m_sortedEnds, maxEnd);
+  if (it == m_sortedEnds.begin())
+    return {};
+
+  return *std::prev(it);
+}
+
+std::optional<time_t> CPVREpgIntervalTree::GetMinStartAfter(time_t minStart) const
+{
+  const size_t index = UpperBound(minStart);
+  if (index < m_intervals.size())
+    return m_intervals[index].start;
+
+  return {};
+}
+
+void CPVREpgIntervalTree::CollectEndingFrom(size_t node,
+                                            size_t first,
+                                            size_t last,
+                                            size_t end,
+                                            time_t minEnd,
+                                            std::vector<size_t>& result) const
+{
+  if (first >= end || m_maxEnd[node] < minEnd)
+    return;
+
+  if (node >= m_leaves)
+  {
+    result.emplace_back(first);
+    return;
+  }
+
+  const size_t middle = first + (last - first) / 2;
+  CollectEndingFrom(2 * node, first, middle, end, minEnd, result);
+  CollectEndingFrom(2 * node + 1, middle, last, end, minEnd, result);
+}
+
+void CPVREpgIntervalTree::CollectEndingUntil(size_t node,
+                                             size_t first,
+                                             size_t last,
+                                             size_t begin,
+                                             size_t end,
+                                             time_t maxEnd,
+                                             std::vector<size_t>& result) const
+{
+  if (last <= begin || first >= end || m_minEnd[node] > maxEnd)
+    return;
+
+  if (node >= m_leaves)
+  {
+    result.emplace_back(first);
+    return;
+  }
+
+  const size_t middle = first + (last - first) / 2;
+  CollectEndingUntil(2 * node, first, middle, begin, end, maxEnd, result);
+  CollectEndingUntil(2 * node + 1, middle, last, begin, end, maxEnd, result);
+}
+
+std::optional<size_t> CPVREpgIntervalTree::FindLastEndingUntil(
+    size_t node, size_t first, size_t last, size_t end, time_t maxEnd) const
+{
+  if (first >= end || m_minEnd[node] > maxEnd)
+    return {};
+
+  if (node >= m_leaves)
+    return first;
+
+  const size_t middle = first + (last - first) / 2;
+  const auto index = FindLastEndingUntil(2 * node + 1, middle, last, end, maxEnd);
+  if (index)
+    return index;
+
+  return FindLastEndingUntil(2 * node, first, middle, end, maxEnd);
+}
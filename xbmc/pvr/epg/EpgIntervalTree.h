@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <ctime>
+#include <optional>
+#include <vector>
+
+namespace PVR
+{
+/*!
+ * @brief Interval tree over the start and end times of EPG events.
+ *
+ * The intervals are kept ordered by start time, a balanced tree over them holds the earliest and
+ * the latest end time of every subtree. Time window queries only descend into subtrees which can
+ * contain a match, so they take O(log n + k). Like the EPG database, all bounds are inclusive.
+ */
+class CPVREpgIntervalTree
+{
+public:
+  struct Interval
+  {
+    time_t start{0};
+    time_t end{0};
+  };
+
+  /*!
+   * @brief Replace the intervals of the tree.
+   * @param intervals The intervals, ordered by start time.
+   */
+  void Build(std::vector<Interval> intervals);
+
+  /*!
+   * @brief Remove all intervals.
+   */
+  void Clear();
+
+  bool IsEmpty() const { return m_intervals.empty(); }
+  size_t Size() const { return m_intervals.size(); }
+  const Interval& operator[](size_t index) const { return m_intervals[index]; }
+
+  /*!
+   * @brief Get the interval starting at the given time.
+   * @return Its index or nothing if there is none.
+   */
+  std::optional<size_t> Find(time_t start) const;
+
+  /*!
+   * @brief Get all intervals with end >= minEnd and start <= maxStart.
+   * @return Their indexes, ordered by start time.
+   */
+  std::vector<size_t> GetOverlapping(time_t minEnd, time_t maxStart) const;
+
+  /*!
+   * @brief Get all intervals with start >= minStart and end <= maxEnd.
+   * @return Their indexes, ordered by start time.
+   */
+  std::vector<size_t> GetContained(time_t minStart, time_t maxEnd) const;
+
+  /*!
+   * @brief Get the first interval with start >= minStart.
+   * @return Its index or nothing if there is none.
+   */
+  std::optional<size_t> GetFirstStartingFrom(time_t minStart) const;
+
+  /*!
+   * @brief Get the last interval, by start time, with end <= maxEnd.
+   * @return Its index or nothing if there is none.
+   */
+  std::optional<size_t> GetLastEndingUntil(time_t maxEnd) const;
+
+  /*!
+   * @brief Get the latest end time of all intervals.
+   */
+  std::optional<time_t> GetMaxEnd() const;
+
+  /*!
+   * @brief Get the latest end time <= maxEnd.
+   */
+  std::optional<time_t> GetMaxEndUntil(time_t maxEnd) const;
+
+  /*!
+   * @brief Get the earliest start time > minStart.
+   */
+  std::optional<time_t> GetMinStartAfter(time_t minStart) const;
+
+private:
+  size_t LowerBound(time_t start) const;
+  size_t UpperBound(time_t start) const;
+
+  void CollectEndingFrom(size_t node,
+                         size_t first,
+                         size_t last,
+                         size_t end,
+                         time_t minEnd,
+                         std::vector<size_t>& result) const;
+  void CollectEndingUntil(size_t node,
+                          size_t first,
+                          size_t last,
+                          size_t begin,
+                          size_t end,
+                          time_t maxEnd,
+                          std::vector<size_t>& result) const;
+  std::optional<size_t> FindLastEndingUntil(
+      size_t node, size_t first, size_t last, size_t end, time_t maxEnd) const;
+
+  std::vector<Interval> m_intervals;
+  std::vector<time_t> m_sortedEnds;
+
+  // heap layout, node 1 is the root and covers [0, m_leaves)
+  size_t m_leaves{0};
+  std::vector<time_t> m_minEnd;
+  std::vector<time_t> m_maxEnd;
+};
+} // namespace PVR
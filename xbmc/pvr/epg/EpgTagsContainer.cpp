@@ -12,9 +12,11 @@
 #include "pvr/epg/EpgDatabase.h"
 #include "pvr/epg/EpgInfoTag.h"
 #include "pvr/epg/EpgTagsCache.h"
+#include "pvr/epg/EpgTagsIndex.h"
 #include "utils/log.h"
 
 #include <algorithm>
+#include <atomic>
 #include <ranges>
 
 using namespace PVR;
@@ -22,7 +24,13 @@ using namespace PVR;
 namespace
 {
 const CDateTimeSpan ONE_SECOND(0, 0, 0, 1);
+
+uint64_t NextRevision()
+{
+  static std::atomic<uint64_t> lastRevision{0};
+  return ++lastRevision;
 }
+} // unnamed namespace
 
 CPVREpgTagsContainer::CPVREpgTagsContainer(int iEpgID,
                                            const std::shared_ptr<CPVREpgChannelData>& channelData,
@@ -30,7 +38,9 @@ CPVREpgTagsContainer::CPVREpgTagsContainer(int iEpgID,
   : m_iEpgID(iEpgID),
     m_channelData(channelData),
     m_database(database),
-    m_tagsCache(std::make_unique<CPVREpgTagsCache>(iEpgID, channelData, database, m_changedTags))
+    m_committedTags(std::make_unique<CPVREpgTagsIndex>(iEpgID, database)),
+    m_tagsCache(std::make_unique<CPVREpgTagsCache>(channelData, *m_committedTags, m_changedTags)),
+    m_revision(NextRevision())
 {
 }
 
@@ -39,6 +49,7 @@ CPVREpgTagsContainer::~CPVREpgTagsContainer() = default;
 void CPVREpgTagsContainer::SetEpgID(int iEpgID)
 {
   m_iEpgID = iEpgID;
+  m_committedTags->SetEpgID(iEpgID);
   for (const auto& [_, tag] : m_changedTags)
     tag->SetEpgID(iEpgID);
 }
@@ -141,6 +152,7 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
     const CDateTime minEventEnd = (*tags.m_changedTags.cbegin()).second->StartAsUTC() + ONE_SECOND;
     const CDateTime maxEventStart = (*tags.m_changedTags.crbegin()).second->EndAsUTC();
 
+    // fresh copies from the database, the existing tags get updated in place below
     std::vector<std::shared_ptr<CPVREpgInfoTag>> existingTags =
         m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
 
@@ -189,7 +201,7 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
     }
 
     if (bResetCache)
-      m_tagsCache->Reset();
+      TagsChanged();
   }
   else
   {
@@ -200,6 +212,39 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
   return true;
 }
 
+bool CPVREpgTagsContainer::UpdateEntries(std::vector<std::shared_ptr<CPVREpgInfoTag>> tags)
+{
+  if (tags.empty())
+    return false;
+
+  if (m_database)
+  {
+    // compare against the stored tags once for the whole batch
+    CPVREpgTagsContainer batch(m_iEpgID, m_channelData, {});
+    batch.UpdateEntries(std::move(tags));
+    return UpdateEntries(batch);
+  }
+
+  std::ranges::stable_sort(tags, {}, [](const auto& tag) { return tag->StartAsUTC(); });
+
+  bool bChanged = false;
+  for (const auto& tag : tags)
+  {
+    tag->SetChannelData(m_channelData);
+    tag->SetEpgID(m_iEpgID);
+
+    // duplicates update the tag already present
+    const auto [it, bInserted] = m_changedTags.try_emplace(tag->StartAsUTC(), tag);
+    if (bInserted || (*it).second->Update(*tag, false))
+      bChanged = true;
+  }
+
+  if (bChanged)
+    TagsChanged();
+
+  return true;
+}
+
 void CPVREpgTagsContainer::FixOverlappingEvents(
     std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags) const
 {
@@ -277,14 +322,14 @@ bool CPVREpgTagsContainer::UpdateEntry(const std::shared_ptr<CPVREpgInfoTag>& ta
     {
       // tag differs from existing tag and must be persisted
       m_changedTags.try_emplace(existingTag->StartAsUTC(), existingTag);
-      m_tagsCache->Reset();
+      TagsChanged();
     }
   }
   else
   {
     // new tags must always be persisted
     m_changedTags.try_emplace(tag->StartAsUTC(), tag);
-    m_tagsCache->Reset();
+    TagsChanged();
   }
 
   return true;
@@ -294,7 +339,7 @@ bool CPVREpgTagsContainer::DeleteEntry(const std::shared_ptr<CPVREpgInfoTag>& ta
 {
   m_changedTags.erase(tag->StartAsUTC());
   m_deletedTags.try_emplace(tag->StartAsUTC(), tag);
-  m_tagsCache->Reset();
+  TagsChanged();
   return true;
 }
 
@@ -314,17 +359,29 @@ void CPVREpgTagsContainer::Cleanup(const CDateTime& time)
                       return true;
                     }) > 0)
   {
-    m_tagsCache->Reset();
+    TagsChanged();
   }
 
   if (m_database)
-    m_database->DeleteEpgTags(m_iEpgID, time);
+  {
+    if (m_database->DeleteEpgTags(m_iEpgID, time))
+      m_committedTags->RemoveTagsEndedBefore(time);
+    else
+      m_committedTags->Invalidate();
+  }
 }
 
 void CPVREpgTagsContainer::Clear()
 {
   m_changedTags.clear();
+  m_committedTags->Invalidate();
+  TagsChanged();
+}
+
+void CPVREpgTagsContainer::TagsChanged()
+{
   m_tagsCache->Reset();
+  m_revision = NextRevision();
 }
 
 bool CPVREpgTagsContainer::IsEmpty() const
@@ -332,10 +389,7 @@ bool CPVREpgTagsContainer::IsEmpty() const
   if (!m_changedTags.empty())
     return false;
 
-  if (m_database)
-    return !m_database->HasTags(m_iEpgID);
-
-  return true;
+  return !m_committedTags->HasTags();
 }
 
 std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTag(const CDateTime& startTime) const
@@ -402,7 +456,7 @@ std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTagBetween(const CDateT
   if (m_database)
   {
     const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags =
-        CreateEntries(m_database->GetEpgTagsByMinStartMaxEndTime(m_iEpgID, start, end));
+        CreateEntries(m_committedTags->GetTagsByMinStartMaxEndTime(start, end));
     if (!tags.empty())
     {
       if (tags.size() > 1)
@@ -468,7 +522,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     bool loadFromDb = true;
     if (!m_changedTags.empty())
     {
-      const CDateTime lastEnd = m_database->GetLastEndTime(m_iEpgID);
+      const CDateTime lastEnd = m_committedTags->GetLastEndTime();
       if (!lastEnd.IsValid() || lastEnd < minEventEnd)
       {
         // nothing in the db yet. take what we have in memory.
@@ -479,7 +533,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
 
     if (loadFromDb)
     {
-      tags = m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
+      tags = m_committedTags->GetTagsByMinEndMaxStartTime(minEventEnd, maxEventStart);
 
       if (!m_changedTags.empty())
       {
@@ -521,11 +575,11 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     if (result.empty())
     {
       // create single gap tag
-      CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+      CDateTime maxEnd = m_committedTags->GetMaxEndTime(minEventEnd);
       if (!maxEnd.IsValid() || maxEnd < timelineStart)
         maxEnd = timelineStart;
 
-      CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+      CDateTime minStart = m_committedTags->GetMinStartTime(maxEventStart);
       if (!minStart.IsValid() || minStart > timelineEnd)
         minStart = timelineEnd;
 
@@ -536,7 +590,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.front()->StartAsUTC() > minEventEnd)
       {
         // prepend gap tag
-        CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+        CDateTime maxEnd = m_committedTags->GetMaxEndTime(minEventEnd);
         if (!maxEnd.IsValid() || maxEnd < timelineStart)
           maxEnd = timelineStart;
 
@@ -546,7 +600,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.back()->EndAsUTC() < maxEventStart)
       {
         // append gap tag
-        CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+        CDateTime minStart = m_committedTags->GetMinStartTime(maxEventStart);
         if (!minStart.IsValid() || minStart > timelineEnd)
           minStart = timelineEnd;
 
@@ -565,7 +619,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetAllTags()
   if (m_database)
   {
     std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
-    if (!m_changedTags.empty() && !m_database->HasTags(m_iEpgID))
+    if (!m_changedTags.empty() && !m_committedTags->HasTags())
     {
       // nothing in the db yet. take what we have in memory.
       std::ranges::copy(std::views::values(m_changedTags), std::back_inserter(tags));
@@ -574,7 +628,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetAllTags()
     }
     else
     {
-      tags = m_database->GetAllEpgTags(m_iEpgID);
+      tags = m_committedTags->GetAllTags();
 
       if (!m_changedTags.empty())
       {
@@ -615,6 +669,9 @@ void CPVREpgTagsContainer::QueuePersistQuery()
     CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Tags Container: Updating {}, deleting {} events...",
                 m_changedTags.size(), m_deletedTags.size());
 
+    // deleted tags were still read from the database until now
+    const bool bTagsDeleted = !m_deletedTags.empty();
+
     for (const auto& [_, tag] : m_deletedTags)
       m_database->QueueDeleteTagQuery(*tag);
 
@@ -622,16 +679,45 @@ void CPVREpgTagsContainer::QueuePersistQuery()
 
     FixOverlappingEvents(m_changedTags);
 
+    // remove any conflicting events from database before persisting the new events. one query
+    // per run of adjacent events is enough, events starting where one ends get replaced anyway.
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+    tags.reserve(m_changedTags.size());
+
+    CDateTime rangeStart;
+    CDateTime rangeEnd;
     for (const auto& [_, tag] : m_changedTags)
     {
-      // remove any conflicting events from database before persisting the new event
-      m_database->QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(
-          m_iEpgID, tag->StartAsUTC() + ONE_SECOND, tag->EndAsUTC() - ONE_SECOND);
+      if (tags.empty() || tag->StartAsUTC() > rangeEnd)
+      {
+        if (!tags.empty())
+          m_database->QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(m_iEpgID, rangeStart + ONE_SECOND,
+                                                                  rangeEnd - ONE_SECOND);
+
+        rangeStart = tag->StartAsUTC();
+        rangeEnd = tag->EndAsUTC();
+      }
+      else if (tag->EndAsUTC() > rangeEnd)
+      {
+        rangeEnd = tag->EndAsUTC();
+      }
 
-      tag->QueuePersistQuery(m_database);
+      tags.emplace_back(tag);
     }
 
-    Clear();
+    if (!tags.empty())
+      m_database->QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(m_iEpgID, rangeStart + ONE_SECOND,
+                                                              rangeEnd - ONE_SECOND);
+
+    m_database->QueuePersistQuery(tags);
+
+    // the changed tags moved to the database, but are the same
+    m_changedTags.clear();
+    m_committedTags->Invalidate();
+    if (bTagsDeleted)
+      TagsChanged();
+    else
+      m_tagsCache->Reset();
 
     m_database->Unlock();
   }
@@ -10,6 +10,7 @@
 
 #include "XBDateTime.h"
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <vector>
@@ -20,6 +21,7 @@ class CPVREpgTagsCache;
 class CPVREpgChannelData;
 class CPVREpgDatabase;
 class CPVREpgInfoTag;
+class CPVREpgTagsIndex;
 
 class CPVREpgTagsContainer
 {
@@ -63,6 +65,13 @@ public:
    */
   bool UpdateEntries(const CPVREpgTagsContainer& tags);
 
+  /*!
+   * @brief Update all entries with the provided batch of tags at once.
+   * @param tags The new or updated tags, in any order. Tags with the same start time are merged.
+   * @return True if the update was successful, false otherwise.
+   */
+  bool UpdateEntries(std::vector<std::shared_ptr<CPVREpgInfoTag>> tags);
+
   /*!
    * @brief Release all entries.
    */
@@ -158,12 +167,24 @@ public:
    */
   std::pair<CDateTime, CDateTime> GetFirstAndLastUncommittedEPGDate() const;
 
+  /*!
+   * @brief Get the revision of the tags, which changes whenever they change.
+   * @return The revision, unique across all containers.
+   */
+  uint64_t GetRevision() const { return m_revision; }
+
   /*!
    * @brief Check whether this container has unsaved data.
    * @return True if this container contains unsaved data, false otherwise.
    */
   bool NeedsSave() const;
 
+  /*!
+   * @brief Get the number of new or changed tags not yet persisted.
+   * @return The number of tags.
+   */
+  size_t GetChangedTagsCount() const { return m_changedTags.size(); }
+
   /*!
    * @brief Write the query to persist data into database's queue
    */
@@ -215,10 +236,17 @@ private:
   void FixOverlappingEvents(std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags) const;
   void FixOverlappingEvents(std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>& tags) const;
 
+  /*!
+   * @brief Reset the cached tags and advance the revision.
+   */
+  void TagsChanged();
+
   int m_iEpgID = 0;
   std::shared_ptr<CPVREpgChannelData> m_channelData;
   const std::shared_ptr<CPVREpgDatabase> m_database;
+  const std::unique_ptr<CPVREpgTagsIndex> m_committedTags;
   const std::unique_ptr<CPVREpgTagsCache> m_tagsCache;
+  uint64_t m_revision{0};
 
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_changedTags;
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_deletedTags;
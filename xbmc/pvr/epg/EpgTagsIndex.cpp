@@ -0,0 +1,207 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EpgTagsIndex.h"
+
+#include "ServiceBroker.h"
+#include "pvr/epg/EpgDatabase.h"
+#include "pvr/epg/EpgInfoTag.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/log.h"
+
+#include <algorithm>
+
+using namespace PVR;
+
+namespace
+{
+time_t AsTime(const CDateTime& dateTime)
+{
+  time_t time{0};
+  dateTime.GetAsTime(time);
+  return time;
+}
+
+bool IsIndexEnabled()
+{
+  const auto settings = CServiceBroker::GetSettingsComponent();
+  return settings && settings->GetAdvancedSettings()->m_bEpgTagsIndex;
+}
+} // unnamed namespace
+
+CPVREpgTagsIndex::CPVREpgTagsIndex(int iEpgID, const std::shared_ptr<CPVREpgDatabase>& database)
+  : m_iEpgID(iEpgID), m_database(database), m_bEnabled(IsIndexEnabled())
+{
+}
+
+void CPVREpgTagsIndex::SetEpgID(int iEpgID)
+{
+  if (m_iEpgID != iEpgID)
+  {
+    m_iEpgID = iEpgID;
+    Invalidate();
+  }
+}
+
+void CPVREpgTagsIndex::Invalidate()
+{
+  m_bLoaded = false;
+  m_tags.clear();
+  m_tree.Clear();
+}
+
+void CPVREpgTagsIndex::RemoveTagsEndedBefore(const CDateTime& maxEndTime)
+{
+  if (!m_bLoaded)
+    return;
+
+  const time_t maxEnd = AsTime(maxEndTime);
+  if (std::erase_if(m_tags, [maxEnd](const auto& tag)
+                    { return AsTime(tag->EndAsUTC()) < maxEnd; }) > 0)
+    Build();
+}
+
+bool CPVREpgTagsIndex::Load() const
+{
+  if (!m_bEnabled || !m_database || m_iEpgID <= 0)
+    return false;
+
+  if (!m_bLoaded)
+  {
+    m_tags = m_database->GetAllEpgTags(m_iEpgID);
+    std::ranges::stable_sort(m_tags, {}, [](const auto& tag) { return tag->StartAsUTC(); });
+    Build();
+    m_bLoaded = true;
+
+    CLog::LogFC(LOGDEBUG, LOGEPG, "Loaded {} tags of EPG {} into memory", m_tags.size(), m_iEpgID);
+  }
+  return true;
+}
+
+void CPVREpgTagsIndex::Build() const
+{
+  std::vector<CPVREpgIntervalTree::Interval> intervals;
+  intervals.reserve(m_tags.size());
+  for (const auto& tag : m_tags)
+    intervals.emplace_back(
+        CPVREpgIntervalTree::Interval{AsTime(tag->StartAsUTC()), AsTime(tag->EndAsUTC())});
+
+  m_tree.Build(std::move(intervals));
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsIndex::GetTags(
+    const std::vector<size_t>& indexes) const
+{
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  tags.reserve(indexes.size());
+  for (size_t index : indexes)
+    tags.emplace_back(m_tags[index]);
+
+  return tags;
+}
+
+bool CPVREpgTagsIndex::HasTags() const
+{
+  if (Load())
+    return !m_tree.IsEmpty();
+
+  return m_database && m_database->HasTags(m_iEpgID);
+}
+
+CDateTime CPVREpgTagsIndex::GetLastEndTime() const
+{
+  if (Load())
+  {
+    const auto end = m_tree.GetMaxEnd();
+    return end ? CDateTime(*end) : CDateTime();
+  }
+
+  return m_database ? m_database->GetLastEndTime(m_iEpgID) : CDateTime();
+}
+
+CDateTime CPVREpgTagsIndex::GetMinStartTime(const CDateTime& minStart) const
+{
+  if (Load())
+  {
+    const auto start = m_tree.GetMinStartAfter(AsTime(minStart));
+    return start ? CDateTime(*start) : CDateTime();
+  }
+
+  return m_database ? m_database->GetMinStartTime(m_iEpgID, minStart) : CDateTime();
+}
+
+CDateTime CPVREpgTagsIndex::GetMaxEndTime(const CDateTime& maxEnd) const
+{
+  if (Load())
+  {
+    const auto end = m_tree.GetMaxEndUntil(AsTime(maxEnd));
+    return end ? CDateTime(*end) : CDateTime();
+  }
+
+  return m_database ? m_database->GetMaxEndTime(m_iEpgID, maxEnd) : CDateTime();
+}
+
+std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsIndex::GetTagByMinStartTime(
+    const CDateTime& minStartTime) const
+{
+  if (Load())
+  {
+    const auto index = m_tree.GetFirstStartingFrom(AsTime(minStartTime));
+    return index ? m_tags[*index] : nullptr;
+  }
+
+  return m_database ? m_database->GetEpgTagByMinStartTime(m_iEpgID, minStartTime) : nullptr;
+}
+
+std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsIndex::GetTagByMaxEndTime(
+    const CDateTime& maxEndTime) const
+{
+  if (Load())
+  {
+    const auto index = m_tree.GetLastEndingUntil(AsTime(maxEndTime));
+    return index ? m_tags[*index] : nullptr;
+  }
+
+  return m_database ? m_database->GetEpgTagByMaxEndTime(m_iEpgID, maxEndTime) : nullptr;
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsIndex::GetTagsByMinStartMaxEndTime(
+    const CDateTime& minStartTime, const CDateTime& maxEndTime) const
+{
+  if (Load())
+    return GetTags(m_tree.GetContained(AsTime(minStartTime), AsTime(maxEndTime)));
+
+  if (m_database)
+    return m_database->GetEpgTagsByMinStartMaxEndTime(m_iEpgID, minStartTime, maxEndTime);
+
+  return {};
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsIndex::GetTagsByMinEndMaxStartTime(
+    const CDateTime& minEndTime, const CDateTime& maxStartTime) const
+{
+  if (Load())
+    return GetTags(m_tree.GetOverlapping(AsTime(minEndTime), AsTime(maxStartTime)));
+
+  if (m_database)
+    return m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEndTime, maxStartTime);
+
+  return {};
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsIndex::GetAllTags() const
+{
+  if (Load())
+    return m_tags;
+
+  if (m_database)
+    return m_database->GetAllEpgTags(m_iEpgID);
+
+  return {};
+}
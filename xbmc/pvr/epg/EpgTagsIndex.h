@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "XBDateTime.h"
+#include "pvr/epg/EpgIntervalTree.h"
+
+#include <memory>
+#include <vector>
+
+namespace PVR
+{
+class CPVREpgDatabase;
+class CPVREpgInfoTag;
+
+/*!
+ * @brief The committed tags of an EPG, answering the time window queries of the EPG database.
+ *
+ * If enabled with advanced setting epg.tagsindex, all tags of the EPG are loaded from the
+ * database once and the queries are served from memory by an interval tree. Otherwise, and as
+ * long as the EPG isn't stored in the database yet, they go to the database. The tags returned
+ * are shared with later queries, so their times must not be modified. The owner must call
+ * Invalidate() whenever the tags in the database change.
+ */
+class CPVREpgTagsIndex
+{
+public:
+  CPVREpgTagsIndex() = delete;
+  CPVREpgTagsIndex(int iEpgID, const std::shared_ptr<CPVREpgDatabase>& database);
+
+  /*!
+   * @brief Set the EPG id for this EPG.
+   * @param iEpgID The ID.
+   */
+  void SetEpgID(int iEpgID);
+
+  /*!
+   * @brief Drop the loaded tags, to be reloaded from the database on the next query.
+   */
+  void Invalidate();
+
+  /*!
+   * @brief Remove the tags deleted from the database by CPVREpgDatabase::DeleteEpgTags.
+   * @param maxEndTime The end time the tags ended before.
+   */
+  void RemoveTagsEndedBefore(const CDateTime& maxEndTime);
+
+  /*!
+   * @see CPVREpgDatabase::HasTags
+   */
+  bool HasTags() const;
+
+  /*!
+   * @see CPVREpgDatabase::GetLastEndTime
+   */
+  CDateTime GetLastEndTime() const;
+
+  /*!
+   * @see CPVREpgDatabase::GetMinStartTime
+   */
+  CDateTime GetMinStartTime(const CDateTime& minStart) const;
+
+  /*!
+   * @see CPVREpgDatabase::GetMaxEndTime
+   */
+  CDateTime GetMaxEndTime(const CDateTime& maxEnd) const;
+
+  /*!
+   * @see CPVREpgDatabase::GetEpgTagByMinStartTime
+   */
+  std::shared_ptr<CPVREpgInfoTag> GetTagByMinStartTime(const CDateTime& minStartTime) const;
+
+  /*!
+   * @see CPVREpgDatabase::GetEpgTagByMaxEndTime
+   */
+  std::shared_ptr<CPVREpgInfoTag> GetTagByMaxEndTime(const CDateTime& maxEndTime) const;
+
+  /*!
+   * @see CPVREpgDatabase::GetEpgTagsByMinStartMaxEndTime
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTagsByMinStartMaxEndTime(
+      const CDateTime& minStartTime, const CDateTime& maxEndTime) const;
+
+  /*!
+   * @see CPVREpgDatabase::GetEpgTagsByMinEndMaxStartTime
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTagsByMinEndMaxStartTime(
+      const CDateTime& minEndTime, const CDateTime& maxStartTime) const;
+
+  /*!
+   * @see CPVREpgDatabase::GetAllEpgTags
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetAllTags() const;
+
+private:
+  /*!
+   * @brief Load the tags from the database, if not done yet.
+   * @return True if the queries can be served from memory, false otherwise.
+   */
+  bool Load() const;
+
+  void Build() const;
+
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTags(const std::vector<size_t>& indexes) const;
+
+  int m_iEpgID = 0;
+  const std::shared_ptr<CPVREpgDatabase> m_database;
+  const bool m_bEnabled = false;
+
+  mutable bool m_bLoaded = false;
+  mutable std::vector<std::shared_ptr<CPVREpgInfoTag>> m_tags; // ordered by start time
+  mutable CPVREpgIntervalTree m_tree;
+};
+
+} // namespace PVR
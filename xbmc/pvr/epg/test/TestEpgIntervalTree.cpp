@@ -0,0 +1,124 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "pvr/epg/EpgIntervalTree.h"
+
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+// a day of hour long events, with a gap from 10:00 to 12:00 and an overlap at 18:00
+CPVREpgIntervalTree CreateDay()
+{
+  std::vector<CPVREpgIntervalTree::Interval> intervals;
+  for (time_t hour = 0; hour < 24; ++hour)
+  {
+    if (hour == 10 || hour == 11)
+      continue;
+    intervals.push_back({hour * 3600, (hour + 1) * 3600 + (hour == 17 ? 1800 : 0)});
+  }
+
+  CPVREpgIntervalTree tree;
+  tree.Build(std::move(intervals));
+  return tree;
+}
+} // unnamed namespace
+
+TEST(TestEpgIntervalTree, Empty)
+{
+  CPVREpgIntervalTree tree;
+  tree.Build({});
+
+  EXPECT_TRUE(tree.IsEmpty());
+  EXPECT_TRUE(tree.GetOverlapping(0, 1000).empty());
+  EXPECT_TRUE(tree.GetContained(0, 1000).empty());
+  EXPECT_FALSE(tree.GetFirstStartingFrom(0));
+  EXPECT_FALSE(tree.GetLastEndingUntil(1000));
+  EXPECT_FALSE(tree.GetMaxEnd());
+  EXPECT_FALSE(tree.Find(0));
+}
+
+TEST(TestEpgIntervalTree, Day)
+{
+  const CPVREpgIntervalTree tree = CreateDay();
+  ASSERT_EQ(22u, tree.Size());
+
+  // now at 9:30 and 18:15
+  EXPECT_EQ(std::vector<size_t>{9}, tree.GetOverlapping(9 * 3600 + 1801, 9 * 3600 + 1800));
+  EXPECT_EQ((std::vector<size_t>{15, 16}),
+            tree.GetOverlapping(18 * 3600 + 901, 18 * 3600 + 900));
+
+  // in the gap
+  EXPECT_TRUE(tree.GetOverlapping(10 * 3600 + 1, 11 * 3600).empty());
+  EXPECT_EQ(9u, tree.GetLastEndingUntil(11 * 3600).value());
+  EXPECT_EQ(10u, tree.GetFirstStartingFrom(10 * 3600 + 1).value());
+  EXPECT_EQ(12 * 3600, tree.GetMinStartAfter(10 * 3600).value());
+  EXPECT_EQ(10 * 3600, tree.GetMaxEndUntil(11 * 3600).value());
+
+  // inclusive bounds, like the database queries
+  EXPECT_EQ((std::vector<size_t>{2, 3}), tree.GetOverlapping(3 * 3600, 3 * 3600));
+  EXPECT_EQ((std::vector<size_t>{2, 3}), tree.GetContained(2 * 3600, 4 * 3600));
+
+  EXPECT_EQ(24 * 3600, tree.GetMaxEnd().value());
+  EXPECT_EQ(12u, tree.Find(14 * 3600).value());
+  EXPECT_FALSE(tree.Find(14 * 3600 + 1));
+}
+
+TEST(TestEpgIntervalTree, MatchesScan)
+{
+  std::mt19937 random(4711);
+  std::uniform_int_distribution<time_t> gap(0, 300);
+  std::uniform_int_distribution<time_t> length(60, 3600);
+  std::uniform_int_distribution<time_t> point(0, 200000);
+
+  // mostly consecutive events, with gaps, overlaps and a few long ones spanning many others
+  std::vector<CPVREpgIntervalTree::Interval> intervals;
+  time_t start = 1000;
+  for (int i = 0; i < 300; ++i)
+  {
+    const time_t end = start + (i % 37 == 0 ? 20 * length(random) : length(random));
+    intervals.push_back({start, end});
+    start = i % 5 == 0 ? start + length(random) / 2 : end + gap(random);
+  }
+
+  CPVREpgIntervalTree tree;
+  tree.Build(intervals);
+
+  for (int i = 0; i < 500; ++i)
+  {
+    const time_t a = point(random);
+    const time_t b = a + length(random);
+
+    std::vector<size_t> overlapping;
+    std::vector<size_t> contained;
+    std::optional<size_t> lastEnding;
+    std::optional<size_t> firstStarting;
+    for (size_t j = 0; j < intervals.size(); ++j)
+    {
+      if (intervals[j].end >= a && intervals[j].start <= b)
+        overlapping.emplace_back(j);
+      if (intervals[j].start >= a && intervals[j].end <= b)
+        contained.emplace_back(j);
+      if (intervals[j].end <= a)
+        lastEnding = j;
+      if (intervals[j].start >= a && !firstStarting)
+        firstStarting = j;
+    }
+
+    EXPECT_EQ(overlapping, tree.GetOverlapping(a, b));
+    EXPECT_EQ(contained, tree.GetContained(a, b));
+    EXPECT_EQ(lastEnding, tree.GetLastEndingUntil(a));
+    EXPECT_EQ(firstStarting, tree.GetFirstStartingFrom(a));
+  }
+}
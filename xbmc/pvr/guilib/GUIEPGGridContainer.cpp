@@ -27,9 +27,11 @@
 #include "utils/MathUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
+#include "utils/log.h"
 #include "windowing/WinSystem.h"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -751,6 +753,21 @@ void CGUIEPGGridContainer::UpdateItems()
   m_lastItem = nullptr;
   m_lastChannel = nullptr;
 
+  // only the channels whose EPG changed need to be read again.
+  const auto start = std::chrono::steady_clock::now();
+  const int iTakenChannels = m_updatedGridModel->TakeUnchangedEpgTags(*m_gridModel);
+  const auto& statistics = m_gridModel->GetStatistics();
+  CLog::LogFC(LOGDEBUG, LOGEPG,
+              "Took over EPG data of {} of {} channels in {} ms. Previous grid model read {} "
+              "timelines in {} ms",
+              iTakenChannels, m_updatedGridModel->ChannelItemsSize(),
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count(),
+              statistics.timelineQueries,
+              std::chrono::duration_cast<std::chrono::milliseconds>(statistics.timelineDuration)
+                  .count());
+
   // always use asynchronously precalculated grid data.
   m_gridModel = std::move(m_updatedGridModel);
 
@@ -1859,8 +1876,16 @@ void CGUIEPGGridContainer::SetTimelineItems(const CFileItemList& items,
   std::unique_ptr<CGUIEPGGridContainerModel> oldUpdatedGridModel;
   auto newUpdatedGridModel{std::make_unique<CGUIEPGGridContainerModel>(minutesPerBlock)};
 
+  const auto start = std::chrono::steady_clock::now();
+
   newUpdatedGridModel->Initialize(items, gridStart, gridEnd, iFirstChannel, iChannelsPerPage,
                                   iFirstBlock, iBlocksPerPage, blocksPerRulerItem, fBlockSize);
+
+  CLog::LogFC(LOGDEBUG, LOGEPG, "Initialized grid model with {} channels in {} ms",
+              newUpdatedGridModel->ChannelItemsSize(),
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count());
   {
     std::unique_lock lock(m_critSection);
 
@@ -21,8 +21,11 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 using namespace PVR;
@@ -65,8 +68,59 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CGUIEPGGridContainerModel::GetEPGTi
   if (max > m_gridEnd)
     max = m_gridEnd;
 
-  return m_channelItems[iChannel]->GetPVRChannelInfoTag()->GetEPGTimeline(m_gridStart, m_gridEnd,
-                                                                          min, max);
+  const auto start = std::chrono::steady_clock::now();
+
+  auto tags = m_channelItems[iChannel]->GetPVRChannelInfoTag()->GetEPGTimeline(m_gridStart,
+                                                                               m_gridEnd, min, max);
+
+  m_statistics.timelineQueries++;
+  m_statistics.timelineDuration += std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  return tags;
+}
+
+uint64_t CGUIEPGGridContainerModel::GetEPGRevision(int iChannel) const
+{
+  const std::shared_ptr<const CPVREpg> epg =
+      m_channelItems[iChannel]->GetPVRChannelInfoTag()->GetEPG();
+  return epg ? epg->GetTagsRevision() : 0;
+}
+
+int CGUIEPGGridContainerModel::TakeUnchangedEpgTags(CGUIEPGGridContainerModel& previous)
+{
+  // block numbers and gap tags depend on the grid geometry
+  if (previous.m_gridStart != m_gridStart || previous.m_gridEnd != m_gridEnd ||
+      previous.m_blocks != m_blocks || previous.m_minutesPerBlock != m_minutesPerBlock)
+    return 0;
+
+  std::map<std::pair<int, int>, int> channelIndexes;
+  for (int i = 0; i < ChannelItemsSize(); ++i)
+  {
+    const std::shared_ptr<const CPVRChannel> channel = m_channelItems[i]->GetPVRChannelInfoTag();
+    channelIndexes.try_emplace({channel->ClientID(), channel->UniqueID()}, i);
+  }
+
+  int iTaken = 0;
+  for (auto& [iPreviousChannel, epgTags] : previous.m_epgItems)
+  {
+    if (epgTags.epgRevision == 0)
+      continue;
+
+    const std::shared_ptr<const CPVRChannel> channel =
+        previous.m_channelItems[iPreviousChannel]->GetPVRChannelInfoTag();
+    const auto it = channelIndexes.find({channel->ClientID(), channel->UniqueID()});
+    if (it == channelIndexes.cend() || m_epgItems.contains(it->second) ||
+        GetEPGRevision(it->second) != epgTags.epgRevision)
+      continue;
+
+    m_epgItems.try_emplace(it->second, std::move(epgTags));
+    ++iTaken;
+  }
+
+  previous.m_epgItems.clear();
+  previous.m_gridIndex.clear();
+  return iTaken;
 }
 
 void CGUIEPGGridContainerModel::Initialize(const CFileItemList& items,
@@ -160,6 +214,9 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateEpgTags(int iChannel
   const int firstBlock = iBlock < m_firstActiveBlock ? iBlock : m_firstActiveBlock;
   const int lastBlock = iBlock > m_lastActiveBlock ? iBlock : m_lastActiveBlock;
 
+  // before reading the tags, so that a concurrent change can't go unnoticed
+  const uint64_t epgRevision = GetEPGRevision(iChannel);
+
   const auto tags =
       GetEPGTimeline(iChannel, GetStartTimeForBlock(firstBlock), GetStartTimeForBlock(lastBlock));
 
@@ -173,6 +230,7 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateEpgTags(int iChannel
 
   epgTags.firstBlock = firstResultBlock;
   epgTags.lastBlock = lastResultBlock;
+  epgTags.epgRevision = epgRevision;
 
   for (const auto& tag : tags)
   {
@@ -227,6 +285,10 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetEpgTagsBefore(EpgTags&
   if (lastBlock < 0)
     lastBlock = 0;
 
+  // tags read from different revisions can't be taken over by the next model
+  if (GetEPGRevision(iChannel) != epgTags.epgRevision)
+    epgTags.epgRevision = 0;
+
   const auto tags =
       GetEPGTimeline(iChannel, GetStartTimeForBlock(iBlock), GetStartTimeForBlock(lastBlock));
 
@@ -289,6 +351,10 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetEpgTagsAfter(EpgTags& e
   if (firstBlock >= GetLastBlock())
     firstBlock = GetLastBlock();
 
+  // tags read from different revisions can't be taken over by the next model
+  if (GetEPGRevision(iChannel) != epgTags.epgRevision)
+    epgTags.epgRevision = 0;
+
   const auto tags =
       GetEPGTimeline(iChannel, GetStartTimeForBlock(firstBlock), GetStartTimeForBlock(iBlock));
 
@@ -521,60 +587,37 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
   // clear the grid. it will be recreated on-demand.
   m_gridIndex.clear();
 
-  bool newChannels = false;
-
-  if (channelsChanged)
+  for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
   {
-    // purge epg tags for inactive channels
-    for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
+    // purge epg tags for inactive channels. tags of new channels will be read on-demand.
+    if (channelsChanged && ((*it).first < firstChannel || (*it).first > lastChannel))
     {
-      if ((*it).first < firstChannel || (*it).first > lastChannel)
-      {
-        it = m_epgItems.erase(it);
-        continue; // next channel
-      }
-      ++it;
+      it = m_epgItems.erase(it);
+      continue; // next channel
     }
 
-    newChannels = (firstChannel < m_firstActiveChannel) || (lastChannel > m_lastActiveChannel);
-  }
-
-  if (blocksChanged || newChannels)
-  {
-    // clear and refetch epg tags for active channels
-    const CDateTime maxEnd = GetStartTimeForBlock(firstBlock);
-    const CDateTime minStart = GetStartTimeForBlock(lastBlock);
-    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
-    for (int i = firstChannel; i <= lastChannel; ++i)
+    if (blocksChanged)
     {
-      auto it = m_epgItems.find(i);
-      if (it == m_epgItems.end())
-        it = m_epgItems.try_emplace(i).first;
-
-      if (blocksChanged || i < m_firstActiveChannel || i > m_lastActiveChannel)
+      // purge epg tags outside the active blocks. missing tags will be read on-demand.
+      EpgTags& epgTags = (*it).second;
+      std::erase_if(epgTags.tags,
+                    [this, firstBlock, lastBlock](const auto& item)
+                    {
+                      const std::shared_ptr<const CPVREpgInfoTag> tag = item->GetEPGInfoTag();
+                      return GetLastEventBlock(tag) < firstBlock ||
+                             GetFirstEventBlock(tag) > lastBlock;
+                    });
+
+      if (epgTags.tags.empty())
       {
-        EpgTags& epgTags = (*it).second;
-
-        (*it).second.tags.clear();
-
-        tags = GetEPGTimeline(i, maxEnd, minStart);
-        const int firstResultBlock = GetFirstEventBlock(tags.front());
-        const int lastResultBlock = GetLastEventBlock(tags.back());
-        if (firstResultBlock > lastResultBlock)
-          continue;
-
-        epgTags.firstBlock = firstResultBlock;
-        epgTags.lastBlock = lastResultBlock;
-
-        for (const auto& tag : tags)
-        {
-          if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
-            continue;
-
-          epgTags.tags.emplace_back(std::make_shared<CFileItem>(tag));
-        }
+        it = m_epgItems.erase(it);
+        continue; // next channel
       }
+
+      epgTags.firstBlock = GetFirstEventBlock(epgTags.tags.front()->GetEPGInfoTag());
+      epgTags.lastBlock = GetLastEventBlock(epgTags.tags.back()->GetEPGInfoTag());
     }
+    ++it;
   }
 
   m_firstActiveChannel = firstChannel;
@@ -712,7 +755,10 @@ std::unique_ptr<CFileItemList> CGUIEPGGridContainerModel::GetCurrentTimeLineItem
   for (int channel = firstChannel; channel < (firstChannel + numChannels); ++channel)
   {
     // m_epgItems is not sorted, fileitemlist must be sorted, so we have to 'find' the channel
-    const auto itEpg = m_epgItems.find(channel);
+    auto itEpg = m_epgItems.find(channel);
+    if (itEpg == m_epgItems.end() && CreateEpgTags(channel, m_firstActiveBlock))
+      itEpg = m_epgItems.find(channel);
+
     if (itEpg != m_epgItems.end())
     {
       // tags are sorted, so we can iterate and append
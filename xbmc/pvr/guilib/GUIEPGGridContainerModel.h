@@ -10,6 +10,8 @@
 
 #include "XBDateTime.h"
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -64,6 +66,22 @@ public:
                   float fBlockSize);
   void SetInvalid() const;
 
+  /*!
+   * @brief Take over the EPG data of the channels which did not change since the given model
+   * was filled, instead of reading it again.
+   * @param previous The model to take the data from. Must not be used afterwards.
+   * @return The number of channels whose EPG data was taken over.
+   */
+  int TakeUnchangedEpgTags(CGUIEPGGridContainerModel& previous);
+
+  struct Statistics
+  {
+    unsigned int timelineQueries{0};
+    std::chrono::microseconds timelineDuration{0};
+  };
+
+  const Statistics& GetStatistics() const { return m_statistics; }
+
   static const int INVALID_INDEX = -1;
   void FindChannelAndBlockIndex(int channelUid,
                                 unsigned int broadcastUid,
@@ -123,12 +141,14 @@ private:
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEPGTimeline(int iChannel,
                                                               const CDateTime& minEventEnd,
                                                               const CDateTime& maxEventStart) const;
+  uint64_t GetEPGRevision(int iChannel) const;
 
   struct EpgTags
   {
     std::vector<std::shared_ptr<CFileItem>> tags;
     int firstBlock = -1;
     int lastBlock = -1;
+    uint64_t epgRevision = 0; // revision of the channel's EPG the tags were read from
   };
 
   using EpgTagsMap = std::unordered_map<int, EpgTags>;
@@ -176,5 +196,7 @@ private:
   int m_lastActiveChannel = 0;
   int m_firstActiveBlock = 0;
   int m_lastActiveBlock = 0;
+
+  mutable Statistics m_statistics;
 };
 } // namespace PVR
@@ -10,9 +10,11 @@
 
 #include "ServiceBroker.h"
 #include "Util.h"
+#include "guilib/GUIComponent.h"
 #include "guilib/GUIFontManager.h"
 #include "guilib/GUIImage.h"
 #include "guilib/GUILabelControl.h"
+#include "guilib/GUIRenderBatch.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "windowing/WinSystem.h"
@@ -49,6 +51,13 @@ CRenderSystemBase::~CRenderSystemBase()
     advSettings->UnregisterSettingsLoadedCallback(m_settingsCallbackHandle.value());
 }
 
+void CRenderSystemBase::FlushRenderBatch()
+{
+  CGUIComponent* gui = CServiceBroker::GetGUI();
+  if (gui)
+    gui->GetRenderBatch().Flush();
+}
+
 void CRenderSystemBase::GetRenderVersion(unsigned int& major, unsigned int& minor) const
 {
   major = m_RenderVersionMajor;
@@ -105,6 +105,11 @@ public:
   virtual bool GetShowSplashImage();
 
 protected:
+  /*!
+   * \brief Draw the GUI quads collected so far, before changing state they depend on
+   */
+  void FlushRenderBatch();
+
   bool m_bRenderCreated{false};
   bool m_bVSync{true};
   unsigned int m_maxTextureSize{2048};
@@ -279,6 +279,7 @@ bool CRenderSystemGL::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+  FlushRenderBatch();
   return true;
 }
 
@@ -287,6 +288,8 @@ void CRenderSystemGL::InvalidateColorBuffer()
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
+
   /* clear is not affected by stipple pattern, so we can only clear on first frame */
   if (m_stereoMode == RenderStereoMode::INTERLACED && m_stereoView == RenderStereoView::RIGHT)
     return;
@@ -311,6 +314,8 @@ bool CRenderSystemGL::ClearBuffers(KODI::UTILS::COLOR::Color color)
   if (!m_bRenderCreated)
     return false;
 
+  FlushRenderBatch();
+
   /* clear is not affected by stipple pattern, so we can only clear on first frame */
   if (m_stereoMode == RenderStereoMode::INTERLACED && m_stereoView == RenderStereoView::RIGHT)
     return true;
@@ -371,6 +376,7 @@ void CRenderSystemGL::PresentRender(bool rendered, bool videoLayer)
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
   PresentRenderImpl(rendered);
 
   if (!rendered)
@@ -401,6 +407,7 @@ void CRenderSystemGL::CaptureStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
   glMatrixProject.Push();
   glMatrixModview.Push();
   glMatrixTexture.Push();
@@ -432,6 +439,8 @@ void CRenderSystemGL::SetCameraPosition(const CPoint &camera, int screenWidth, i
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
+
   CPoint offset = camera - CPoint(screenWidth*0.5f, screenHeight*0.5f);
 
 
@@ -507,6 +516,7 @@ void CRenderSystemGL::SetViewPort(const CRect& viewPort)
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
   glScissor((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   glViewport((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   m_viewPort[0] = viewPort.x1;
@@ -541,6 +551,8 @@ void CRenderSystemGL::SetScissors(const CRect &rect)
 {
   if (!m_bRenderCreated)
     return;
+
+  FlushRenderBatch();
   GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1));
   GLint y1 = MathUtils::round_int(static_cast<double>(rect.y1));
   GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2));
@@ -555,6 +567,7 @@ void CRenderSystemGL::ResetScissors()
 
 void CRenderSystemGL::SetDepthCulling(DepthCulling culling)
 {
+  FlushRenderBatch();
   if (culling == DepthCulling::OFF)
   {
     glDisable(GL_DEPTH_TEST);
@@ -634,6 +647,7 @@ static const GLubyte stipple_3d[] = {
 
 void CRenderSystemGL::SetStereoMode(RenderStereoMode mode, RenderStereoView view)
 {
+  FlushRenderBatch();
   CRenderSystemBase::SetStereoMode(mode, view);
 
   glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -828,6 +842,7 @@ void CRenderSystemGL::ReleaseShaders()
 
 void CRenderSystemGL::EnableShader(ShaderMethodGL method)
 {
+  FlushRenderBatch();
   m_method = method;
   if (m_pShader[m_method])
   {
@@ -197,6 +197,7 @@ bool CRenderSystemGLES::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+  FlushRenderBatch();
   return true;
 }
 
@@ -205,6 +206,8 @@ void CRenderSystemGLES::InvalidateColorBuffer()
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
+
   // some platforms prefer a clear, instead of rendering over
   if (GetClearFunction() == ClearFunction::FIXED_FUNCTION)
     ClearBuffers(0);
@@ -222,6 +225,8 @@ bool CRenderSystemGLES::ClearBuffers(KODI::UTILS::COLOR::Color color)
   if (!m_bRenderCreated)
     return false;
 
+  FlushRenderBatch();
+
   float r = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color) / 255.0f;
   float g = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color) / 255.0f;
   float b = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::B, color) / 255.0f;
@@ -268,6 +273,7 @@ void CRenderSystemGLES::PresentRender(bool rendered, bool videoLayer)
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
   PresentRenderImpl(rendered);
 
   // if video is rendered to a separate layer, we should not block this thread
@@ -298,6 +304,7 @@ void CRenderSystemGLES::CaptureStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
   glMatrixProject.Push();
   glMatrixModview.Push();
   glMatrixTexture.Push();
@@ -327,6 +334,8 @@ void CRenderSystemGLES::SetCameraPosition(const CPoint &camera, int screenWidth,
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
+
   CPoint offset = camera - CPoint(screenWidth*0.5f, screenHeight*0.5f);
 
   float w = (float)m_viewPort[2]*0.5f;
@@ -375,6 +384,7 @@ void CRenderSystemGLES::SetViewPort(const CRect& viewPort)
   if (!m_bRenderCreated)
     return;
 
+  FlushRenderBatch();
   glScissor((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   glViewport((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   m_viewPort[0] = viewPort.x1;
@@ -409,6 +419,8 @@ void CRenderSystemGLES::SetScissors(const CRect &rect)
 {
   if (!m_bRenderCreated)
     return;
+
+  FlushRenderBatch();
   GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1));
   GLint y1 = MathUtils::round_int(static_cast<double>(rect.y1));
   GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2));
@@ -423,6 +435,7 @@ void CRenderSystemGLES::ResetScissors()
 
 void CRenderSystemGLES::SetDepthCulling(DepthCulling culling)
 {
+  FlushRenderBatch();
   if (culling == DepthCulling::OFF)
   {
     glDisable(GL_DEPTH_TEST);
@@ -690,6 +703,7 @@ void CRenderSystemGLES::ReleaseShaders()
 
 void CRenderSystemGLES::EnableGUIShader(ShaderMethodGLES method)
 {
+  FlushRenderBatch();
   m_method = method;
   if (m_pShader[m_method])
   {
@@ -59,6 +59,15 @@ std::vector<CRegExp> CompileRegexesFromXML(const TiXmlElement* folderStacking)
   return CompileRegexes(patterns);
 }
 
+CachedImageFormat CachedImageFormatFromString(const std::string& format)
+{
+  if (StringUtils::EqualsNoCase(format, "raw"))
+    return CachedImageFormat::RAW;
+  if (StringUtils::EqualsNoCase(format, "compressed"))
+    return CachedImageFormat::COMPRESSED;
+  return CachedImageFormat::ORIGINAL;
+}
+
 void ParseDatabaseSettings(const TiXmlElement* element, DatabaseSettings& settings)
 {
   XMLUtils::GetString(element, "type", settings.type);
@@ -74,6 +83,7 @@ void ParseDatabaseSettings(const TiXmlElement* element, DatabaseSettings& settin
   XMLUtils::GetString(element, "ciphers", settings.ciphers);
   XMLUtils::GetUInt(element, "connecttimeout", settings.connecttimeout, 1, 300);
   XMLUtils::GetBoolean(element, "compression", settings.compression);
+  XMLUtils::GetBoolean(element, "columnarresults", settings.columnarresults);
 }
 } // unnamed namespace
 
@@ -373,6 +383,8 @@ void CAdvancedSettings::Initialize()
 
   m_fanartRes = 1080;
   m_imageRes = 720;
+  m_fanartCacheFormat = CachedImageFormat::ORIGINAL;
+  m_imageCacheFormat = CachedImageFormat::ORIGINAL;
   m_imageScalingAlgorithm = CPictureScalingAlgorithm::Default;
   m_imageQualityJpeg = 4;
 
@@ -888,6 +900,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "dateadded", m_iMusicLibraryDateAdded);
     XMLUtils::GetBoolean(pElement, "useisodates", m_bMusicLibraryUseISODates);
     XMLUtils::GetBoolean(pElement, "artistnavigatestosongs", m_bMusicLibraryArtistNavigatesToSongs);
+    XMLUtils::GetInt(pElement, "tagreaderthreads", m_musicLibraryTagReaderThreads, 1, 16);
     // Music artist name separators
     const TiXmlElement* separators = pElement->FirstChildElement("artistseparators");
     if (separators)
@@ -924,6 +937,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   if (pElement)
   {
     XMLUtils::GetBoolean(pElement, "ignoreerrors", m_bVideoScannerIgnoreErrors);
+    XMLUtils::GetInt(pElement, "prefetchthreads", m_videoScannerPrefetchThreads, 0, 16);
   }
 
   // Backward-compatibility of ExternalPlayer config
@@ -1036,6 +1050,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "updateemptytagsinterval", m_iEpgUpdateEmptyTagsInterval);
     XMLUtils::GetBoolean(pElement, "displayupdatepopup", m_bEpgDisplayUpdatePopup);
     XMLUtils::GetBoolean(pElement, "displayincrementalupdatepopup", m_bEpgDisplayIncrementalUpdatePopup);
+    XMLUtils::GetBoolean(pElement, "tagsindex", m_bEpgTagsIndex);
   }
 
   // EDL commercial break handling
@@ -1168,6 +1183,10 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
 
   XMLUtils::GetUInt(pRootElement, "fanartres", m_fanartRes, 0, 9999);
   XMLUtils::GetUInt(pRootElement, "imageres", m_imageRes, 0, 9999);
+  if (XMLUtils::GetString(pRootElement, "fanartcacheformat", tmp))
+    m_fanartCacheFormat = CachedImageFormatFromString(tmp);
+  if (XMLUtils::GetString(pRootElement, "imagecacheformat", tmp))
+    m_imageCacheFormat = CachedImageFormatFromString(tmp);
   if (XMLUtils::GetString(pRootElement, "imagescalingalgorithm", tmp))
     m_imageScalingAlgorithm = CPictureScalingAlgorithm::FromString(tmp);
   XMLUtils::GetUInt(pRootElement, "imagequalityjpeg", m_imageQualityJpeg, 0, 21);
@@ -1293,7 +1312,12 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetBoolean(pElement, "fronttobackrendering", m_guiFrontToBackRendering);
     XMLUtils::GetBoolean(pElement, "geometryclear", m_guiGeometryClear);
     XMLUtils::GetBoolean(pElement, "asynctextureupload", m_guiAsyncTextureUpload);
+    XMLUtils::GetBoolean(pElement, "textureatlas", m_guiTextureAtlas);
+    XMLUtils::GetBoolean(pElement, "batchrendering", m_guiBatchRendering);
+    XMLUtils::GetInt(pElement, "prefetchpages", m_guiPrefetchPages, 0, 10);
     XMLUtils::GetBoolean(pElement, "transparentvideolayout", m_guiVideoLayoutTransparent);
+    XMLUtils::GetBoolean(pElement, "profileconditions", m_guiProfileConditions);
+    XMLUtils::GetBoolean(pElement, "skincache", m_guiSkinCache);
   }
 
   std::string seekSteps;
@@ -55,6 +55,7 @@ public:
     ciphers.clear();
     connecttimeout = DEFAULT_CONNECT_TIMEOUT;
     compression = false;
+    columnarresults = false;
   };
   std::string type;
   std::string host;
@@ -69,6 +70,7 @@ public:
   std::string ciphers;
   unsigned int connecttimeout{DEFAULT_CONNECT_TIMEOUT};
   bool compression;
+  bool columnarresults; // keep query results column by column, see Dataset::set_columnar_results
 };
 
 struct TVShowRegexp
@@ -105,6 +107,14 @@ struct RefreshVideoLatency
   float hdrextradelay;
 };
 
+//! how cached images are stored besides the jpg/png, see CTextureCacheJob::CacheTexture
+enum class CachedImageFormat
+{
+  ORIGINAL, ///< just the jpg/png, decoded on every load
+  RAW, ///< plus the decoded pixels as .dds
+  COMPRESSED ///< plus the pixels as DXT1/DXT5 compressed .dds, if the GPU supports it
+};
+
 using SETTINGS_TVSHOWLIST = std::vector<TVShowRegexp>;
 
 using AdvancedSettingsCallback = std::function<void()>;
@@ -256,6 +266,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
 
     unsigned int m_fanartRes; ///< \brief the maximal resolution to cache fanart at (assumes 16x9)
     unsigned int m_imageRes;  ///< \brief the maximal resolution to cache images at (assumes 16x9)
+    CachedImageFormat m_fanartCacheFormat; ///< \brief how 16x9 images are cached, see m_fanartRes
+    CachedImageFormat m_imageCacheFormat; ///< \brief how other images are cached
     CPictureScalingAlgorithm::Algorithm m_imageScalingAlgorithm;
     unsigned int
         m_imageQualityJpeg; ///< \brief the stored jpeg quality the lower the better (default: 4)
@@ -278,6 +290,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bMusicLibraryArtistSortOnUpdate;
     bool m_bMusicLibraryUseISODates;
     bool m_bMusicLibraryArtistNavigatesToSongs;
+    int m_musicLibraryTagReaderThreads{4}; //!< files read concurrently while scanning tags
     std::string m_strMusicLibraryAlbumFormat;
     bool m_prioritiseAPEv2tags;
     std::string m_musicItemSeparator;
@@ -293,6 +306,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bVideoLibraryImportResumePoint{true};
 
     bool m_bVideoScannerIgnoreErrors;
+    int m_videoScannerPrefetchThreads{4}; //!< directories listed and hashed ahead, 0 disables
     int m_iVideoLibraryDateAdded;
 
     bool m_caseSensitiveLocalArtMatch{true};
@@ -309,6 +323,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iEpgUpdateEmptyTagsInterval; // seconds
     bool m_bEpgDisplayUpdatePopup;
     bool m_bEpgDisplayIncrementalUpdatePopup;
+    bool m_bEpgTagsIndex{false}; ///< serve EPG time window queries from memory
 
     // EDL Commercial Break
     bool m_bEdlMergeShortCommBreaks;
@@ -378,7 +393,12 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_guiFrontToBackRendering{false};
     bool m_guiGeometryClear{true};
     bool m_guiAsyncTextureUpload{false};
+    bool m_guiTextureAtlas{false};
+    bool m_guiBatchRendering{false};
+    int m_guiPrefetchPages{0}; ///< pages of art containers load ahead in the scroll direction
     bool m_guiVideoLayoutTransparent{false};
+    bool m_guiProfileConditions{false}; ///< time skin conditions, logged when the skin is unloaded
+    bool m_guiSkinCache{false}; ///< keep the resolved skin includes and windows on disk
 
     unsigned int m_addonPackageFolderSize;
 
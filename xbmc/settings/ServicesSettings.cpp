@@ -117,6 +117,22 @@ void CServicesSettings::SettingOptionsCacheChunkSizesFiller(const SettingConstPt
   list.emplace_back(StringUtils::Format(mb, 1), 1024 * 1024);
 }
 
+void CServicesSettings::SettingOptionsPersistentSizesFiller(const SettingConstPtr& /*setting*/,
+                                                            std::vector<IntegerSettingOption>& list,
+                                                            int& /*current*/)
+{
+  const std::string& mb = CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(37122);
+  const std::string& gb = CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(37123);
+
+  list.emplace_back(CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(351), 0);
+  list.emplace_back(StringUtils::Format(mb, 128), 128);
+  list.emplace_back(StringUtils::Format(mb, 256), 256);
+  list.emplace_back(StringUtils::Format(mb, 512), 512);
+  list.emplace_back(StringUtils::Format(gb, 1), 1024);
+  list.emplace_back(StringUtils::Format(gb, 2), 2048);
+  list.emplace_back(StringUtils::Format(gb, 4), 4096);
+}
+
 void CServicesSettings::SettingOptionsSmbVersionsFiller(const SettingConstPtr& /*setting*/,
                                                         std::vector<IntegerSettingOption>& list,
                                                         int& /*current*/)
@@ -31,6 +31,9 @@ public:
   static void SettingOptionsCacheChunkSizesFiller(const SettingConstPtr& setting,
                                                   std::vector<IntegerSettingOption>& list,
                                                   int& current);
+  static void SettingOptionsPersistentSizesFiller(const SettingConstPtr& setting,
+                                                  std::vector<IntegerSettingOption>& list,
+                                                  int& current);
   static void SettingOptionsSmbVersionsFiller(const SettingConstPtr& setting,
                                               std::vector<IntegerSettingOption>& list,
                                               int& current);
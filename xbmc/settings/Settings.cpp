@@ -444,6 +444,8 @@ void CSettings::InitializeOptionFillers()
       "filecachereadfactors", CServicesSettings::SettingOptionsReadFactorsFiller);
   GetSettingsManager()->RegisterSettingOptionsFiller(
       "filecachechunksizes", CServicesSettings::SettingOptionsCacheChunkSizesFiller);
+  GetSettingsManager()->RegisterSettingOptionsFiller(
+      "filecachepersistentsizes", CServicesSettings::SettingOptionsPersistentSizesFiller);
   GetSettingsManager()->RegisterSettingOptionsFiller(
       "playerqueuetimesizes", CPlayerSettings::SettingOptionsQueueTimeSizesFiller);
   GetSettingsManager()->RegisterSettingOptionsFiller(
@@ -500,6 +502,7 @@ void CSettings::UninitializeOptionFillers()
   GetSettingsManager()->UnregisterSettingOptionsFiller("filecachememorysizes");
   GetSettingsManager()->UnregisterSettingOptionsFiller("filecachereadfactors");
   GetSettingsManager()->UnregisterSettingOptionsFiller("filecachechunksizes");
+  GetSettingsManager()->UnregisterSettingOptionsFiller("filecachepersistentsizes");
   GetSettingsManager()->UnregisterSettingOptionsFiller("playerqueuetimesizes");
   GetSettingsManager()->UnregisterSettingOptionsFiller("playerqueuedatasizes");
 }
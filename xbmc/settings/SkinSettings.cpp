@@ -25,6 +25,15 @@
 namespace
 {
 constexpr const char* XML_SKINSETTINGS = "skinsettings";
+
+void NotifySettingsChanged()
+{
+  CServiceBroker::GetGUI()
+      ->GetInfoManager()
+      .GetInfoProviders()
+      .GetSkinInfoProvider()
+      .OnSettingsChanged();
+}
 } // unnamed namespace
 
 CSkinSettings::CSkinSettings()
@@ -63,6 +72,7 @@ void CSkinSettings::SetString(int setting, const std::string& label) const
   if (!skin)
     return;
   skin->SetString(setting, label);
+  NotifySettingsChanged();
 }
 
 int CSkinSettings::TranslateBool(const std::string& setting) const
@@ -95,6 +105,7 @@ void CSkinSettings::SetBool(int setting, bool set) const
   if (!skin)
     return;
   skin->SetBool(setting, set);
+  NotifySettingsChanged();
 }
 
 void CSkinSettings::Reset(const std::string& setting) const
@@ -103,6 +114,7 @@ void CSkinSettings::Reset(const std::string& setting) const
   if (!skin)
     return;
   skin->Reset(setting);
+  NotifySettingsChanged();
 }
 
 std::set<ADDON::CSkinSettingPtr> CSkinSettings::GetSettings() const
@@ -137,6 +149,7 @@ void CSkinSettings::Reset() const
     return;
 
   skin->Reset();
+  NotifySettingsChanged();
 
   CGUIInfoManager& infoMgr = CServiceBroker::GetGUI()->GetInfoManager();
   infoMgr.ResetCache();
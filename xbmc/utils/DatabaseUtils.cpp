@@ -16,6 +16,10 @@
 #include "video/VideoDatabase.h"
 #include "video/VideoDatabaseColumns.h"
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <numeric>
 #include <sstream>
 
 MediaType DatabaseUtils::MediaTypeFromVideoContentType(VideoDbContentType videoContentType)
@@ -538,6 +542,77 @@ bool DatabaseUtils::GetFieldValue(const dbiplus::field_value &fieldValue, CVaria
   return false;
 }
 
+namespace
+{
+bool IsYearFromDate(Field field, const MediaType& mediaType)
+{
+  return field == Field::YEAR && (mediaType == MediaTypeTvShow ||
+                                  mediaType == MediaTypeEpisode || mediaType == MediaTypeMovie);
+}
+
+void SetLabel(const MediaType& mediaType, DatabaseResult& result)
+{
+  if (mediaType == MediaTypeMovie || mediaType == MediaTypeVideoCollection ||
+      mediaType == MediaTypeTvShow || mediaType == MediaTypeMusicVideo)
+    result[Field::LABEL] = result.at(Field::TITLE).asString();
+  else if (mediaType == MediaTypeEpisode)
+  {
+    std::ostringstream label;
+    label << (result.at(Field::SEASON).asInteger() * 100 +
+              result.at(Field::EPISODE_NUMBER).asInteger());
+    label << ". ";
+    label << result.at(Field::TITLE).asString();
+    result[Field::LABEL] = label.str();
+  }
+  else if (mediaType == MediaTypeAlbum)
+    result[Field::LABEL] = result.at(Field::ALBUM).asString();
+  else if (mediaType == MediaTypeSong)
+  {
+    std::ostringstream label;
+    label << result.at(Field::TRACK_NUMBER).asInteger();
+    label << ". ";
+    label << result.at(Field::TITLE).asString();
+    result[Field::LABEL] = label.str();
+  }
+  else if (mediaType == MediaTypeArtist)
+    result[Field::LABEL] = result.at(Field::ARTIST).asString();
+}
+
+// the rows are either records or, for columnar datasets, in the column store
+const dbiplus::field_value& GetDatasetValue(const dbiplus::result_set& resultSet,
+                                            unsigned int row,
+                                            int column,
+                                            dbiplus::field_value& buffer)
+{
+  if (!resultSet.columnar)
+    return resultSet.records[row]->at(column);
+
+  resultSet.columns.get(row, column, buffer);
+  return buffer;
+}
+
+bool GetFieldIndexes(const MediaType& mediaType,
+                     const FieldList& fields,
+                     const dbiplus::result_set& resultSet,
+                     std::vector<int>& fieldIndexes)
+{
+  if (resultSet.record_header.size() < fields.size())
+    return false;
+
+  fieldIndexes.reserve(fields.size());
+  for (const auto& field : fields)
+  {
+    const int fieldIndex = DatabaseUtils::GetFieldIndex(field, mediaType);
+    if (fieldIndex < 0)
+      return false;
+
+    fieldIndexes.push_back(fieldIndex);
+  }
+
+  return true;
+}
+} // unnamed namespace
+
 bool DatabaseUtils::GetDatabaseResults(const MediaType& mediaType,
                                        const FieldList& fields,
                                        dbiplus::Dataset& dataset,
@@ -547,12 +622,13 @@ bool DatabaseUtils::GetDatabaseResults(const MediaType& mediaType,
     return true;
 
   const dbiplus::result_set& resultSet = dataset.get_result_set();
+  const auto rows = static_cast<unsigned int>(resultSet.size());
   const auto offset = static_cast<unsigned int>(results.size());
 
   if (fields.empty())
   {
     DatabaseResult result;
-    for (unsigned int index = 0; index < resultSet.records.size(); index++)
+    for (unsigned int index = 0; index < rows; index++)
     {
       result[Field::ROW] = index + offset;
       results.push_back(result);
@@ -561,16 +637,13 @@ bool DatabaseUtils::GetDatabaseResults(const MediaType& mediaType,
     return true;
   }
 
-  if (resultSet.record_header.size() < fields.size())
-    return false;
-
   std::vector<int> fieldIndexLookup;
-  fieldIndexLookup.reserve(fields.size());
-  for (const auto& field : fields)
-    fieldIndexLookup.push_back(GetFieldIndex(field, mediaType));
+  if (!GetFieldIndexes(mediaType, fields, resultSet, fieldIndexLookup))
+    return false;
 
-  results.reserve(resultSet.records.size() + offset);
-  for (unsigned int index = 0; index < resultSet.records.size(); index++)
+  dbiplus::field_value buffer;
+  results.reserve(rows + offset);
+  for (unsigned int index = 0; index < rows; index++)
   {
     DatabaseResult result;
     result[Field::ROW] = index + offset;
@@ -579,20 +652,15 @@ bool DatabaseUtils::GetDatabaseResults(const MediaType& mediaType,
     for (const auto& field : fields)
     {
       const int fieldIndex = fieldIndexLookup[lookupIndex];
-      if (fieldIndex < 0)
-        return false;
-
       lookupIndex++;
 
       std::pair<Field, CVariant> value;
       value.first = field;
-      if (!GetFieldValue(resultSet.records[index]->at(fieldIndex), value.second))
+      if (!GetFieldValue(GetDatasetValue(resultSet, index, fieldIndex, buffer), value.second))
         CLog::Log(LOGWARNING, "GetDatabaseResults: unable to retrieve value of field {}",
                   resultSet.record_header[fieldIndex].name);
 
-      if (value.first == Field::YEAR &&
-          (mediaType == MediaTypeTvShow || mediaType == MediaTypeEpisode ||
-           mediaType == MediaTypeMovie))
+      if (IsYearFromDate(value.first, mediaType))
       {
         CDateTime dateTime;
         dateTime.SetFromDBDate(value.second.asString());
@@ -607,37 +675,207 @@ bool DatabaseUtils::GetDatabaseResults(const MediaType& mediaType,
     }
 
     result[Field::MEDIA_TYPE] = mediaType;
-    if (mediaType == MediaTypeMovie || mediaType == MediaTypeVideoCollection ||
-        mediaType == MediaTypeTvShow || mediaType == MediaTypeMusicVideo)
-      result[Field::LABEL] = result.at(Field::TITLE).asString();
-    else if (mediaType == MediaTypeEpisode)
+    SetLabel(mediaType, result);
+
+    results.push_back(result);
+  }
+
+  return true;
+}
+
+bool DatabaseUtils::GetDatabaseResults(const MediaType& mediaType,
+                                       const FieldList& fields,
+                                       dbiplus::Dataset& dataset,
+                                       CDatabaseResultColumns& results)
+{
+  results.Clear();
+  if (dataset.num_rows() == 0)
+    return true;
+
+  const dbiplus::result_set& resultSet = dataset.get_result_set();
+  const size_t rows = resultSet.size();
+
+  std::vector<int> fieldIndexes;
+  if (!fields.empty() && !GetFieldIndexes(mediaType, fields, resultSet, fieldIndexes))
+    return false;
+
+  results.Reset(mediaType, fields, rows);
+
+  dbiplus::field_value buffer;
+  for (size_t column = 0; column < fields.size(); ++column)
+  {
+    const int fieldIndex = fieldIndexes[column];
+    const bool yearFromDate = IsYearFromDate(fields[column], mediaType);
+    for (size_t row = 0; row < rows; ++row)
     {
-      std::ostringstream label;
-      label << (result.at(Field::SEASON).asInteger() * 100 +
-                result.at(Field::EPISODE_NUMBER).asInteger());
-      label << ". ";
-      label << result.at(Field::TITLE).asString();
-      result[Field::LABEL] = label.str();
+      const dbiplus::field_value& value =
+          GetDatasetValue(resultSet, static_cast<unsigned int>(row), fieldIndex, buffer);
+      if (yearFromDate && !value.get_isNull())
+      {
+        CDateTime dateTime;
+        dateTime.SetFromDBDate(value.get_asString());
+        if (dateTime.IsValid())
+        {
+          results.AddValue(column, dbiplus::field_value(dateTime.GetYear()));
+          continue;
+        }
+      }
+
+      results.AddValue(column, value);
     }
-    else if (mediaType == MediaTypeAlbum)
-      result[Field::LABEL] = result.at(Field::ALBUM).asString();
-    else if (mediaType == MediaTypeSong)
+  }
+
+  return true;
+}
+
+void CDatabaseResultColumns::Clear()
+{
+  m_mediaType.clear();
+  m_columns.clear();
+  m_strings.clear();
+  m_rows.clear();
+}
+
+void CDatabaseResultColumns::Reset(const MediaType& mediaType, const FieldList& fields, size_t rows)
+{
+  Clear();
+  m_mediaType = mediaType;
+
+  m_columns.resize(fields.size());
+  for (size_t i = 0; i < fields.size(); ++i)
+  {
+    m_columns[i].field = fields[i];
+    m_columns[i].kinds.reserve(rows);
+    m_columns[i].values.reserve(rows);
+  }
+
+  m_rows.resize(rows);
+  std::iota(m_rows.begin(), m_rows.end(), 0);
+}
+
+void CDatabaseResultColumns::AddValue(size_t column, const dbiplus::field_value& value)
+{
+  Column& col = m_columns[column];
+  if (value.get_isNull())
+  {
+    col.kinds.emplace_back(Kind::NULL_VALUE);
+    col.values.emplace_back(0);
+    return;
+  }
+
+  // the same conversions as GetFieldValue()
+  switch (value.get_fType())
+  {
+    using enum dbiplus::fType;
+    case ft_String:
+    case ft_WideString:
+    case ft_Object:
     {
-      std::ostringstream label;
-      label << result.at(Field::TRACK_NUMBER).asInteger();
-      label << ". ";
-      label << result.at(Field::TITLE).asString();
-      result[Field::LABEL] = label.str();
+      const std::string str = value.get_asString();
+      const uint32_t length = static_cast<uint32_t>(str.size());
+      col.kinds.emplace_back(Kind::STRING);
+      col.values.emplace_back(m_strings.size());
+      m_strings.append(reinterpret_cast<const char*>(&length), sizeof(length));
+      m_strings.append(str);
+      return;
     }
-    else if (mediaType == MediaTypeArtist)
-      result[Field::LABEL] = result.at(Field::ARTIST).asString();
+    case ft_Char:
+    case ft_WChar:
+      col.kinds.emplace_back(Kind::INTEGER);
+      col.values.emplace_back(static_cast<int64_t>(value.get_asChar()));
+      return;
+    case ft_Boolean:
+      col.kinds.emplace_back(Kind::BOOLEAN);
+      col.values.emplace_back(value.get_asBool() ? 1 : 0);
+      return;
+    case ft_Short:
+    case ft_UShort:
+    case ft_Int:
+    case ft_Int64:
+      col.kinds.emplace_back(Kind::INTEGER);
+      col.values.emplace_back(static_cast<uint64_t>(value.get_asInt64()));
+      return;
+    case ft_UInt:
+      col.kinds.emplace_back(Kind::UNSIGNED_INTEGER);
+      col.values.emplace_back(value.get_asUInt());
+      return;
+    case ft_Float:
+    case ft_Double:
+    case ft_LongDouble:
+      col.kinds.emplace_back(Kind::DOUBLE);
+      col.values.emplace_back(std::bit_cast<uint64_t>(value.get_asDouble()));
+      return;
+  }
 
-    results.push_back(result);
+  col.kinds.emplace_back(Kind::NULL_VALUE);
+  col.values.emplace_back(0);
+}
+
+void CDatabaseResultColumns::GetValue(const Column& column, unsigned int row, CVariant& value) const
+{
+  const uint64_t bits = column.values[row];
+  switch (column.kinds[row])
+  {
+    case Kind::NULL_VALUE:
+      value = CVariant();
+      break;
+    case Kind::INTEGER:
+      value = static_cast<int64_t>(bits);
+      break;
+    case Kind::UNSIGNED_INTEGER:
+      value = bits;
+      break;
+    case Kind::BOOLEAN:
+      value = bits != 0;
+      break;
+    case Kind::DOUBLE:
+      value = std::bit_cast<double>(bits);
+      break;
+    case Kind::STRING:
+    {
+      uint32_t length;
+      std::memcpy(&length, m_strings.data() + bits, sizeof(length));
+      value = std::string(m_strings, bits + sizeof(length), length);
+      break;
+    }
   }
+}
+
+bool CDatabaseResultColumns::GetValue(unsigned int row, Field field, CVariant& value) const
+{
+  const auto column =
+      std::ranges::find_if(m_columns, [field](const auto& col) { return col.field == field; });
+  if (column == m_columns.end())
+    return false;
 
+  GetValue(*column, row, value);
   return true;
 }
 
+void CDatabaseResultColumns::GetResult(unsigned int row, DatabaseResult& result) const
+{
+  result[Field::ROW] = row;
+  if (m_columns.empty())
+    return;
+
+  for (const auto& column : m_columns)
+    GetValue(column, row, result[column.field]);
+
+  result[Field::MEDIA_TYPE] = m_mediaType;
+  SetLabel(m_mediaType, result);
+}
+
+void CDatabaseResultColumns::Limit(int end, int start /* = 0 */)
+{
+  if (start > 0 && static_cast<size_t>(start) < m_rows.size())
+  {
+    m_rows.erase(m_rows.begin(), m_rows.begin() + start);
+    end -= start;
+  }
+  if (end > 0 && static_cast<size_t>(end) < m_rows.size())
+    m_rows.erase(m_rows.begin() + end, m_rows.end());
+}
+
 std::string DatabaseUtils::BuildLimitClause(int end, int start /* = 0 */)
 {
   return " LIMIT " + BuildLimitClauseOnly(end, start);
@@ -10,9 +10,11 @@
 
 #include "media/MediaType.h"
 
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 class CVariant;
@@ -169,6 +171,79 @@ enum class DatabaseQueryPart
 using DatabaseResult = std::map<Field, CVariant>;
 using DatabaseResults = std::vector<DatabaseResult>;
 
+/*!
+ * \brief Results of a database query for sorting and paging, stored column by column.
+ *
+ * Instead of a map of variants per row, every field is one column of typed values and all
+ * strings share one buffer. Rows are referred to by their index in the dataset, sorting and
+ * limiting only reorder and trim the list of those indexes.
+ */
+class CDatabaseResultColumns
+{
+public:
+  void Clear();
+
+  /*!
+   * \brief Number of rows left after sorting and limiting.
+   */
+  size_t Size() const { return m_rows.size(); }
+  bool IsEmpty() const { return m_rows.empty(); }
+
+  /*!
+   * \brief The dataset rows, in their current order.
+   */
+  const std::vector<unsigned int>& GetRows() const { return m_rows; }
+  void SetRows(std::vector<unsigned int> rows) { m_rows = std::move(rows); }
+
+  const MediaType& GetMediaType() const { return m_mediaType; }
+
+  /*!
+   * \brief Get the value of a field in a dataset row.
+   * \return False if the field wasn't retrieved.
+   */
+  bool GetValue(unsigned int row, Field field, CVariant& value) const;
+
+  /*!
+   * \brief Fill a result with all fields of a dataset row, the way GetDatabaseResults() does for
+   * DatabaseResults. Reusing the same result for all rows avoids reallocating it.
+   */
+  void GetResult(unsigned int row, DatabaseResult& result) const;
+
+  /*!
+   * \brief Keep only the rows from start to end, in their current order.
+   */
+  void Limit(int end, int start = 0);
+
+private:
+  friend class DatabaseUtils;
+
+  enum class Kind : uint8_t
+  {
+    NULL_VALUE,
+    INTEGER,
+    UNSIGNED_INTEGER,
+    BOOLEAN,
+    DOUBLE,
+    STRING,
+  };
+
+  struct Column
+  {
+    Field field{Field::NONE};
+    std::vector<Kind> kinds;
+    std::vector<uint64_t> values; // the number, the bits of a double or the string offset
+  };
+
+  void Reset(const MediaType& mediaType, const FieldList& fields, size_t rows);
+  void AddValue(size_t column, const dbiplus::field_value& value);
+  void GetValue(const Column& column, unsigned int row, CVariant& value) const;
+
+  MediaType m_mediaType;
+  std::vector<Column> m_columns;
+  std::string m_strings; // string values, each prefixed with its length
+  std::vector<unsigned int> m_rows;
+};
+
 class DatabaseUtils
 {
 public:
@@ -184,6 +259,10 @@ public:
                                  const FieldList& fields,
                                  dbiplus::Dataset& dataset,
                                  DatabaseResults& results);
+  static bool GetDatabaseResults(const MediaType& mediaType,
+                                 const FieldList& fields,
+                                 dbiplus::Dataset& dataset,
+                                 CDatabaseResultColumns& results);
 
   static std::string BuildLimitClause(int end, int start = 0);
   static std::string BuildLimitClauseOnly(int end, int start = 0);
@@ -18,7 +18,11 @@
 
 #include <algorithm>
 #include <array>
+#include <future>
 #include <limits>
+#include <string>
+#include <thread>
+#include <vector>
 
 std::string ArrayToString(SortAttribute attributes, const CVariant &variant, const std::string &separator = " / ")
 {
@@ -513,143 +517,130 @@ std::string ByBPM(SortAttribute attributes, const SortItem& values)
                              ByLabel(attributes, values));
 }
 
-bool preliminarySort(const SortItem& left,
-                     const SortItem& right,
-                     bool handleFolder,
-                     bool& result,
-                     std::wstring& labelLeft,
-                     std::wstring& labelRight)
+namespace
 {
-  // make sure both items have the necessary data to do the sorting
-  const auto itLeftSort = left.find(Field::SORT);
-  if (itLeftSort == left.end())
-  {
-    result = false;
-    return true;
-  }
-  const auto itRightSort = right.find(Field::SORT);
-  if (itRightSort == right.end())
-  {
-    result = true;
-    return true;
-  }
-
-  // look at special sorting behaviour
-  SortSpecial leftSortSpecial = SortSpecial::NONE;
-  SortSpecial rightSortSpecial = SortSpecial::NONE;
-  if (const auto itLeft = left.find(Field::SORT_SPECIAL);
-      itLeft != left.end() &&
-      itLeft->second.asInteger() <= static_cast<int64_t>(SortSpecial::BOTTOM))
-    leftSortSpecial = static_cast<SortSpecial>(itLeft->second.asInteger());
-  if (const auto itRight = right.find(Field::SORT_SPECIAL);
-      itRight != right.end() &&
-      itRight->second.asInteger() <= static_cast<int64_t>(SortSpecial::BOTTOM))
-    rightSortSpecial = static_cast<SortSpecial>(itRight->second.asInteger());
-
-  // one has a special sort
-  if (leftSortSpecial != rightSortSpecial)
-  {
-    // left should be sorted on top
-    // or right should be sorted on bottom
-    // => left is sorted above right
-    if (leftSortSpecial == SortSpecial::TOP || rightSortSpecial == SortSpecial::BOTTOM)
-    {
-      result = true;
-      return true;
-    }
-
-    // otherwise right is sorted above left
-    result = false;
-    return true;
-  }
-  // both have either sort on top or sort on bottom -> leave as-is
-  else if (leftSortSpecial != SortSpecial::NONE)
-  {
-    result = false;
-    return true;
-  }
+// below this many items per thread, sorting in parallel doesn't pay off
+constexpr size_t PARALLEL_SORT_MIN_ITEMS_PER_THREAD = 10000;
+// the sorting threads are started outside of the job manager, so keep them few
+constexpr size_t PARALLEL_SORT_MAX_THREADS = 4;
 
-  if (handleFolder)
+struct SortKey
+{
+  // SortSpecial::TOP sorts above, SortSpecial::BOTTOM below all others, whatever the sort order
+  enum class Special : uint8_t
   {
-    const auto itLeft = left.find(Field::FOLDER);
-    const auto itRight = right.find(Field::FOLDER);
-    if (itLeft != left.end() && itRight != right.end() &&
-        itLeft->second.asBoolean() != itRight->second.asBoolean())
-    {
-      result = itLeft->second.asBoolean();
-      return true;
-    }
-  }
-
-  labelLeft = itLeftSort->second.asWideString();
-  labelRight = itRightSort->second.asWideString();
+    TOP,
+    NONE,
+    BOTTOM,
+  };
 
-  return false;
-}
+  Special special{Special::NONE};
+  bool hasLabel{false}; // items without Field::SORT sort below all others
+  bool folder{false};
+  std::string label; // StringUtils::AlphaNumericCollationKey of the sort label
+  size_t index{0};
+};
 
-bool SorterAscending(const SortItem &left, const SortItem &right)
+SortKey GetSortKey(const SortItem& item, size_t index)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
-}
+  SortKey key;
+  key.index = index;
 
-bool SorterDescending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
+  if (const auto it = item.find(Field::SORT_SPECIAL);
+      it != item.end() && it->second.asInteger() == static_cast<int64_t>(SortSpecial::TOP))
+    key.special = SortKey::Special::TOP;
+  else if (it != item.end() &&
+           it->second.asInteger() == static_cast<int64_t>(SortSpecial::BOTTOM))
+    key.special = SortKey::Special::BOTTOM;
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
+  if (const auto it = item.find(Field::FOLDER); it != item.end())
+    key.folder = it->second.asBoolean();
 
-bool SorterIgnoreFoldersAscending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
+  if (const auto it = item.find(Field::SORT); it != item.end())
+  {
+    key.hasLabel = true;
+    key.label = StringUtils::AlphaNumericCollationKey(it->second.asWideString());
+  }
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
+  return key;
 }
 
-bool SorterIgnoreFoldersDescending(const SortItem &left, const SortItem &right)
+template<typename Compare>
+void StableSort(std::vector<SortKey>& keys, Compare less)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
+  const size_t threads =
+      std::min({static_cast<size_t>(std::thread::hardware_concurrency()),
+                PARALLEL_SORT_MAX_THREADS, keys.size() / PARALLEL_SORT_MIN_ITEMS_PER_THREAD});
+  if (threads < 2)
+  {
+    std::stable_sort(keys.begin(), keys.end(), less);
+    return;
+  }
 
-bool SorterIndirectAscending(const std::shared_ptr<SortItem>& left,
-                             const std::shared_ptr<SortItem>& right)
-{
-  return SorterAscending(*left, *right);
-}
+  // sort chunks in parallel, then merge neighbouring chunks, which keeps the sort stable
+  std::vector<std::vector<SortKey>::iterator> bounds;
+  for (size_t i = 0; i <= threads; ++i)
+    bounds.emplace_back(keys.begin() + keys.size() * i / threads);
 
-bool SorterIndirectDescending(const std::shared_ptr<SortItem>& left,
-                              const std::shared_ptr<SortItem>& right)
-{
-  return SorterDescending(*left, *right);
-}
+  std::vector<std::future<void>> tasks;
+  for (size_t i = 0; i < threads; ++i)
+    tasks.emplace_back(std::async(std::launch::async, [&bounds, &less, i]()
+                                  { std::stable_sort(bounds[i], bounds[i + 1], less); }));
+  for (auto& task : tasks)
+    task.get();
 
-bool SorterIndirectIgnoreFoldersAscending(const std::shared_ptr<SortItem>& left,
-                                          const std::shared_ptr<SortItem>& right)
-{
-  return SorterIgnoreFoldersAscending(*left, *right);
+  for (size_t width = 1; width < threads; width *= 2)
+  {
+    tasks.clear();
+    for (size_t i = 0; i + width < threads; i += 2 * width)
+    {
+      const auto last = bounds[std::min(i + 2 * width, threads)];
+      tasks.emplace_back(std::async(std::launch::async, [&bounds, &less, i, width, last]()
+                                    { std::inplace_merge(bounds[i], bounds[i + width], last, less); }));
+    }
+    for (auto& task : tasks)
+      task.get();
+  }
 }
 
-bool SorterIndirectIgnoreFoldersDescending(const std::shared_ptr<SortItem>& left,
-                                           const std::shared_ptr<SortItem>& right)
-{
-  return SorterIgnoreFoldersDescending(*left, *right);
-}
+/*!
+ * \brief Sort the items by their Field::SORT label, comparing collation keys built once per item
+ * instead of the labels themselves.
+ */
+template<typename Items, typename GetItem>
+void SortByKeys(Items& items, GetItem getItem, SortOrder sortOrder, SortAttribute attributes)
+{
+  std::vector<SortKey> keys;
+  keys.reserve(items.size());
+  for (size_t i = 0; i < items.size(); ++i)
+    keys.emplace_back(GetSortKey(getItem(items[i]), i));
+
+  const bool handleFolders = !(attributes & SortAttributeIgnoreFolders);
+  const bool descending = sortOrder == SortOrder::DESCENDING;
+  StableSort(keys,
+             [handleFolders, descending](const SortKey& left, const SortKey& right)
+             {
+               if (left.hasLabel != right.hasLabel)
+                 return left.hasLabel;
+               if (!left.hasLabel)
+                 return false;
+               if (left.special != right.special)
+                 return left.special < right.special;
+               if (left.special != SortKey::Special::NONE)
+                 return false;
+               if (handleFolders && left.folder != right.folder)
+                 return left.folder;
+               return descending ? right.label < left.label : left.label < right.label;
+             });
+
+  Items sorted;
+  sorted.reserve(items.size());
+  for (const auto& key : keys)
+    sorted.emplace_back(std::move(items[key.index]));
+
+  items = std::move(sorted);
+}
+} // unnamed namespace
 
 // clang-format off
 std::map<SortBy, SortUtils::SortPreparator> fillPreparators()
@@ -999,7 +990,8 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
       }
 
       // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorter(sortOrder, attributes));
+      SortByKeys(items, [](const SortItem& item) -> const SortItem& { return item; }, sortOrder,
+                 attributes);
     }
   }
 
@@ -1038,7 +1030,9 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
       }
 
       // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorterIndirect(sortOrder, attributes));
+      SortByKeys(
+          items, [](const std::shared_ptr<SortItem>& item) -> const SortItem& { return *item; },
+          sortOrder, attributes);
     }
   }
 
@@ -1063,6 +1057,43 @@ void SortUtils::Sort(const SortDescription &sortDescription, SortItems& items)
        sortDescription.limitEnd, sortDescription.limitStart);
 }
 
+void SortUtils::Sort(const SortDescription& sortDescription, CDatabaseResultColumns& items)
+{
+  if (sortDescription.sortBy != SortBy::NONE)
+  {
+    // get the matching SortPreparator
+    const SortPreparator& preparator = getPreparator(sortDescription.sortBy);
+    if (preparator)
+    {
+      const Fields& sortingFields = GetFieldsForSorting(sortDescription.sortBy);
+
+      // refill the same item for every row instead of keeping a map per row, it's only needed
+      // until the row's sort key is built
+      SortItem item;
+      auto getItem = [&](unsigned int row) -> const SortItem&
+      {
+        items.GetResult(row, item);
+
+        // add all fields to the item that are required for sorting if they are currently missing
+        for (const auto& field : sortingFields)
+          item.try_emplace(field);
+
+        std::wstring sortLabel;
+        g_charsetConverter.utf8ToW(preparator(sortDescription.sortAttributes, item), sortLabel,
+                                   false);
+        item[Field::SORT] = std::move(sortLabel);
+        return item;
+      };
+
+      std::vector<unsigned int> rows = items.GetRows();
+      SortByKeys(rows, getItem, sortDescription.sortOrder, sortDescription.sortAttributes);
+      items.SetRows(std::move(rows));
+    }
+  }
+
+  items.Limit(sortDescription.limitEnd, sortDescription.limitStart);
+}
+
 bool SortUtils::SortFromDataset(const SortDescription& sortDescription,
                                 const MediaType& mediaType,
                                 dbiplus::Dataset& dataset,
@@ -1087,28 +1118,35 @@ bool SortUtils::SortFromDataset(const SortDescription& sortDescription,
   return true;
 }
 
-const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
+bool SortUtils::SortFromDataset(const SortDescription& sortDescription,
+                                const MediaType& mediaType,
+                                dbiplus::Dataset& dataset,
+                                CDatabaseResultColumns& results)
 {
-  const auto it = m_preparators.find(sortBy);
-  return it == m_preparators.end() ? m_preparators[SortBy::NONE] : it->second;
-}
+  FieldList fields;
+  if (!DatabaseUtils::GetSelectFields(SortUtils::GetFieldsForSorting(sortDescription.sortBy),
+                                      mediaType, fields))
+    fields.clear();
 
-SortUtils::Sorter SortUtils::getSorter(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrder::DESCENDING ? SorterIgnoreFoldersDescending
-                                              : SorterIgnoreFoldersAscending;
+  if (!DatabaseUtils::GetDatabaseResults(mediaType, fields, dataset, results))
+    return false;
 
-  return sortOrder == SortOrder::DESCENDING ? SorterDescending : SorterAscending;
+  SortDescription sorting = sortDescription;
+  if (sortDescription.sortBy == SortBy::NONE)
+  {
+    sorting.limitStart = 0;
+    sorting.limitEnd = -1;
+  }
+
+  Sort(sorting, results);
+
+  return true;
 }
 
-SortUtils::SorterIndirect SortUtils::getSorterIndirect(SortOrder sortOrder, SortAttribute attributes)
+const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
 {
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrder::DESCENDING ? SorterIndirectIgnoreFoldersDescending
-                                              : SorterIndirectIgnoreFoldersAscending;
-
-  return sortOrder == SortOrder::DESCENDING ? SorterIndirectDescending : SorterIndirectAscending;
+  const auto it = m_preparators.find(sortBy);
+  return it == m_preparators.end() ? m_preparators[SortBy::NONE] : it->second;
 }
 
 const Fields& SortUtils::GetFieldsForSorting(SortBy sortBy)
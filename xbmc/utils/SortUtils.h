@@ -219,24 +219,24 @@ public:
   static void Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, SortItems& items, int limitEnd = -1, int limitStart = 0);
   static void Sort(const SortDescription &sortDescription, DatabaseResults& items);
   static void Sort(const SortDescription &sortDescription, SortItems& items);
+  static void Sort(const SortDescription& sortDescription, CDatabaseResultColumns& items);
   static bool SortFromDataset(const SortDescription& sortDescription,
                               const MediaType& mediaType,
                               dbiplus::Dataset& dataset,
                               DatabaseResults& results);
+  static bool SortFromDataset(const SortDescription& sortDescription,
+                              const MediaType& mediaType,
+                              dbiplus::Dataset& dataset,
+                              CDatabaseResultColumns& results);
 
   static void GetFieldsForSQLSort(const MediaType& mediaType, SortBy sortMethod, FieldList& fields);
   static const Fields& GetFieldsForSorting(SortBy sortBy);
   static std::string RemoveArticles(const std::string &label);
 
   using SortPreparator = std::function<std::string(SortAttribute, const SortItem&)>;
-  using Sorter = std::function<bool(const SortItem&, const SortItem&)>;
-  using SorterIndirect =
-      std::function<bool(const std::shared_ptr<SortItem>&, const std::shared_ptr<SortItem>&)>;
 
 private:
   static const SortPreparator& getPreparator(SortBy sortBy);
-  static Sorter getSorter(SortOrder sortOrder, SortAttribute attributes);
-  static SorterIndirect getSorterIndirect(SortOrder sortOrder, SortAttribute attributes);
 
   static std::map<SortBy, SortPreparator> m_preparators;
   static std::map<SortBy, Fields> m_sortingFields;
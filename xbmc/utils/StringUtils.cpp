@@ -41,6 +41,7 @@
 #include <functional>
 #include <inttypes.h>
 #include <iomanip>
+#include <locale>
 #include <math.h>
 #include <numeric>
 #include <ranges>
@@ -48,6 +49,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <unordered_map>
 
 #include <fstrcmp.h>
 #include <memory.h>
@@ -1147,6 +1149,130 @@ int64_t StringUtils::AlphaNumericCompare(std::wstring_view left, std::wstring_vi
   return 0; // files are the same
 }
 
+// The elements of an alphanumeric collation key, in the order AlphaNumericCompare sorts them:
+// ascii symbols, characters sorted before the digits, numbers, characters sorted after the digits
+static constexpr char COLLATION_KEY_SYMBOL = 1;
+static constexpr char COLLATION_KEY_BEFORE_DIGITS = 2;
+static constexpr char COLLATION_KEY_NUMBER = 3;
+static constexpr char COLLATION_KEY_AFTER_DIGITS = 4;
+
+static void AppendCollationKeyValue(std::string& key, uint64_t value, int bytes)
+{
+  for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8)
+    key.push_back(static_cast<char>((value >> shift) & 0xFF));
+}
+
+static void AppendCollationKeyNumber(std::string& key, uint64_t number)
+{
+  // 15 digits fit in 7 bytes
+  key.push_back(COLLATION_KEY_NUMBER);
+  AppendCollationKeyValue(key, number, 7);
+}
+
+using CollationKeyElements = std::unordered_map<wchar_t, std::string>;
+
+static CollationKeyElements& GetLocaleCollationKeyElements()
+{
+  // transforming characters with the collate facet is expensive, but labels share most of them
+  // the system locale is a combined one named "*", so compare the locale itself, not its name
+  thread_local std::locale elementsLocale;
+  thread_local CollationKeyElements elements;
+
+  const std::locale& locale = g_langInfo.GetSystemLocale();
+  if (locale != elementsLocale)
+  {
+    elementsLocale = locale;
+    elements.clear();
+  }
+  return elements;
+}
+
+static const std::string& GetLocaleCollationKeyElement(CollationKeyElements& elements, wchar_t c)
+{
+  auto it = elements.find(c);
+  if (it == elements.end())
+  {
+    const std::collate<wchar_t>& coll =
+        std::use_facet<std::collate<wchar_t>>(g_langInfo.GetSystemLocale());
+
+    static constexpr wchar_t zero = L'0';
+
+    std::string element;
+    if (coll.compare(&c, &c + 1, &zero, &zero + 1) < 0)
+      element.push_back(COLLATION_KEY_BEFORE_DIGITS);
+    else
+      element.push_back(COLLATION_KEY_AFTER_DIGITS);
+
+    // transformed strings compare like the characters, a zero terminator sorts shorter ones first
+    for (const wchar_t weight : coll.transform(&c, &c + 1))
+      AppendCollationKeyValue(element, static_cast<uint32_t>(weight), 4);
+    AppendCollationKeyValue(element, 0, 4);
+
+    it = elements.try_emplace(c, std::move(element)).first;
+  }
+  return it->second;
+}
+
+std::string StringUtils::AlphaNumericCollationKey(std::wstring_view str)
+{
+  std::string key;
+  key.reserve(str.size() * 4);
+
+  const bool useLocaleCollation = g_langInfo.UseLocaleCollation();
+  CollationKeyElements* localeElements =
+      useLocaleCollation ? &GetLocaleCollationKeyElements() : nullptr;
+
+  auto it{str.cbegin()};
+  while (it != str.cend())
+  {
+    if (*it >= L'0' && *it <= L'9')
+    {
+      // numbers compare by value, up to 15 digits at once
+      const auto digits = it;
+      uint64_t number{static_cast<uint64_t>(*it++ - L'0')};
+      while (it != str.cend() && *it >= L'0' && *it <= L'9' && std::distance(digits, it) < 15)
+        number = number * 10 + static_cast<uint64_t>(*it++ - L'0');
+
+      AppendCollationKeyNumber(key, number);
+      continue;
+    }
+
+    wchar_t c{*it++};
+    if ((c >= 32 && c < L'0') || (c > L'9' && c < L'A') || (c > L'Z' && c < L'a') ||
+        (c > L'z' && c < 128))
+    {
+      key.push_back(COLLATION_KEY_SYMBOL);
+      key.push_back(static_cast<char>(c));
+      continue;
+    }
+
+    if (!useLocaleCollation && c > 128)
+      c = GetCollationWeight(c);
+    if (c >= L'A' && c <= L'Z')
+      c += L'a' - L'A';
+
+    if (useLocaleCollation)
+      key += GetLocaleCollationKeyElement(*localeElements, c);
+    else if (c < L'0')
+    {
+      key.push_back(COLLATION_KEY_BEFORE_DIGITS);
+      AppendCollationKeyValue(key, static_cast<uint32_t>(c), 3);
+    }
+    else if (c > L'9')
+    {
+      key.push_back(COLLATION_KEY_AFTER_DIGITS);
+      AppendCollationKeyValue(key, static_cast<uint32_t>(c), 3);
+    }
+    else
+    {
+      // folded to a digit, e.g. superscripts
+      AppendCollationKeyNumber(key, static_cast<uint64_t>(c - L'0'));
+    }
+  }
+
+  return key;
+}
+
 /*
   Convert the UTF8 character to which z points into a 31-bit Unicode point.
   Return how many bytes (0 to 3) of UTF8 data encode the character.
@@ -278,6 +278,14 @@ public:
   [[nodiscard]] static int FindNumber(std::string_view strInput, std::string_view strFind) noexcept;
   [[nodiscard]] static int64_t AlphaNumericCompare(std::wstring_view left,
                                                    std::wstring_view right) noexcept;
+  /*! \brief build a binary key of a string, which compares to the keys of other strings like
+   AlphaNumericCompare compares the strings. Sorting by keys built once per string avoids
+   running AlphaNumericCompare on every comparison.
+   \param str the string to build the key of.
+   \return the key, to be compared as a byte string.
+   \sa AlphaNumericCompare
+   */
+  [[nodiscard]] static std::string AlphaNumericCollationKey(std::wstring_view str);
   [[nodiscard]] static int AlphaNumericCollation(int nKey1,
                                                  const void* pKey1,
                                                  int nKey2,
@@ -7,13 +7,29 @@
  */
 
 #include "dbwrappers/qry_dat.h"
+#include "dbwrappers/sqlitedataset.h"
+#include "dbwrappers/test/TestHelpers.h"
 #include "music/MusicDatabase.h"
 #include "utils/DatabaseUtils.h"
+#include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "video/VideoDatabase.h"
 #include "video/VideoDatabaseColumns.h"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 #include <gtest/gtest.h>
 
 class TestDatabaseUtilsHelper
@@ -1231,13 +1247,191 @@ TEST(TestDatabaseUtils, GetFieldValue)
   EXPECT_TRUE(v_string.isString());
 }
 
-//! @todo Need some way to test this function
-// TEST(TestDatabaseUtils, GetDatabaseResults)
-// {
-//   static bool GetDatabaseResults(MediaType mediaType, const FieldList &fields,
-//                                  const std::unique_ptr<dbiplus::Dataset> &dataset,
-//                                  DatabaseResults &results);
-// }
+class TestDatabaseResults : public CSqliteDatabaseTest
+{
+protected:
+  TestDatabaseResults() : CSqliteDatabaseTest("TestDatabaseResults.db") {}
+
+  void SetUp() override
+  {
+    ASSERT_NO_FATAL_FAILURE(CSqliteDatabaseTest::SetUp());
+
+    // a movie view with untyped columns, sqlite keeps the type of every value
+    for (Field field : MOVIE_FIELDS)
+      m_columns = std::max(m_columns, DatabaseUtils::GetFieldIndex(field, MediaTypeMovie) + 1);
+
+    std::string columns;
+    for (int i = 0; i < m_columns; ++i)
+      columns += StringUtils::Format("{}c{}", i > 0 ? ", " : "", i);
+
+    m_ds->exec("DROP TABLE IF EXISTS movie_view");
+    m_ds->exec("CREATE TABLE movie_view (" + columns + ")");
+  }
+
+  void AddMovies(int count)
+  {
+    std::mt19937 random(4711);
+    std::uniform_int_distribution<int> word(0, 999);
+    std::uniform_int_distribution<int> year(1920, 2025);
+    std::uniform_int_distribution<int> rating(0, 100);
+
+    std::string sql = "INSERT INTO movie_view VALUES (?";
+    for (int i = 1; i < m_columns; ++i)
+      sql += ", ?";
+    sql += ")";
+
+    const auto index = [](Field field)
+    { return DatabaseUtils::GetFieldIndex(field, MediaTypeMovie); };
+
+    dbiplus::field_value null;
+    null.set_isNull();
+
+    m_db.start_transaction();
+    for (int i = 1; i <= count; ++i)
+    {
+      dbiplus::BindList values(m_columns, null);
+      values[0] = dbiplus::field_value(i);
+      values[index(Field::TITLE)] = dbiplus::field_value(
+          StringUtils::Format("{} Movie {}", i % 4 == 0 ? "The" : "A", word(random)).c_str());
+      if (i % 3 == 0)
+        values[index(Field::SORT_TITLE)] =
+            dbiplus::field_value(StringUtils::Format("Sorted {}", word(random)).c_str());
+      if (i % 10 != 0)
+        values[index(Field::YEAR)] =
+            dbiplus::field_value(StringUtils::Format("{}-05-01", year(random)).c_str());
+      values[index(Field::RATING)] = dbiplus::field_value(rating(random) / 10.0);
+      if (i % 2 == 0)
+        values[index(Field::PLAYCOUNT)] = dbiplus::field_value(i % 7);
+
+      m_ds->exec(sql, values);
+    }
+    m_db.commit_transaction();
+  }
+
+  bool Query() { return m_ds->query("SELECT * FROM movie_view"); }
+
+  static constexpr std::array MOVIE_FIELDS = {Field::TITLE, Field::SORT_TITLE, Field::YEAR,
+                                              Field::RATING, Field::PLAYCOUNT};
+
+  int m_columns = 1;
+};
+
+TEST_F(TestDatabaseResults, GetDatabaseResults)
+{
+  AddMovies(100);
+  ASSERT_TRUE(Query());
+
+  FieldList fields(TestDatabaseResults::MOVIE_FIELDS.begin(),
+                   TestDatabaseResults::MOVIE_FIELDS.end());
+  DatabaseResults results;
+  ASSERT_TRUE(DatabaseUtils::GetDatabaseResults(MediaTypeMovie, fields, *m_ds, results));
+  CDatabaseResultColumns columns;
+  ASSERT_TRUE(DatabaseUtils::GetDatabaseResults(MediaTypeMovie, fields, *m_ds, columns));
+  ASSERT_EQ(results.size(), columns.Size());
+  EXPECT_EQ(MediaTypeMovie, columns.GetMediaType());
+
+  DatabaseResult result;
+  for (unsigned int row = 0; row < results.size(); ++row)
+  {
+    columns.GetResult(row, result);
+    ASSERT_EQ(results[row].size(), result.size());
+    for (const auto& [field, value] : results[row])
+    {
+      ASSERT_TRUE(result.contains(field));
+      EXPECT_EQ(value.isNull(), result[field].isNull());
+      if (!value.isNull())
+      {
+        EXPECT_EQ(value.type(), result[field].type());
+      }
+      EXPECT_EQ(value.asString(), result[field].asString());
+    }
+  }
+
+  // the year is taken from the date
+  CVariant year;
+  ASSERT_TRUE(columns.GetValue(0, Field::YEAR, year));
+  EXPECT_TRUE(year.isInteger());
+  EXPECT_FALSE(columns.GetValue(0, Field::ALBUM, year));
+}
+
+TEST_F(TestDatabaseResults, SortFromDataset)
+{
+  AddMovies(500);
+  ASSERT_TRUE(Query());
+
+  SortDescription sorting;
+  sorting.limitStart = 40;
+  sorting.limitEnd = 90;
+  for (const auto& [sortBy, sortOrder] :
+       {std::pair{SortBy::TITLE, SortOrder::ASCENDING}, {SortBy::SORT_TITLE, SortOrder::DESCENDING},
+        {SortBy::YEAR, SortOrder::ASCENDING}, {SortBy::RATING, SortOrder::DESCENDING},
+        {SortBy::LABEL, SortOrder::ASCENDING}, {SortBy::NONE, SortOrder::ASCENDING}})
+  {
+    sorting.sortBy = sortBy;
+    sorting.sortOrder = sortOrder;
+
+    DatabaseResults results;
+    ASSERT_TRUE(SortUtils::SortFromDataset(sorting, MediaTypeMovie, *m_ds, results));
+    CDatabaseResultColumns columns;
+    ASSERT_TRUE(SortUtils::SortFromDataset(sorting, MediaTypeMovie, *m_ds, columns));
+
+    std::vector<unsigned int> rows;
+    for (const auto& result : results)
+      rows.emplace_back(static_cast<unsigned int>(result.at(Field::ROW).asInteger()));
+    EXPECT_EQ(rows, columns.GetRows()) << static_cast<int>(sortBy);
+    EXPECT_EQ(sortBy == SortBy::NONE ? 500u : 50u, columns.Size());
+  }
+}
+
+// benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(TestDatabaseResults, DISABLED_SortedPage)
+{
+  constexpr int ROWS = 50000;
+  AddMovies(ROWS);
+  ASSERT_TRUE(Query());
+
+  // the second page of 50 movies by title, as CVideoDatabase::GetMoviesByWhere lists them
+  SortDescription sorting;
+  sorting.sortBy = SortBy::TITLE;
+  sorting.limitStart = 50;
+  sorting.limitEnd = 100;
+
+#if defined(__GLIBC__)
+  auto HeapInUse = [] { return static_cast<long>(mallinfo2().uordblks); };
+#else
+  auto HeapInUse = [] { return 0L; };
+#endif
+
+  FieldList fields;
+  ASSERT_TRUE(DatabaseUtils::GetSelectFields(SortUtils::GetFieldsForSorting(sorting.sortBy),
+                                             MediaTypeMovie, fields));
+
+  // the same steps as SortUtils::SortFromDataset
+  auto Run = [&](auto& results, const char* name)
+  {
+    const long heapBefore = HeapInUse();
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(DatabaseUtils::GetDatabaseResults(MediaTypeMovie, fields, *m_ds, results));
+    const long heapRetrieved = HeapInUse();
+    SortUtils::Sort(sorting, results);
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    std::cout << name << ": " << elapsed.count() << " ms, "
+              << (heapRetrieved - heapBefore) / 1024 << " KiB heap for " << ROWS << " rows\n";
+  };
+
+  {
+    DatabaseResults results;
+    Run(results, "DatabaseResults");
+    EXPECT_EQ(50u, results.size());
+  }
+  {
+    CDatabaseResultColumns columns;
+    Run(columns, "CDatabaseResultColumns");
+    EXPECT_EQ(50u, columns.Size());
+  }
+}
 
 TEST(TestDatabaseUtils, BuildLimitClause)
 {
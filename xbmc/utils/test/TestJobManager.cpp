@@ -13,7 +13,10 @@
 #include "utils/XTimeUtils.h"
 
 #include <atomic>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -62,6 +65,18 @@ public:
   }
 };
 
+class EqualJob : public DummyJob
+{
+public:
+  using DummyJob::DummyJob;
+
+  const char* GetType() const override { return "EqualJob"; }
+  bool Equals(const CJob* job) const override
+  {
+    return std::string(GetType()) == job->GetType();
+  }
+};
+
 class TestJobManager : public testing::Test
 {
 protected:
@@ -211,3 +226,40 @@ TEST_F(TestJobManager, IsProcessing)
 
   job->FinishAndStopBlocking();
 }
+
+TEST_F(TestJobManager, Statistics)
+{
+  const CJobManager::Statistics before = CServiceBroker::GetJobManager()->GetStatistics();
+
+  std::vector<std::unique_ptr<Flags>> flags;
+  for (int i = 0; i < 10; ++i)
+  {
+    flags.emplace_back(std::make_unique<Flags>());
+    CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(flags.back().get()), nullptr);
+  }
+
+  for (const auto& flag : flags)
+    ASSERT_TRUE(poll([&flag]() -> bool { return flag->finished; }));
+
+  const CJobManager::Statistics after = CServiceBroker::GetJobManager()->GetStatistics();
+  EXPECT_EQ(before.jobsStarted + 10, after.jobsStarted);
+  EXPECT_LE(after.jobsStolen, after.jobsStarted);
+  EXPECT_LE(after.maxWaitTime, after.totalWaitTime);
+}
+
+TEST_F(TestJobManager, EqualJobOfOtherPriorityProcessing)
+{
+  Flags flags;
+  const unsigned int id =
+      CServiceBroker::GetJobManager()->AddJob(new EqualJob(&flags), nullptr, CJob::PRIORITY_LOW);
+  ASSERT_TRUE(poll([&flags]() -> bool { return flags.started; }));
+
+  // an equal job is joined to the processing one, whatever its priority
+  Flags otherFlags;
+  EXPECT_EQ(id, CServiceBroker::GetJobManager()->AddJob(new EqualJob(&otherFlags), nullptr,
+                                                        CJob::PRIORITY_HIGH));
+
+  flags.lingerAtWork = false;
+  ASSERT_TRUE(poll([&flags]() -> bool { return flags.finished; }));
+  EXPECT_FALSE(otherFlags.started);
+}
@@ -6,12 +6,15 @@
  *  See LICENSES/README.md for more information.
  */
 
+#include "LangInfo.h"
 #include "utils/StringUtils.h"
 
 #include <algorithm>
 #include <limits>
+#include <locale>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <gtest/gtest.h>
 enum class ECG
@@ -431,6 +434,119 @@ TEST(TestStringUtils, AlphaNumericCompare)
   EXPECT_EQ(StringUtils::AlphaNumericCompare(L"12345678901234567890", L"12345678901234567890"), 0);
 }
 
+namespace
+{
+void ExpectCollationKeysOrderLikeAlphaNumericCompare()
+{
+  const std::vector<std::wstring> strings = {L"123abc",
+                                             L"abc123",
+                                             L"124abc",
+                                             L"123bbc",
+                                             L"bbc123",
+                                             L"2",
+                                             L"12",
+                                             L"012",
+                                             L"ABC123",
+                                             L"!abc",
+                                             L"a b",
+                                             L"a-b",
+                                             L"ab",
+                                             L"\u00E9a",
+                                             L"\u00C9a",
+                                             L"\u00E2b",
+                                             L"ea",
+                                             L"eb",
+                                             L"Ea",
+                                             L"fa",
+                                             L"z",
+                                             L"",
+                                             L"12345678901234567890",
+                                             L"12345678901234567891"};
+
+  for (const auto& left : strings)
+  {
+    for (const auto& right : strings)
+    {
+      const int64_t compare = StringUtils::AlphaNumericCompare(left, right);
+      const std::string leftKey = StringUtils::AlphaNumericCollationKey(left);
+      const std::string rightKey = StringUtils::AlphaNumericCollationKey(right);
+      EXPECT_EQ(compare < 0, leftKey < rightKey);
+      EXPECT_EQ(compare == 0, leftKey == rightKey);
+    }
+  }
+}
+
+// sorts accented latin letters right after their base letter, like the language specific collate
+// facets do
+class AccentFoldingCollate : public std::collate<wchar_t>
+{
+protected:
+  int do_compare(const wchar_t* low1,
+                 const wchar_t* high1,
+                 const wchar_t* low2,
+                 const wchar_t* high2) const override
+  {
+    return do_transform(low1, high1).compare(do_transform(low2, high2));
+  }
+
+  std::wstring do_transform(const wchar_t* low, const wchar_t* high) const override
+  {
+    std::wstring weights;
+    for (; low != high; ++low)
+    {
+      wchar_t c = *low;
+      bool accented = true;
+      if (c >= L'\u00E0' && c <= L'\u00E5')
+        c = L'a';
+      else if (c >= L'\u00E8' && c <= L'\u00EB')
+        c = L'e';
+      else if (c >= L'\u00C8' && c <= L'\u00CB')
+        c = L'E';
+      else
+        accented = false;
+      weights.push_back(static_cast<wchar_t>(c * 2 + (accented ? 1 : 0)));
+    }
+    return weights;
+  }
+};
+} // unnamed namespace
+
+class TestLangInfoHelper
+{
+public:
+  explicit TestLangInfoHelper(const std::locale& locale) : m_locale(g_langInfo.m_systemLocale)
+  {
+    SetSystemLocale(locale);
+  }
+  ~TestLangInfoHelper() { SetSystemLocale(m_locale); }
+
+private:
+  static void SetSystemLocale(const std::locale& locale)
+  {
+    g_langInfo.m_systemLocale = locale;
+    // have the collation to use determined again
+    g_langInfo.m_collationtype = 0;
+  }
+
+  std::locale m_locale;
+};
+
+TEST(TestStringUtils, AlphaNumericCollationKey)
+{
+  // keys must order like AlphaNumericCompare
+  ExpectCollationKeysOrderLikeAlphaNumericCompare();
+}
+
+TEST(TestStringUtils, AlphaNumericCollationKeyLocaleCollation)
+{
+  // keys must order like AlphaNumericCompare when comparing with the collate facet of the locale
+  const TestLangInfoHelper langInfo(
+      std::locale(std::locale::classic(), new AccentFoldingCollate()));
+  ASSERT_TRUE(g_langInfo.UseLocaleCollation());
+
+  ExpectCollationKeysOrderLikeAlphaNumericCompare();
+}
+
 TEST(TestStringUtils, TimeStringToSeconds)
 {
   EXPECT_EQ(77455, StringUtils::TimeStringToSeconds("21:30:55"));
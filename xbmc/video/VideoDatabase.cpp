@@ -138,8 +138,8 @@ int CVideoDatabase::GetPathId(const std::string& strPath)
 
     URIUtils::AddSlashAtEnd(strPath1);
 
-    strSQL=PrepareSQL("select idPath from path where strPath='%s'",strPath1.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "select idPath from path where strPath=?";
+    m_pDS->query(strSQL, Bind(strPath1));
     if (!m_pDS->eof())
       idPath = m_pDS->fv("path.idPath").get_asInt();
 
@@ -300,6 +300,111 @@ int CVideoDatabase::RunQuery(const std::string &sql)
   return rows;
 }
 
+std::vector<int> CVideoDatabase::GetSkippedColumns(const MediaType& mediaType, int getDetails)
+{
+  std::vector<int> columns;
+  if (mediaType == MediaTypeMovie)
+  {
+    if (getDetails & VideoDbSkipPlot)
+      columns.insert(columns.end(), {VIDEODB_ID_PLOT, VIDEODB_ID_PLOTOUTLINE, VIDEODB_ID_TAGLINE});
+    if (getDetails & VideoDbSkipCredits)
+      columns.insert(columns.end(), {VIDEODB_ID_CREDITS, VIDEODB_ID_DIRECTOR});
+    if (getDetails & VideoDbSkipArtUrls)
+      columns.insert(columns.end(), {VIDEODB_ID_THUMBURL, VIDEODB_ID_FANART});
+    if (getDetails & VideoDbSkipTrailer)
+      columns.emplace_back(VIDEODB_ID_TRAILER);
+  }
+  else if (mediaType == MediaTypeEpisode)
+  {
+    if (getDetails & VideoDbSkipPlot)
+      columns.emplace_back(VIDEODB_ID_EPISODE_PLOT);
+    if (getDetails & VideoDbSkipCredits)
+      columns.insert(columns.end(), {VIDEODB_ID_EPISODE_CREDITS, VIDEODB_ID_EPISODE_DIRECTOR});
+    if (getDetails & VideoDbSkipArtUrls)
+      columns.emplace_back(VIDEODB_ID_EPISODE_THUMBURL);
+  }
+  return columns;
+}
+
+std::string CVideoDatabase::GetProjectedFields(const std::string& view,
+                                               const std::vector<int>& skippedColumns)
+{
+  if (skippedColumns.empty())
+    return "*";
+
+  auto it = m_viewColumns.find(view);
+  if (it == m_viewColumns.end())
+  {
+    // an empty result still has the column names
+    if (!m_pDS2->query(PrepareSQL("SELECT * FROM %s LIMIT 0", view.c_str())))
+      return "*";
+
+    std::vector<std::string> names;
+    for (const auto& field : m_pDS2->get_result_set().record_header)
+      names.emplace_back(field.name);
+    m_pDS2->close();
+    it = m_viewColumns.try_emplace(view, std::move(names)).first;
+  }
+
+  std::set<std::string, std::less<>> skipped;
+  for (int column : skippedColumns)
+    skipped.emplace(StringUtils::Format("c{:02}", column));
+
+  std::vector<std::string> fields;
+  fields.reserve(it->second.size());
+  for (const auto& name : it->second)
+  {
+    if (skipped.contains(name))
+      fields.emplace_back("NULL AS " + name);
+    else
+      fields.emplace_back(view + "." + name);
+  }
+  return StringUtils::Join(fields, ", ");
+}
+
+bool CVideoDatabase::GetSkippedDetails(CVideoInfoTag& details)
+{
+  const int skipped = details.m_parsedDetails & VideoDbSkipColumns;
+  if (!skipped)
+    return true;
+
+  const bool isMovie = details.m_type == MediaTypeMovie;
+  if (!isMovie && details.m_type != MediaTypeEpisode)
+    return false;
+
+  try
+  {
+    if (!m_pDB || !m_pDS2)
+      return false;
+
+    const std::string sql = isMovie ? "SELECT * FROM movie WHERE idMovie=?"
+                                    : "SELECT * FROM episode WHERE idEpisode=?";
+    if (!m_pDS2->query(sql, Bind(details.m_iDbId)) || m_pDS2->eof())
+    {
+      m_pDS2->close();
+      return false;
+    }
+
+    const dbiplus::sql_record* const record = m_pDS2->get_sql_record();
+    for (int column : GetSkippedColumns(details.m_type, skipped))
+    {
+      if (isMovie)
+        GetDetailsFromDB(record, column - 1, column + 1, DbMovieOffsets, details);
+      else
+        GetDetailsFromDB(record, column - 1, column + 1, DbEpisodeOffsets, details);
+    }
+    m_pDS2->close();
+
+    details.m_parsedDetails &= ~VideoDbSkipColumns;
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed for {} {}", details.m_type, details.m_iDbId);
+  }
+  return false;
+}
+
 bool CVideoDatabase::GetSubPaths(const std::string &basepath, std::vector<std::pair<int, std::string>>& subpaths)
 {
   std::string sql;
@@ -769,9 +874,8 @@ int CVideoDatabase::GetFileId(const std::string& strFilenameAndPath)
     int idPath = GetPathId(strPath);
     if (idPath >= 0)
     {
-      std::string strSQL;
-      strSQL=PrepareSQL("select idFile from files where strFileName='%s' and idPath=%i", strFileName.c_str(),idPath);
-      m_pDS->query(strSQL);
+      m_pDS->query("select idFile from files where strFileName=? and idPath=?",
+                   Bind(strFileName, idPath));
       if (m_pDS->num_rows() > 0)
       {
         int idFile = m_pDS->fv("files.idFile").get_asInt();
@@ -1515,12 +1619,13 @@ void CVideoDatabase::AddLinkToActor(int mediaId, const char *mediaType, int acto
 void CVideoDatabase::AddToLinkTable(int mediaId, const std::string& mediaType, const std::string& table, int valueId, const char *foreignKey)
 {
   const char *key = foreignKey ? foreignKey : table.c_str();
-  std::string sql = PrepareSQL("SELECT 1 FROM %s_link WHERE %s_id=%i AND media_id=%i AND media_type='%s'", table.c_str(), key, valueId, mediaId, mediaType.c_str());
+  const BindList params = Bind(valueId, mediaId, mediaType);
+  std::string sql = PrepareSQL("SELECT 1 FROM %s_link WHERE %s_id=? AND media_id=? AND media_type=?", table.c_str(), key);
 
-  if (GetSingleValue(sql).empty())
+  if (GetSingleValue(sql, params).empty())
   { // doesn't exists, add it
-    sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(%i,%i,'%s')", table.c_str(), key, valueId, mediaId, mediaType.c_str());
-    ExecuteQuery(sql);
+    sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(?,?,?)", table.c_str(), key);
+    ExecuteQuery(sql, params);
   }
 }
 
@@ -4999,8 +5104,7 @@ bool CVideoDatabase::GetVideoSettings(int idFile, CVideoSettings &settings)
     if (nullptr == m_pDS)
       return false;
 
-    std::string strSQL=PrepareSQL("select * from settings where settings.idFile = '%i'", idFile);
-    m_pDS->query( strSQL );
+    m_pDS->query("select * from settings where settings.idFile = ?", Bind(idFile));
 
     if (m_pDS->num_rows() > 0)
     { // get the video settings info
@@ -7756,7 +7860,13 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
       strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
     }
 
-    strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
+    // leave out the long columns the caller doesn't need, keeping the layout of the rows
+    if (extFilter.fields.empty() || extFilter.fields == "*")
+      extFilter.fields = GetProjectedFields("movie_view", GetSkippedColumns(MediaTypeMovie, getDetails));
+    else
+      getDetails &= ~VideoDbSkipColumns;
+
+    strSQL = PrepareSQL(strSQL, extFilter.fields.c_str()) + strSQLExtra;
 
     int iRowsFound = RunQuery(strSQL);
 
@@ -7768,19 +7878,18 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
     if (iRowsFound <= 0)
       return iRowsFound == 0;
 
-    DatabaseResults results;
-    results.reserve(iRowsFound);
+    CDatabaseResultColumns results;
 
     if (!SortUtils::SortFromDataset(sortDescription, MediaTypeMovie, *m_pDS, results))
       return false;
 
     // get data from returned rows
-    items.Reserve(results.size());
-    const query_data &data = m_pDS->get_result_set().records;
-    for (const auto &i : results)
+    items.Reserve(results.Size());
+    for (const unsigned int targetRow : results.GetRows())
     {
-      const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_sql_record(targetRow);
+      if (!record)
+        continue;
 
       CVideoInfoTag movie = GetDetailsForMovie(record, getDetails);
       if (m_profileManager.GetMasterProfile().getLockMode() == LockMode::EVERYONE ||
@@ -7914,18 +8023,17 @@ bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filt
     if (iRowsFound <= 0)
       return iRowsFound == 0;
 
-    DatabaseResults results;
-    results.reserve(iRowsFound);
+    CDatabaseResultColumns results;
     if (!SortUtils::SortFromDataset(sorting, MediaTypeTvShow, *m_pDS, results))
       return false;
 
     // get data from returned rows
-    items.Reserve(results.size());
-    const query_data &data = m_pDS->get_result_set().records;
-    for (const auto &i : results)
+    items.Reserve(results.Size());
+    for (const unsigned int targetRow : results.GetRows())
     {
-      const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_sql_record(targetRow);
+      if (!record)
+        continue;
 
       auto pItem = std::make_shared<CFileItem>();
       CVideoInfoTag movie = GetDetailsForTvShow(record, getDetails, pItem.get());
@@ -8031,7 +8139,14 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
       strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
     }
 
-    strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
+    // leave out the long columns the caller doesn't need, keeping the layout of the rows
+    if (extFilter.fields.empty() || extFilter.fields == "*")
+      extFilter.fields =
+          GetProjectedFields("episode_view", GetSkippedColumns(MediaTypeEpisode, getDetails));
+    else
+      getDetails &= ~VideoDbSkipColumns;
+
+    strSQL = PrepareSQL(strSQL, extFilter.fields.c_str()) + strSQLExtra;
 
     int iRowsFound = RunQuery(strSQL);
 
@@ -8043,20 +8158,19 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
     if (iRowsFound <= 0)
       return iRowsFound == 0;
 
-    DatabaseResults results;
-    results.reserve(iRowsFound);
+    CDatabaseResultColumns results;
     if (!SortUtils::SortFromDataset(sorting, MediaTypeEpisode, *m_pDS, results))
       return false;
 
     // get data from returned rows
-    items.Reserve(results.size());
+    items.Reserve(results.Size());
     CLabelFormatter formatter("%H. %T", "");
 
-    const query_data &data = m_pDS->get_result_set().records;
-    for (const auto &i : results)
+    for (const unsigned int targetRow : results.GetRows())
     {
-      const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_sql_record(targetRow);
+      if (!record)
+        continue;
 
       CVideoInfoTag episode = GetDetailsForEpisode(record, getDetails);
       if (m_profileManager.GetMasterProfile().getLockMode() == LockMode::EVERYONE ||
@@ -9025,19 +9139,18 @@ bool CVideoDatabase::GetMusicVideosByWhere(const std::string &baseDir, const Fil
     if (iRowsFound <= 0)
       return iRowsFound == 0;
 
-    DatabaseResults results;
-    results.reserve(iRowsFound);
+    CDatabaseResultColumns results;
     if (!SortUtils::SortFromDataset(sorting, MediaTypeMusicVideo, *m_pDS, results))
       return false;
 
     // get data from returned rows
-    items.Reserve(results.size());
+    items.Reserve(results.Size());
     // get songs from returned subtable
-    const query_data &data = m_pDS->get_result_set().records;
-    for (const auto &i : results)
+    for (const unsigned int targetRow : results.GetRows())
     {
-      const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_sql_record(targetRow);
+      if (!record)
+        continue;
 
       CVideoInfoTag musicvideo = GetDetailsForMusicVideo(record, getDetails);
       if (!checkLocks || m_profileManager.GetMasterProfile().getLockMode() == LockMode::EVERYONE ||
@@ -64,7 +64,14 @@ enum VideoDbDetails
   VideoDbDetailsCast     = 0x10,
   VideoDbDetailsBookmark = 0x20,
   VideoDbDetailsUniqueID = 0x40,
-  VideoDbDetailsAll      = 0xFF
+  VideoDbDetailsAll      = 0xFF,
+  // long columns that movie and episode lists may leave out, not part of VideoDbDetailsAll.
+  // See CVideoDatabase::GetSkippedDetails() to load them later on, CVideoThumbLoader does so.
+  VideoDbSkipPlot        = 0x100, // plot, plot outline and tagline
+  VideoDbSkipCredits     = 0x200, // writers and directors
+  VideoDbSkipArtUrls     = 0x400, // scraped thumb and fanart urls
+  VideoDbSkipTrailer     = 0x800,
+  VideoDbSkipColumns     = 0xF00
 } ;
 
 enum class VideoDbContentType
@@ -519,6 +526,12 @@ public:
   bool GetDetailsByTypeAndId(CFileItem& item, VideoDbContentType type, int id);
   CVideoInfoTag GetDetailsByTypeAndId(VideoDbContentType type, int id);
 
+  /*! \brief Load the columns a movie or episode list left out, see VideoDbSkipColumns.
+   \param details the tag to complete, unchanged if nothing was left out.
+   \return true if the tag is complete, false on error.
+   */
+  bool GetSkippedDetails(CVideoInfoTag& details);
+
   // scraper settings
   struct StringHash
   {
@@ -1182,6 +1195,21 @@ private:
    */
   int RunQuery(const std::string &sql);
 
+  /*! \brief Get the columns of a movie or episode view that are left out by VideoDbSkipColumns.
+   \param mediaType movie or episode.
+   \param getDetails the requested details.
+   \return the indices of the skipped columns in the media table, i.e. VIDEODB_ID_*.
+   */
+  static std::vector<int> GetSkippedColumns(const MediaType& mediaType, int getDetails);
+
+  /*! \brief Build the select list of a view with some columns replaced by NULL.
+   The columns keep their position and name, so rows can be read as if all columns were selected.
+   \param view the view to select from.
+   \param skippedColumns the indices of the media table columns to leave out.
+   \return the select list, "*" on error.
+   */
+  std::string GetProjectedFields(const std::string& view, const std::vector<int>& skippedColumns);
+
   void AppendIdLinkFilter(const char* field,
                           const char* table,
                           const MediaType& mediaType,
@@ -1246,4 +1274,6 @@ private:
   static void AnnounceUpdate(const std::string& content, int id);
 
   static CDateTime GetDateAdded(const std::string& filename, CDateTime dateAdded = CDateTime());
+
+  std::unordered_map<std::string, std::vector<std::string>> m_viewColumns; ///< column names by view
 };
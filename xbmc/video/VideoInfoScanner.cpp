@@ -31,6 +31,7 @@
 #include "guilib/GUIWindowManager.h"
 #include "imagefiles/ImageFileURL.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobQueue.h"
 #include "messaging/helpers/DialogHelper.h"
 #include "messaging/helpers/DialogOKHelper.h"
 #include "playlists/PlayListFileItemClassify.h"
@@ -41,6 +42,8 @@
 #include "settings/SettingsComponent.h"
 #include "tags/SetInfoTagLoaderFactory.h"
 #include "tags/VideoInfoTagLoaderFactory.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
 #include "utils/ArtUtils.h"
 #include "utils/Digest.h"
 #include "utils/FileExtensionProvider.h"
@@ -59,6 +62,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <ranges>
 #include <set>
 #include <string>
@@ -73,6 +77,8 @@ using namespace KODI;
 using KODI::MESSAGING::HELPERS::DialogResponse;
 using KODI::UTILITY::CDigest;
 
+using namespace std::chrono_literals;
+
 namespace
 {
 
@@ -228,11 +234,159 @@ void OnDirectoryScanned(const std::string& strDirectory)
   CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg);
 }
 
+void GetMoviesDirectory(const std::string& strDirectory, CFileItemList& items)
+{
+  CDirectory::GetDirectory(strDirectory, items,
+                           CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
+                           DIR_FLAG_DEFAULTS);
+  // do not consider inner folders with .nomedia
+  items.erase(std::remove_if(items.begin(), items.end(),
+                             [](const CFileItemPtr& item)
+                             { return item->IsFolder() && CInfoScanner::HasNoMedia(item->GetPath()); }),
+              items.end());
+  items.Stack();
+
+  // force sorting consistency to avoid hash mismatch between platforms
+  // sort by filename as always present for any files, but keep case sensitivity
+  items.Sort(SortBy::FILE, SortOrder::ASCENDING, SortAttributeNone);
+}
+
+void GetTvShowDirectory(const std::string& strDirectory, CFileItemList& items)
+{
+  CDirectory::GetDirectory(strDirectory, items,
+                           CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
+                           DIR_FLAG_DEFAULTS);
+  items.SetPath(strDirectory);
+
+  // force sorting consistency to avoid hash mismatch between platforms
+  // sort by filename as always present for any files, but keep case sensitivity
+  items.Sort(SortBy::FILE, SortOrder::ASCENDING, SortAttributeNone);
+}
+
+std::chrono::microseconds ElapsedSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                               start);
+}
+
+int64_t ToMs(std::chrono::microseconds duration)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+}
+
 } // namespace
 
 namespace KODI::VIDEO
 {
 
+struct CVideoInfoScanner::DirectoryProbe
+{
+  // request, filled on the scanner thread
+  std::string path;
+  ContentType content{ContentType::NONE};
+  bool listTvShow{false};
+  bool useFastHash{false};
+  std::vector<std::string> excludes;
+  std::string dbHash;
+
+  // result, filled by ProbeDirectory()
+  bool exists{false};
+  bool noMedia{false};
+  bool hashed{false};
+  std::string fastHash;
+  bool listed{false};
+  CFileItemList items;
+  std::chrono::microseconds duration{0};
+};
+
+class CVideoInfoScanner::CDirectoryPrefetcher
+{
+public:
+  explicit CDirectoryPrefetcher(unsigned int workers)
+    : m_jobs(false, workers, CJob::PRIORITY_DEDICATED),
+      m_state(std::make_shared<State>())
+  {
+  }
+
+  size_t Pending() const
+  {
+    std::unique_lock lock(m_state->section);
+    return m_state->probes.size();
+  }
+
+  void Queue(const std::shared_ptr<DirectoryProbe>& probe)
+  {
+    {
+      std::unique_lock lock(m_state->section);
+      if (!m_state->probes.try_emplace(probe->path, Entry{probe, false}).second)
+        return;
+    }
+
+    m_jobs.Submit(
+        [state = m_state, probe]()
+        {
+          ProbeDirectory(*probe);
+
+          std::unique_lock lock(state->section);
+          const auto it = state->probes.find(probe->path);
+          if (it != state->probes.end() && it->second.probe == probe)
+            it->second.done = true;
+          state->done.Set();
+        });
+  }
+
+  std::shared_ptr<DirectoryProbe> Take(const std::string& path,
+                                       const bool& stop,
+                                       std::chrono::microseconds& waited)
+  {
+    std::unique_lock lock(m_state->section);
+    const auto it = m_state->probes.find(path);
+    if (it == m_state->probes.end())
+      return {};
+
+    const auto start = std::chrono::steady_clock::now();
+    while (!it->second.done && !stop)
+    {
+      lock.unlock();
+      m_state->done.Wait(100ms);
+      lock.lock();
+    }
+    waited += ElapsedSince(start);
+
+    std::shared_ptr<DirectoryProbe> probe;
+    if (it->second.done)
+      probe = std::move(it->second.probe);
+    m_state->probes.erase(it);
+    return probe;
+  }
+
+  /*! \brief Drop probes of paths that were removed from the scan, e.g. by recursing into them */
+  void Purge(const std::set<std::string, std::less<>>& paths)
+  {
+    std::unique_lock lock(m_state->section);
+    std::erase_if(m_state->probes, [&paths](const auto& entry)
+                  { return !paths.contains(entry.first); });
+  }
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<DirectoryProbe> probe;
+    bool done{false};
+  };
+
+  // shared with the jobs, which may still run when the scan is finished
+  struct State
+  {
+    CCriticalSection section;
+    CEvent done;
+    std::unordered_map<std::string, Entry> probes;
+  };
+
+  CJobQueue m_jobs;
+  std::shared_ptr<State> m_state;
+};
+
 CVideoInfoScanner::CVideoInfoScanner()
   : m_advancedSettings(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings())
 {
@@ -288,6 +442,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       m_database.Open();
 
+      m_timings = {};
+      m_prefetchCursor.clear();
+      if (m_advancedSettings->m_videoScannerPrefetchThreads > 0)
+        m_prefetcher = std::make_unique<CDirectoryPrefetcher>(
+            static_cast<unsigned int>(m_advancedSettings->m_videoScannerPrefetchThreads));
+
       m_bCanInterrupt = true;
 
       CLog::Log(LOGINFO, "VideoInfoScanner: Starting scan ..");
@@ -309,11 +469,13 @@ CVideoInfoScanner::~CVideoInfoScanner()
          * occurs.
          */
         std::string directory = *m_pathsToScan.begin();
+        PrefetchDirectories();
+        const std::shared_ptr<DirectoryProbe> probe = TakePrefetched(directory);
         if (m_bStop)
         {
           bCancelled = true;
         }
-        else if (!CDirectory::Exists(directory))
+        else if (!(probe ? probe->exists : CDirectory::Exists(directory)))
         {
           /*
            * Note that this will skip clean (if m_bClean is enabled) if the directory really
@@ -324,12 +486,15 @@ CVideoInfoScanner::~CVideoInfoScanner()
                     CURL::GetRedacted(directory), m_bClean ? " and clean" : "");
           m_pathsToScan.erase(m_pathsToScan.begin());
         }
-        else if (!DoScan(directory))
+        else if (!DoScan(directory, probe))
           bCancelled = true;
       }
 
+      m_prefetcher.reset();
+
       if (!bCancelled)
       {
+        const auto cleanStart = std::chrono::steady_clock::now();
         if (m_bClean)
           m_database.CleanDatabase(m_handle, m_pathsToClean, false);
         else
@@ -339,6 +504,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
                 CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(331));
           m_database.Compress(false);
         }
+        m_timings.clean = ElapsedSince(cleanStart);
       }
 
       CServiceBroker::GetGUI()->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider().ResetLibraryBools();
@@ -349,12 +515,19 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       CLog::Log(LOGINFO, "VideoInfoScanner: Finished scan. Scanning for video info took {} ms",
                 duration.count());
+      CLog::Log(LOGINFO,
+                "VideoInfoScanner: {} directories ({} prefetched) - listing and hashing {} ms, "
+                "waiting for prefetch {} ms, retrieving info {} ms, cleaning {} ms",
+                m_timings.directories, m_timings.prefetched, ToMs(m_timings.enumerate),
+                ToMs(m_timings.wait), ToMs(m_timings.retrieve), ToMs(m_timings.clean));
     }
     catch (...)
     {
       CLog::Log(LOGERROR, "VideoInfoScanner: Exception while scanning.");
     }
 
+    m_prefetcher.reset();
+
     m_bRunning = false;
     CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::VideoLibrary,
                                                        "OnScanFinished");
@@ -408,8 +581,112 @@ CVideoInfoScanner::~CVideoInfoScanner()
     m_bStop = true;
   }
 
+  void CVideoInfoScanner::PrefetchDirectories()
+  {
+    if (!m_prefetcher)
+      return;
+
+    m_prefetcher->Purge(m_pathsToScan);
+
+    // keep enough directories queued to keep all workers busy while one is scanned
+    const size_t window = 4 * static_cast<size_t>(m_advancedSettings->m_videoScannerPrefetchThreads);
+    for (auto it = m_pathsToScan.upper_bound(m_prefetchCursor);
+         it != m_pathsToScan.end() && m_prefetcher->Pending() < window; ++it)
+    {
+      const std::string& path = *it;
+      m_prefetchCursor = path;
+
+      // plugins are left to the scanner thread
+      if (URIUtils::IsPlugin(path))
+        continue;
+
+      SScanSettings settings;
+      bool foundDirectly = false;
+      const ScraperPtr info =
+          m_database.GetScraperForPath(path, settings, foundDirectly, &m_scraperCache);
+      const ContentType content = info ? info->Content() : ContentType::NONE;
+      if (content == ContentType::NONE || (!m_scanAll && settings.noupdate))
+        continue;
+
+      const std::vector<std::string>& regexps =
+          content == ContentType::TVSHOWS ? m_advancedSettings->m_tvshowExcludeFromScanRegExps
+                                          : m_advancedSettings->m_moviesExcludeFromScanRegExps;
+      if (CUtil::ExcludeFileOrFolder(path, regexps))
+        continue;
+
+      auto probe = std::make_shared<DirectoryProbe>();
+      probe->path = path;
+      probe->content = content;
+      probe->listTvShow = foundDirectly && !settings.parent_name_root;
+      probe->useFastHash = m_advancedSettings->m_bVideoLibraryUseFastHash;
+      probe->excludes = regexps;
+      if (content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS)
+        m_database.GetPathHash(path, probe->dbHash);
+
+      m_prefetcher->Queue(probe);
+    }
+  }
+
+  std::shared_ptr<CVideoInfoScanner::DirectoryProbe> CVideoInfoScanner::TakePrefetched(
+      const std::string& strDirectory)
+  {
+    if (!m_prefetcher)
+      return {};
+
+    auto probe = m_prefetcher->Take(strDirectory, m_bStop, m_timings.wait);
+    if (probe)
+    {
+      m_timings.enumerate += probe->duration;
+      m_timings.prefetched++;
+    }
+    return probe;
+  }
+
+  void CVideoInfoScanner::ProbeDirectory(DirectoryProbe& probe)
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    probe.exists = CDirectory::Exists(probe.path);
+    if (probe.exists)
+      probe.noMedia = HasNoMedia(probe.path);
+
+    if (probe.exists && !probe.noMedia)
+    {
+      if (probe.content == ContentType::MOVIES || probe.content == ContentType::MUSICVIDEOS)
+      {
+        if (probe.useFastHash)
+        {
+          probe.fastHash = GetFastHash(probe.path, probe.excludes);
+          probe.hashed = true;
+        }
+
+        // the listing is only needed when the fast hash doesn't show the folder as unchanged
+        if (probe.fastHash.empty() || !StringUtils::EqualsNoCase(probe.fastHash, probe.dbHash))
+        {
+          GetMoviesDirectory(probe.path, probe.items);
+          probe.listed = true;
+        }
+      }
+      else if (probe.content == ContentType::TVSHOWS && probe.listTvShow)
+      {
+        GetTvShowDirectory(probe.path, probe.items);
+        probe.listed = true;
+      }
+    }
+
+    probe.duration = ElapsedSince(start);
+  }
+
   bool CVideoInfoScanner::DoScan(const std::string& strDirectory)
   {
+    return DoScan(strDirectory, TakePrefetched(strDirectory));
+  }
+
+  bool CVideoInfoScanner::DoScan(const std::string& strDirectory,
+                                 const std::shared_ptr<DirectoryProbe>& probe)
+  {
+    m_timings.directories++;
+
     if (m_handle)
     {
       m_handle->SetText(CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(20415));
@@ -442,7 +719,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
     if (CUtil::ExcludeFileOrFolder(strDirectory, regexps))
       return true;
 
-    if (HasNoMedia(strDirectory))
+    if (probe ? probe->noMedia : HasNoMedia(strDirectory))
       return true;
 
     bool ignoreFolder = !m_scanAll && settings.noupdate;
@@ -468,9 +745,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
             CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(str), info->Name()));
       }
 
+      const auto start = std::chrono::steady_clock::now();
+      const bool prefetched = probe && probe->content == content;
+
       std::string fastHash;
       if (m_advancedSettings->m_bVideoLibraryUseFastHash && !URIUtils::IsPlugin(strDirectory))
-        fastHash = GetFastHash(strDirectory, regexps);
+        fastHash = prefetched && probe->hashed ? probe->fastHash : GetFastHash(strDirectory, regexps);
 
       if (m_database.GetPathHash(strDirectory, dbHash) && !fastHash.empty() && StringUtils::EqualsNoCase(fastHash, dbHash))
       { // fast hashes match - no need to process anything
@@ -478,17 +758,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
       }
       else
       { // need to fetch the folder
-        CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
-                                 DIR_FLAG_DEFAULTS);
-        // do not consider inner folders with .nomedia
-        items.erase(std::remove_if(items.begin(), items.end(), [](const CFileItemPtr& item)
-                                   { return item->IsFolder() && HasNoMedia(item->GetPath()); }),
-                    items.end());
-        items.Stack();
-
-        // force sorting consistency to avoid hash mismatch between platforms
-        // sort by filename as always present for any files, but keep case sensitivity
-        items.Sort(SortBy::FILE, SortOrder::ASCENDING, SortAttributeNone);
+        if (prefetched && probe->listed)
+          items.Assign(probe->items);
+        else
+          GetMoviesDirectory(strDirectory, items);
 
         // check whether to re-use previously computed fast hash
         if (!CanFastHash(items, regexps) || fastHash.empty())
@@ -496,6 +769,8 @@ CVideoInfoScanner::~CVideoInfoScanner()
         else
           hash = fastHash;
       }
+      if (!prefetched)
+        m_timings.enumerate += ElapsedSince(start);
 
       if (StringUtils::EqualsNoCase(hash, dbHash))
       { // hash matches - skipping
@@ -532,13 +807,16 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       if (foundDirectly && !settings.parent_name_root)
       {
-        CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
-                                 DIR_FLAG_DEFAULTS);
-        items.SetPath(strDirectory);
-
-        // force sorting consistency to avoid hash mismatch between platforms
-        // sort by filename as always present for any files, but keep case sensitivity
-        items.Sort(SortBy::FILE, SortOrder::ASCENDING, SortAttributeNone);
+        if (probe && probe->content == content && probe->listed)
+        {
+          items.Assign(probe->items);
+        }
+        else
+        {
+          const auto start = std::chrono::steady_clock::now();
+          GetTvShowDirectory(strDirectory, items);
+          m_timings.enumerate += ElapsedSince(start);
+        }
 
         GetPathHash(items, hash);
         bSkip = true;
@@ -559,7 +837,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
     bool foundSomething = false;
     if (!bSkip)
     {
+      const auto start = std::chrono::steady_clock::now();
       foundSomething = RetrieveVideoInfo(items, settings.parent_name_root, content);
+      m_timings.retrieve += ElapsedSince(start);
       if (foundSomething)
       {
         if (!m_bStop && (content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS))
@@ -2292,7 +2572,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
     for (const auto& artType : artTypes)
     {
       if (art.contains(artType))
-        CServiceBroker::GetTextureCache()->BackgroundCacheImage(art[artType]);
+        CServiceBroker::GetTextureCache()->BackgroundCacheImage(art[artType], true);
     }
 
     pItem->SetArt(art);
@@ -2677,8 +2957,8 @@ CVideoInfoScanner::~CVideoInfoScanner()
     return true;
   }
 
-  std::string CVideoInfoScanner::GetFastHash(const std::string &directory,
-      const std::vector<std::string> &excludes) const
+  std::string CVideoInfoScanner::GetFastHash(const std::string& directory,
+                                             const std::vector<std::string>& excludes)
   {
     CDigest digest{CDigest::Type::MD5};
 
@@ -2853,7 +3133,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
             i->thumbUrl.Clear();
         }
         if (!i->thumb.empty())
-          CServiceBroker::GetTextureCache()->BackgroundCacheImage(i->thumb);
+          CServiceBroker::GetTextureCache()->BackgroundCacheImage(i->thumb, true);
       }
     }
   }
@@ -14,6 +14,8 @@
 #include "guilib/GUIListItem.h"
 #include "utils/Artwork.h"
 
+#include <chrono>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -154,8 +156,41 @@ namespace KODI::VIDEO
     static std::string GetMovieSetInfoFolder(const std::string& setTitle);
 
   protected:
+    struct DirectoryProbe;
+    class CDirectoryPrefetcher;
+
+    /*! \brief Time spent in the stages of a scan
+     Listing and hashing runs concurrently for prefetched directories, so it is summed over all
+     threads and can exceed the duration of the scan.
+     */
+    struct ScanTimings
+    {
+      std::chrono::microseconds enumerate{0}; //!< directory listing and hashing
+      std::chrono::microseconds wait{0}; //!< waiting for prefetched directories
+      std::chrono::microseconds retrieve{0}; //!< retrieving info and writing it to the database
+      std::chrono::microseconds clean{0}; //!< cleaning or compressing the database
+      unsigned int directories{0};
+      unsigned int prefetched{0};
+    };
+
     virtual void Process();
     bool DoScan(const std::string& strDirectory) override;
+    bool DoScan(const std::string& strDirectory, const std::shared_ptr<DirectoryProbe>& probe);
+
+    /*! \brief Queue the filesystem work of DoScan() for the paths following the one being scanned
+     Listing and hashing directories are network round trips on remote sources, so they are done
+     ahead on a bounded set of workers. Database access stays on the scanner thread.
+     */
+    void PrefetchDirectories();
+
+    /*! \brief Take the prefetched probe of a directory, waiting for it if it is still running
+     \return the probe or nullptr if the directory wasn't prefetched
+     */
+    std::shared_ptr<DirectoryProbe> TakePrefetched(const std::string& strDirectory);
+
+    /*! \brief Perform the filesystem work of DoScan() for a directory, safe to call from any thread
+     */
+    static void ProbeDirectory(DirectoryProbe& probe);
 
     InfoRet RetrieveInfoForTvShow(CFileItem* pItem,
                                   bool bDirNames,
@@ -273,7 +308,8 @@ namespace KODI::VIDEO
      \param excludes string array of exclude expressions
      \return the md5 hash of the folder"
      */
-    std::string GetFastHash(const std::string &directory, const std::vector<std::string> &excludes) const;
+    static std::string GetFastHash(const std::string& directory,
+                                   const std::vector<std::string>& excludes);
 
     /*! \brief Retrieve a "fast" hash of the given directory recursively (if available)
      Performs a stat() on the directory, and uses modified time to create a "fast"
@@ -331,5 +367,8 @@ namespace KODI::VIDEO
     std::set<int> m_pathsToClean;
     std::shared_ptr<CAdvancedSettings> m_advancedSettings;
     CVideoDatabase::ScraperCache m_scraperCache;
+    std::unique_ptr<CDirectoryPrefetcher> m_prefetcher;
+    std::string m_prefetchCursor;
+    ScanTimings m_timings;
   };
   } // namespace KODI::VIDEO
@@ -193,6 +193,14 @@ bool CVideoThumbLoader::LoadItemCached(CFileItem* pItem)
     }
   }
 
+  // lists may leave out long columns of movies and episodes, fill them in for display
+  if (pItem->HasVideoInfoTag() &&
+      (pItem->GetVideoInfoTag()->m_parsedDetails & VideoDbSkipColumns))
+  {
+    if (m_videoDatabase->GetSkippedDetails(*pItem->GetVideoInfoTag()))
+      pItem->SetInvalid();
+  }
+
   // video db items normally have info in the database
   if (pItem->HasVideoInfoTag() && !pItem->GetProperty("libraryartfilled").asBoolean())
   {
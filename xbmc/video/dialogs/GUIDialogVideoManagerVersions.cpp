@@ -547,7 +547,8 @@ bool CGUIDialogVideoManagerVersions::GetAllOtherMovies(const std::shared_ptr<CFi
   list.Clear();
 
   if (item->GetVideoContentType() == VideoDbContentType::MOVIES)
-    videoDb.GetMoviesNav(videoTitlesDir, list);
+    videoDb.GetMoviesNav(videoTitlesDir, list, -1, -1, -1, -1, -1, -1, -1, -1, SortDescription(),
+                         VideoDbSkipColumns);
   else
     return false;
 
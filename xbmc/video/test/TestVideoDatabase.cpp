@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "filesystem/SpecialProtocol.h"
+#include "profiles/ProfileManager.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/SortUtils.h"
+#include "video/VideoDatabase.h"
+#include "video/VideoInfoTag.h"
+
+#include <filesystem>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr const char* DATABASE_NAME = "TestVideoDatabase";
+
+class TestVideoDatabase : public ::testing::Test
+{
+protected:
+  ~TestVideoDatabase() override
+  {
+    m_db.Close();
+    GetSettings() = m_settings;
+
+    // the schema version is part of the file name
+    const std::filesystem::path folder = CSpecialProtocol::TranslatePath(
+        CServiceBroker::GetSettingsComponent()->GetProfileManager()->GetDatabaseFolder());
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(folder, ec))
+    {
+      if (entry.path().filename().string().starts_with(DATABASE_NAME))
+        std::filesystem::remove(entry.path(), ec);
+    }
+  }
+
+  static DatabaseSettings& GetSettings()
+  {
+    return CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseVideo;
+  }
+
+  bool Open(bool columnarResults)
+  {
+    DatabaseSettings& settings = GetSettings();
+    settings.Reset();
+    settings.type = "sqlite3";
+    settings.name = DATABASE_NAME;
+    settings.columnarresults = columnarResults;
+    return m_db.Open();
+  }
+
+  // adds movies "Movie 00" to "Movie <count - 1>" in reverse order
+  void AddMovies(int count)
+  {
+    for (int i = count - 1; i >= 0; --i)
+    {
+      const std::string number = (i < 10 ? "0" : "") + std::to_string(i);
+      CVideoInfoTag tag;
+      tag.SetTitle("Movie " + number);
+      tag.SetPlot("Plot of movie " + number);
+      tag.SetFileNameAndPath("/movies/movie" + number + ".mkv");
+      ASSERT_GT(m_db.SetDetailsForMovie(tag, {}), 0);
+    }
+  }
+
+  CVideoDatabase m_db;
+  DatabaseSettings m_settings{GetSettings()};
+};
+} // unnamed namespace
+
+TEST_F(TestVideoDatabase, ColumnarResults)
+{
+  ASSERT_TRUE(Open(true));
+  AddMovies(20);
+
+  SortDescription sorting;
+  sorting.sortBy = SortBy::TITLE;
+  sorting.limitStart = 5;
+  sorting.limitEnd = 10;
+  CFileItemList items;
+  ASSERT_TRUE(m_db.GetMoviesByWhere("videodb://movies/titles/", CDatabase::Filter(), items,
+                                    sorting, VideoDbDetailsAll));
+
+  EXPECT_EQ(20, items.GetProperty("total").asInteger());
+  ASSERT_EQ(5, items.Size());
+  for (int i = 0; i < items.Size(); ++i)
+  {
+    const CVideoInfoTag* tag = items[i]->GetVideoInfoTag();
+    ASSERT_NE(nullptr, tag);
+    const std::string number = "0" + std::to_string(i + 5);
+    EXPECT_EQ("Movie " + number, tag->m_strTitle);
+    EXPECT_EQ("Plot of movie " + number, tag->m_strPlot);
+  }
+}
+
+TEST_F(TestVideoDatabase, SkippedDetails)
+{
+  ASSERT_TRUE(Open(false));
+  AddMovies(3);
+
+  SortDescription sorting;
+  sorting.sortBy = SortBy::TITLE;
+  CFileItemList items;
+  ASSERT_TRUE(m_db.GetMoviesByWhere("videodb://movies/titles/", CDatabase::Filter(), items,
+                                    sorting, VideoDbSkipColumns));
+  ASSERT_EQ(3, items.Size());
+  for (int i = 0; i < items.Size(); ++i)
+  {
+    CVideoInfoTag* tag = items[i]->GetVideoInfoTag();
+    ASSERT_NE(nullptr, tag);
+    const std::string number = "0" + std::to_string(i);
+    EXPECT_EQ("Movie " + number, tag->m_strTitle);
+    EXPECT_TRUE(tag->m_strPlot.empty());
+    EXPECT_EQ(VideoDbSkipColumns, tag->m_parsedDetails & VideoDbSkipColumns);
+
+    ASSERT_TRUE(m_db.GetSkippedDetails(*tag));
+    EXPECT_EQ("Movie " + number, tag->m_strTitle);
+    EXPECT_EQ("Plot of movie " + number, tag->m_strPlot);
+    EXPECT_EQ(0, tag->m_parsedDetails & VideoDbSkipColumns);
+  }
+}
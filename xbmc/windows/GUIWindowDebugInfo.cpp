@@ -11,6 +11,7 @@
 #include "CompileInfo.h"
 #include "GUIInfoManager.h"
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "addons/Skin.h"
 #include "commons/ilog.h"
 #include "filesystem/SpecialProtocol.h"
@@ -18,6 +19,7 @@
 #include "guilib/GUIControlFactory.h"
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
+#include "guilib/GUIRenderBatch.h"
 #include "guilib/GUITextLayout.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/WindowTranslator.h"
@@ -133,6 +135,19 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetFPS(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
+    const GUIRenderStats& stats = CServiceBroker::GetGUI()->GetRenderBatch().GetFrameStats();
+    info += StringUtils::Format("\nGUI: {} draws - {} state changes - {} quads", stats.drawCalls,
+                                stats.stateChanges, stats.quads);
+    const CTextureCache::LoadStats loads = CServiceBroker::GetTextureCache()->GetLoadStats();
+    if (loads.preDecoded > 0 || loads.decoded > 0)
+    {
+      const auto average = [](std::chrono::microseconds time, uint64_t count)
+      { return count > 0 ? time.count() / 1000.0 / count : 0.0; };
+      info += StringUtils::Format(
+          "\nART: {} pre-decoded ({:.1f} ms) - {} decoded ({:.1f} ms)", loads.preDecoded,
+          average(loads.preDecodedTime, loads.preDecoded), loads.decoded,
+          average(loads.decodedTime, loads.decoded));
+    }
   }
 
   // render the skin debug info